@@ -10,7 +10,7 @@ TARGET = eagle-import
 # Use common project definitions
 include(../../common.pri)
 
-QT += core widgets xml network
+QT += core widgets xml network concurrent
 
 LIBS += \
     -L$${DESTDIR} \
@@ -47,11 +47,9 @@ PRE_TARGETDEPS += \
 SOURCES += \
     main.cpp \
     mainwindow.cpp \
-    polygonsimplifier.cpp \
 
 HEADERS += \
     mainwindow.h \
-    polygonsimplifier.h \
 
 FORMS += \
     mainwindow.ui \
@@ -1,31 +1,18 @@
 #include "mainwindow.h"
 
-#include "polygonsimplifier.h"
 #include "ui_mainwindow.h"
 
 #include <librepcb/common/fileio/fileutils.h>
-#include <librepcb/common/fileio/transactionalfilesystem.h>
-#include <librepcb/common/graphics/graphicslayer.h>
 #include <librepcb/eagleimport/converterdb.h>
-#include <librepcb/eagleimport/deviceconverter.h>
-#include <librepcb/eagleimport/devicesetconverter.h>
-#include <librepcb/eagleimport/packageconverter.h>
-#include <librepcb/eagleimport/symbolconverter.h>
-#include <librepcb/library/cmp/component.h>
-#include <librepcb/library/dev/device.h>
-#include <librepcb/library/pkg/footprint.h>
-#include <librepcb/library/pkg/package.h>
-#include <librepcb/library/sym/symbol.h>
-#include <parseagle/library.h>
 
+#include <QtConcurrent/QtConcurrent>
 #include <QtCore>
 #include <QtWidgets>
 
 namespace librepcb {
-using namespace library;
 
 MainWindow::MainWindow(QWidget* parent)
-  : QMainWindow(parent), ui(new Ui::MainWindow) {
+  : QMainWindow(parent), ui(new Ui::MainWindow), mConverter(nullptr) {
   ui->setupUi(this);
 
   QSettings s;
@@ -60,10 +47,6 @@ MainWindow::~MainWindow() {
 }
 
 void MainWindow::reset() {
-  mAbortConversion        = false;
-  mReadedElementsCount    = 0;
-  mConvertedElementsCount = 0;
-
   ui->errors->clear();
   ui->pbarElements->setValue(0);
   ui->pbarElements->setMaximum(0);
@@ -78,7 +61,9 @@ void MainWindow::addError(const QString& msg, const FilePath& inputFile,
       QString("%1 (%2:%3)").arg(msg).arg(inputFile.toNative()).arg(inputLine));
 }
 
-void MainWindow::convertAllFiles(ConvertFileType_t type) {
+void MainWindow::convertAllFiles(
+    eagleimport::LibraryConverter::ElementType type) {
+  if (mConverter) return;  // conversion is already running
   reset();
 
   // create output directory
@@ -89,173 +74,49 @@ void MainWindow::convertAllFiles(ConvertFileType_t type) {
     addError("Fatal Error: " % e.getMsg());
   }
 
-  eagleimport::ConverterDb db(FilePath(ui->uuidList->text()));
-
+  QList<FilePath> files;
   for (int i = 0; i < ui->input->count(); i++) {
-    FilePath filepath(ui->input->item(i)->text());
-    if (!filepath.isExistingFile()) {
-      addError("File not found: " % filepath.toNative());
-      continue;
-    }
-
-    convertFile(type, db, filepath);
-    ui->pbarFiles->setValue(i + 1);
-
-    if (mAbortConversion) break;
+    files.append(FilePath(ui->input->item(i)->text()));
   }
-}
 
-void MainWindow::convertFile(ConvertFileType_t         type,
-                             eagleimport::ConverterDb& db,
-                             const FilePath&           filepath) {
-  try {
-    parseagle::Library library(filepath.toStr());
-    db.setCurrentLibraryFilePath(filepath);
-
-    switch (type) {
-      case ConvertFileType_t::Symbols_to_Symbols:
-        ui->pbarElements->setValue(0);
-        ui->pbarElements->setMaximum(library.getSymbols().count());
-        foreach (const parseagle::Symbol& symbol, library.getSymbols()) {
-          bool success = convertSymbol(db, symbol);
-          mReadedElementsCount++;
-          if (success) mConvertedElementsCount++;
-          ui->pbarElements->setValue(ui->pbarElements->value() + 1);
-          ui->lblConvertedElements->setText(QString("%1 of %2")
-                                                .arg(mConvertedElementsCount)
-                                                .arg(mReadedElementsCount));
-        }
-        break;
-      case ConvertFileType_t::Packages_to_PackagesAndDevices:
-        ui->pbarElements->setValue(0);
-        ui->pbarElements->setMaximum(library.getPackages().count());
-        foreach (const parseagle::Package& package, library.getPackages()) {
-          bool success = convertPackage(db, package);
-          mReadedElementsCount++;
-          if (success) mConvertedElementsCount++;
-          ui->pbarElements->setValue(ui->pbarElements->value() + 1);
-          ui->lblConvertedElements->setText(QString("%1 of %2")
-                                                .arg(mConvertedElementsCount)
-                                                .arg(mReadedElementsCount));
-        }
-        break;
-      case ConvertFileType_t::Devices_to_Components:
-        ui->pbarElements->setValue(0);
-        ui->pbarElements->setMaximum(library.getDeviceSets().count());
-        foreach (const parseagle::DeviceSet& deviceSet,
-                 library.getDeviceSets()) {
-          bool success = convertDevice(db, deviceSet);
-          mReadedElementsCount++;
-          if (success) mConvertedElementsCount++;
-          ui->pbarElements->setValue(ui->pbarElements->value() + 1);
-          ui->lblConvertedElements->setText(QString("%1 of %2")
-                                                .arg(mConvertedElementsCount)
-                                                .arg(mReadedElementsCount));
-        }
-        break;
-      default:
-        throw Exception(__FILE__, __LINE__);
-    }
-  } catch (const std::exception& e) {
-    addError(e.what());
-    return;
+  eagleimport::ConverterDb      db(FilePath(ui->uuidList->text()));
+  eagleimport::LibraryConverter converter(db, outputDir);
+  connect(&converter, &eagleimport::LibraryConverter::fileStarted, this,
+          [this](int index, int elementCount) {
+            ui->pbarFiles->setValue(index);
+            ui->pbarElements->setValue(0);
+            ui->pbarElements->setMaximum(elementCount);
+          });
+  connect(&converter, &eagleimport::LibraryConverter::elementProcessed, this,
+          [this](int readElements, int convertedElements) {
+            ui->pbarElements->setValue(ui->pbarElements->value() + 1);
+            ui->lblConvertedElements->setText(
+                QString("%1 of %2").arg(convertedElements).arg(readElements));
+          });
+
+  // run the conversion in a worker thread to keep the GUI responsive
+  typedef eagleimport::LibraryConverter::Result Result;
+  QFutureWatcher<Result>                        watcher;
+  QEventLoop                                    loop;
+  connect(&watcher, &QFutureWatcher<Result>::finished, &loop,
+          &QEventLoop::quit);
+  mConverter = &converter;
+  watcher.setFuture(QtConcurrent::run(
+      [&converter, type, files]() { return converter.convert(type, files); }));
+  loop.exec();
+  mConverter = nullptr;
+
+  Result result = watcher.result();
+  foreach (const QString& error, result.errors) {
+    addError(error);
   }
-}
+  ui->pbarFiles->setValue(files.count());
 
-bool MainWindow::convertSymbol(eagleimport::ConverterDb& db,
-                               const parseagle::Symbol&  symbol) {
   try {
-    // create symbol
-    eagleimport::SymbolConverter converter(symbol, db);
-    std::unique_ptr<Symbol>      newSymbol = converter.generate();
-
-    // convert line rects to polygon rects
-    PolygonSimplifier<Symbol> polygonSimplifier(*newSymbol);
-    polygonSimplifier.convertLineRectsToPolygonRects(false, true);
-
-    // save symbol to file
-    std::shared_ptr<TransactionalFileSystem> fs =
-        TransactionalFileSystem::openRW(
-            FilePath(QString("%1/sym").arg(ui->output->text())));
-    TransactionalDirectory dir(fs);
-    newSymbol->moveIntoParentDirectory(dir);
-    fs->save();
-  } catch (const std::exception& e) {
-    addError(e.what());
-    return false;
-  }
-
-  return true;
-}
-
-bool MainWindow::convertPackage(eagleimport::ConverterDb& db,
-                                const parseagle::Package& package) {
-  try {
-    // create package
-    eagleimport::PackageConverter converter(package, db);
-    std::unique_ptr<Package>      newPackage = converter.generate();
-
-    // convert line rects to polygon rects
-    Q_ASSERT(newPackage->getFootprints().count() == 1);
-    PolygonSimplifier<Footprint> polygonSimplifier(
-        *newPackage->getFootprints().first());
-    polygonSimplifier.convertLineRectsToPolygonRects(false, true);
-
-    // save package to file
-    std::shared_ptr<TransactionalFileSystem> fs =
-        TransactionalFileSystem::openRW(
-            FilePath(QString("%1/pkg").arg(ui->output->text())));
-    TransactionalDirectory dir(fs);
-    newPackage->moveIntoParentDirectory(dir);
-    fs->save();
-  } catch (const std::exception& e) {
-    addError(e.what());
-    return false;
-  }
-
-  return true;
-}
-
-bool MainWindow::convertDevice(eagleimport::ConverterDb&   db,
-                               const parseagle::DeviceSet& deviceSet) {
-  try {
-    // abort if device name ends with "-US" or "-US_"
-    if (deviceSet.getName().endsWith("-US")) return false;
-    if (deviceSet.getName().endsWith("-US_")) return false;
-
-    // create component
-    eagleimport::DeviceSetConverter converter(deviceSet, db);
-    std::unique_ptr<Component>      newComponent = converter.generate();
-
-    // create devices
-    foreach (const parseagle::Device& device, deviceSet.getDevices()) {
-      if (device.getPackage().isNull()) continue;
-
-      eagleimport::DeviceConverter devConverter(deviceSet, device, db);
-      std::unique_ptr<Device>      newDevice = devConverter.generate();
-
-      // save device
-      std::shared_ptr<TransactionalFileSystem> fs =
-          TransactionalFileSystem::openRW(
-              FilePath(QString("%1/dev").arg(ui->output->text())));
-      TransactionalDirectory dir(fs);
-      newDevice->moveIntoParentDirectory(dir);
-      fs->save();
-    }
-
-    // save component to file
-    std::shared_ptr<TransactionalFileSystem> fs =
-        TransactionalFileSystem::openRW(
-            FilePath(QString("%1/cmp").arg(ui->output->text())));
-    TransactionalDirectory dir(fs);
-    newComponent->moveIntoParentDirectory(dir);
-    fs->save();
-  } catch (const std::exception& e) {
-    addError(e.what());
-    return false;
+    db.save();  // can throw
+  } catch (const Exception& e) {
+    addError("Fatal Error: " % e.getMsg());
   }
-
-  return true;
 }
 
 void MainWindow::on_inputBtn_clicked() {
@@ -273,19 +134,19 @@ void MainWindow::on_outputBtn_clicked() {
 }
 
 void MainWindow::on_btnAbort_clicked() {
-  mAbortConversion = true;
+  if (mConverter) mConverter->abort();
 }
 
 void MainWindow::on_btnConvertSymbols_clicked() {
-  convertAllFiles(ConvertFileType_t::Symbols_to_Symbols);
+  convertAllFiles(eagleimport::LibraryConverter::ElementType::Symbols);
 }
 
 void MainWindow::on_btnConvertDevices_clicked() {
-  convertAllFiles(ConvertFileType_t::Devices_to_Components);
+  convertAllFiles(eagleimport::LibraryConverter::ElementType::Devices);
 }
 
 void MainWindow::on_pushButton_2_clicked() {
-  convertAllFiles(ConvertFileType_t::Packages_to_PackagesAndDevices);
+  convertAllFiles(eagleimport::LibraryConverter::ElementType::Packages);
 }
 
 void MainWindow::on_btnPathsFromIni_clicked() {
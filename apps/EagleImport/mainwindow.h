@@ -3,6 +3,7 @@
 
 #include <librepcb/common/fileio/filepath.h>
 #include <librepcb/common/uuid.h>
+#include <librepcb/eagleimport/libraryconverter.h>
 
 #include <QtCore>
 #include <QtWidgets>
@@ -11,18 +12,8 @@ namespace Ui {
 class MainWindow;
 }
 
-namespace parseagle {
-class Symbol;
-class Package;
-class DeviceSet;
-}  // namespace parseagle
-
 namespace librepcb {
 
-namespace eagleimport {
-class ConverterDb;
-}
-
 class MainWindow : public QMainWindow {
   Q_OBJECT
 
@@ -45,32 +36,16 @@ private slots:
   void on_uuidListBtn_clicked();
 
 private:
-  enum class ConvertFileType_t {
-    Symbols_to_Symbols,
-    Packages_to_PackagesAndDevices,
-    Devices_to_Components
-  };
-
   void reset();
   void addError(const QString&            msg,
                 const librepcb::FilePath& inputFile = librepcb::FilePath(),
                 int                       inputLine = 0);
-  void convertAllFiles(ConvertFileType_t type);
-  void convertFile(ConvertFileType_t type, eagleimport::ConverterDb& db,
-                   const librepcb::FilePath& filepath);
-  bool convertSymbol(eagleimport::ConverterDb& db,
-                     const parseagle::Symbol&  symbol);
-  bool convertPackage(eagleimport::ConverterDb& db,
-                      const parseagle::Package& package);
-  bool convertDevice(eagleimport::ConverterDb&   db,
-                     const parseagle::DeviceSet& deviceSet);
+  void convertAllFiles(eagleimport::LibraryConverter::ElementType type);
 
   // Attributes
-  Ui::MainWindow* ui;
-  bool            mAbortConversion;
-  QString         mlastInputDirectory;
-  int             mReadedElementsCount;
-  int             mConvertedElementsCount;
+  Ui::MainWindow*                ui;
+  eagleimport::LibraryConverter* mConverter;  ///< nullptr if not converting
+  QString                        mlastInputDirectory;
 };
 
 }  // namespace librepcb
@@ -0,0 +1,61 @@
+#-------------------------------------------------
+#
+# Project created 2026-10-19
+#
+#-------------------------------------------------
+
+TEMPLATE = app
+TARGET = project-generator
+
+# Use common project definitions
+include(../../common.pri)
+
+QT += core widgets opengl network xml printsupport sql
+
+CONFIG += console
+
+# Note: The order of the libraries is very important for the linker!
+# Another order could end up in "undefined reference" errors!
+LIBS += \
+    -L$${DESTDIR} \
+    -llibrepcbprojecteditor \
+    -llibrepcbworkspace \
+    -llibrepcbproject \
+    -llibrepcblibrary \
+    -llibrepcbcommon \
+    -lsexpresso \
+    -lclipper \
+    -lquazip -lz
+
+INCLUDEPATH += \
+    ../../libs \
+    ../../libs/quazip \
+    ../../libs/type_safe/include \
+    ../../libs/type_safe/external/debug_assert \
+
+DEPENDPATH += \
+    ../../libs/librepcb/projecteditor \
+    ../../libs/librepcb/workspace \
+    ../../libs/librepcb/project \
+    ../../libs/librepcb/library \
+    ../../libs/librepcb/common \
+    ../../libs/quazip \
+    ../../libs/sexpresso \
+    ../../libs/clipper \
+
+PRE_TARGETDEPS += \
+    $${DESTDIR}/liblibrepcbprojecteditor.a \
+    $${DESTDIR}/liblibrepcbworkspace.a \
+    $${DESTDIR}/liblibrepcbproject.a \
+    $${DESTDIR}/liblibrepcblibrary.a \
+    $${DESTDIR}/liblibrepcbcommon.a \
+    $${DESTDIR}/libquazip.a \
+    $${DESTDIR}/libsexpresso.a \
+    $${DESTDIR}/libclipper.a \
+
+SOURCES += \
+    main.cpp \
+    projectgenerator.cpp \
+
+HEADERS += \
+    projectgenerator.h \
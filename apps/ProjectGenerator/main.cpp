@@ -0,0 +1,141 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "projectgenerator.h"
+
+#include <librepcb/common/application.h>
+#include <librepcb/common/debug.h>
+#include <librepcb/common/exceptions.h>
+#include <librepcb/common/graphics/graphicslayer.h>
+#include <librepcb/workspace/library/workspacelibrarydb.h>
+#include <librepcb/workspace/workspace.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+using namespace librepcb;
+using namespace librepcb::projectgenerator;
+
+/*******************************************************************************
+ *  main()
+ ******************************************************************************/
+
+int main(int argc, char* argv[]) {
+  // creates the Debug object which installs the message handler, so this
+  // must be done as early as possible
+  Debug::instance();
+  Debug::instance()->setDebugLevelStderr(Debug::DebugLevel_t::Info);
+
+  Application app(argc, argv);
+  Application::setOrganizationName("LibrePCB");
+  Application::setOrganizationDomain("librepcb.org");
+  Application::setApplicationName("LibrePCB Project Generator");
+
+  QCommandLineParser parser;
+  parser.setApplicationDescription(
+      "Generates a synthetic LibrePCB project of configurable size for scale "
+      "testing, using devices from the workspace library.");
+  parser.addHelpOption();
+  parser.addPositionalArgument("project", "Path to the *.lpp file to create.");
+  QCommandLineOption wsOption("workspace", "Path to the workspace to use.",
+                              "path");
+  QCommandLineOption componentsOption("components", "Number of components.",
+                                      "count", "100");
+  QCommandLineOption netsOption("nets", "Number of nets.", "count", "200");
+  QCommandLineOption planesOption("planes", "Number of planes.", "count", "2");
+  QCommandLineOption layersOption("layers", "Number of copper layers.",
+                                  "count", "4");
+  QCommandLineOption routedOption(
+      "routed", "Percentage of nets to route on the board.", "percent", "50");
+  QCommandLineOption pageOption(
+      "symbols-per-page", "Number of symbols per schematic page.", "count",
+      "25");
+  QCommandLineOption seedOption("seed", "Seed of the random generator.",
+                                "number", "0");
+  parser.addOptions({wsOption, componentsOption, netsOption, planesOption,
+                     layersOption, routedOption, pageOption, seedOption});
+  parser.process(app);
+
+  // validate arguments
+  auto getInt = [&parser](const QCommandLineOption& option, int min, int max) {
+    bool ok    = false;
+    int  value = parser.value(option).toInt(&ok);
+    if ((!ok) || (value < min) || (value > max)) {
+      qFatal("Invalid value for --%s: %s (must be in range %d..%d)",
+             qPrintable(option.names().first()),
+             qPrintable(parser.value(option)), min, max);
+    }
+    return value;
+  };
+  ProjectGenerator::Options options;
+  options.components          = getInt(componentsOption, 1, 1000000);
+  options.nets                = getInt(netsOption, 0, 1000000);
+  options.planes              = getInt(planesOption, 0, 1000);
+  options.layers =
+      getInt(layersOption, 2, GraphicsLayer::getInnerLayerCount() + 2);
+  options.routedPercent       = getInt(routedOption, 0, 100);
+  options.symbolsPerSchematic = getInt(pageOption, 1, 1000);
+  options.seed                = getInt(seedOption, 0, INT_MAX);
+  if (parser.positionalArguments().count() != 1) {
+    parser.showHelp(1);
+  }
+  FilePath projectFp(
+      QFileInfo(parser.positionalArguments().first()).absoluteFilePath());
+  FilePath wsPath(QFileInfo(parser.value(wsOption)).absoluteFilePath());
+  if ((!parser.isSet(wsOption)) ||
+      (!workspace::Workspace::isValidWorkspacePath(wsPath))) {
+    qCritical() << "No valid workspace specified with --workspace.";
+    return 1;
+  }
+  if (projectFp.getParentDir().isExistingDir() &&
+      (!projectFp.getParentDir().isEmptyDir())) {
+    qCritical() << "The project directory is not empty:"
+                << projectFp.getParentDir().toNative();
+    return 1;
+  }
+
+  try {
+    QElapsedTimer timer;
+    timer.start();
+
+    // open workspace and make sure the library database is up to date
+    workspace::Workspace ws(wsPath);  // can throw
+    QEventLoop           loop;
+    QObject::connect(&ws.getLibraryDb(),
+                     &workspace::WorkspaceLibraryDb::scanFinished, &loop,
+                     &QEventLoop::quit);
+    ws.getLibraryDb().startLibraryRescan();
+    loop.exec();
+
+    // generate the project
+    ProjectGenerator generator(ws, options);
+    generator.generate(projectFp);  // can throw
+    qInfo() << "Generated project" << projectFp.toNative() << "in"
+            << timer.elapsed() << "ms.";
+    return 0;
+  } catch (const Exception& e) {
+    qCritical() << "Failed to generate the project:" << e.getMsg();
+    return 1;
+  }
+}
@@ -0,0 +1,407 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "projectgenerator.h"
+
+#include <librepcb/common/exceptions.h>
+#include <librepcb/common/fileio/transactionalfilesystem.h>
+#include <librepcb/common/graphics/graphicslayer.h>
+#include <librepcb/common/undostack.h>
+#include <librepcb/library/cmp/component.h>
+#include <librepcb/library/dev/device.h>
+#include <librepcb/project/boards/board.h>
+#include <librepcb/project/boards/boardlayerstack.h>
+#include <librepcb/project/boards/cmd/cmdboardnetsegmentadd.h>
+#include <librepcb/project/boards/cmd/cmdboardnetsegmentaddelements.h>
+#include <librepcb/project/boards/cmd/cmdboardplaneadd.h>
+#include <librepcb/project/boards/items/bi_footprintpad.h>
+#include <librepcb/project/boards/items/bi_netsegment.h>
+#include <librepcb/project/boards/items/bi_plane.h>
+#include <librepcb/project/boards/items/bi_polygon.h>
+#include <librepcb/project/circuit/circuit.h>
+#include <librepcb/project/circuit/cmd/cmdcompsiginstsetnetsignal.h>
+#include <librepcb/project/circuit/cmd/cmdnetsignaladd.h>
+#include <librepcb/project/circuit/componentinstance.h>
+#include <librepcb/project/circuit/componentsignalinstance.h>
+#include <librepcb/project/circuit/netsignal.h>
+#include <librepcb/project/project.h>
+#include <librepcb/project/schematics/cmd/cmdschematicnetlabeladd.h>
+#include <librepcb/project/schematics/cmd/cmdschematicnetsegmentadd.h>
+#include <librepcb/project/schematics/cmd/cmdschematicnetsegmentaddelements.h>
+#include <librepcb/project/schematics/items/si_netsegment.h>
+#include <librepcb/project/schematics/items/si_symbol.h>
+#include <librepcb/project/schematics/items/si_symbolpin.h>
+#include <librepcb/project/schematics/schematic.h>
+#include <librepcb/projecteditor/cmd/cmdaddcomponenttocircuit.h>
+#include <librepcb/projecteditor/cmd/cmdadddevicetoboard.h>
+#include <librepcb/projecteditor/cmd/cmdaddsymboltoschematic.h>
+#include <librepcb/workspace/library/workspacelibrarydb.h>
+#include <librepcb/workspace/workspace.h>
+
+#include <QtCore>
+
+#include <algorithm>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace projectgenerator {
+
+using namespace library;
+using namespace project;
+using namespace project::editor;
+
+/*******************************************************************************
+ *  Constructors / Destructor
+ ******************************************************************************/
+
+ProjectGenerator::ProjectGenerator(workspace::Workspace& workspace,
+                                   const Options&        options) noexcept
+  : mWorkspace(workspace),
+    mOptions(options),
+    mRandomGenerator(options.seed),
+    mSymbolCount(0) {
+}
+
+ProjectGenerator::~ProjectGenerator() noexcept {
+}
+
+/*******************************************************************************
+ *  General Methods
+ ******************************************************************************/
+
+void ProjectGenerator::generate(const FilePath& projectFile) {
+  QList<DeviceInfo> devices = getAvailableDevices();  // can throw
+  if (devices.isEmpty()) {
+    throw RuntimeError(__FILE__, __LINE__,
+                       tr("The workspace library does not contain any usable "
+                          "device."));
+  }
+  qInfo() << "Found" << devices.count() << "usable devices.";
+
+  // create empty project with one board
+  std::shared_ptr<TransactionalFileSystem> fs =
+      TransactionalFileSystem::openRW(projectFile.getParentDir());
+  QScopedPointer<Project> project(Project::create(
+      std::unique_ptr<TransactionalDirectory>(new TransactionalDirectory(fs)),
+      projectFile.getFilename()));  // can throw
+  project->getMetadata().setName(
+      ElementName(projectFile.getCompleteBasename()));  // can throw
+  project->getMetadata().setAuthor("LibrePCB Project Generator");
+  project->getSettings().setLocaleOrder(
+      mWorkspace.getSettings().getLibLocaleOrder().getLocaleOrder());
+  project->getSettings().setNormOrder(
+      mWorkspace.getSettings().getLibNormOrder().getNormOrder());
+  Board* board = project->createBoard(ElementName("Board"));  // can throw
+  project->addBoard(*board);                                   // can throw
+  board->getLayerStack().setInnerLayerCount(mOptions.layers - 2);
+
+  // all modifications are done with the same undo commands as used by the
+  // editors to get exactly the same project structure
+  UndoStack undoStack;
+  addComponents(*project, *board, undoStack, devices);  // can throw
+  QList<NetSignal*> netsignals = addNets(*project, undoStack);  // can throw
+
+  // connect all nets in the schematics and route some of them on the board
+  QList<GraphicsLayer*> layers      = getCopperLayers(*board);
+  int                   routedCount = 0;
+  for (int i = 0; i < netsignals.count(); ++i) {
+    drawSchematicNets(*netsignals[i], undoStack);  // can throw
+    if (random(99) < mOptions.routedPercent) {
+      GraphicsLayer* layer = layers[i % layers.count()];
+      routeBoardNet(*board, *netsignals[i], *layer, undoStack);  // can throw
+      ++routedCount;
+    }
+  }
+  addPlanes(*board, undoStack, netsignals);  // can throw
+  qInfo() << "Routed" << routedCount << "of" << netsignals.count() << "nets.";
+
+  // save project to file system
+  project->save();  // can throw
+  fs->save();       // can throw
+}
+
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+QList<ProjectGenerator::DeviceInfo> ProjectGenerator::getAvailableDevices()
+    const {
+  const workspace::WorkspaceLibraryDb& db = mWorkspace.getLibraryDb();
+
+  // sort libraries by path to get a stable order for the random generator
+  QList<FilePath> libraries = db.getLibraries().values();  // can throw
+  std::sort(libraries.begin(), libraries.end(),
+            [](const FilePath& a, const FilePath& b) {
+              return a.toStr() < b.toStr();
+            });
+
+  QHash<Uuid, tl::optional<Uuid>> symbolVariants;  // component -> variant
+  QSet<Uuid>                      deviceUuids;
+  QList<DeviceInfo>               devices;
+  foreach (const FilePath& libFp, libraries) {
+    foreach (const FilePath& devFp,
+             db.getLibraryElements<Device>(libFp)) {  // can throw
+      Uuid devUuid = Uuid::createRandom();  // only for initialization, will be
+                                            // overwritten
+      Uuid cmpUuid = Uuid::createRandom();  // only for initialization, will be
+                                            // overwritten
+      db.getElementMetadata<Device>(devFp, &devUuid);    // can throw
+      db.getDeviceMetadata(devFp, nullptr, &cmpUuid);    // can throw
+      if (deviceUuids.contains(devUuid)) continue;       // older version
+      if (!symbolVariants.contains(cmpUuid)) {
+        // use the first symbol variant which contains any symbols
+        tl::optional<Uuid> symbVarUuid;
+        try {
+          FilePath cmpFp = db.getLatestComponent(cmpUuid);  // can throw
+          if (cmpFp.isValid()) {
+            Component cmp(std::unique_ptr<TransactionalDirectory>(
+                new TransactionalDirectory(
+                    TransactionalFileSystem::openRO(cmpFp))));  // can throw
+            for (const ComponentSymbolVariant& var :
+                 cmp.getSymbolVariants()) {
+              if (!var.getSymbolItems().isEmpty()) {
+                symbVarUuid = var.getUuid();
+                break;
+              }
+            }
+          }
+        } catch (const Exception& e) {
+          qWarning() << "Skipping component" << cmpUuid.toStr() << ":"
+                     << e.getMsg();
+        }
+        symbolVariants.insert(cmpUuid, symbVarUuid);
+      }
+      if (tl::optional<Uuid> symbVarUuid = symbolVariants.value(cmpUuid)) {
+        deviceUuids.insert(devUuid);
+        devices.append(DeviceInfo{devUuid, cmpUuid, *symbVarUuid});
+      }
+    }
+  }
+  return devices;
+}
+
+void ProjectGenerator::addComponents(Project& project, Board& board,
+                                     UndoStack&               undoStack,
+                                     const QList<DeviceInfo>& devices) {
+  // place the devices in a square grid on the board
+  const Length pitch   = Length::fromMm(15);
+  const Length margin  = Length::fromMm(10);
+  const int    columns = qCeil(qSqrt(mOptions.components));
+  const int    rows    = qCeil(mOptions.components / qreal(columns));
+  mBoardSize = Point(margin * 2 + pitch * (columns - 1),
+                     margin * 2 + pitch * qMax(rows - 1, 0));
+  board.getPolygons().first()->getPolygon().setPath(
+      Path::rect(Point(0, 0), mBoardSize));
+
+  int failedCount = 0;
+  for (int i = 0; i < mOptions.components; ++i) {
+    const DeviceInfo& dev = devices[random(devices.count() - 1)];
+    Point boardPos(margin + pitch * (i % columns),
+                   margin + pitch * (i / columns));
+    int   symbolCount = mSymbolCount;
+    try {
+      UndoStackTransaction transaction(undoStack, tr("Add component"));
+      CmdAddComponentToCircuit* cmd = new CmdAddComponentToCircuit(
+          mWorkspace, project, dev.component, dev.symbolVariant, dev.device);
+      transaction.append(cmd);  // can throw
+      ComponentInstance* cmp = cmd->getComponentInstance();
+      for (const ComponentSymbolVariantItem& item :
+           cmp->getSymbolVariant().getSymbolItems()) {
+        // place the symbols in a grid of 5 columns on each schematic page
+        int page = symbolCount / mOptions.symbolsPerSchematic;
+        int cell = symbolCount % mOptions.symbolsPerSchematic;
+        while (page >= mSchematics.count()) {
+          Schematic* schematic = project.createSchematic(ElementName(
+              QString("Page %1").arg(mSchematics.count() + 1)));  // can throw
+          project.addSchematic(*schematic);  // can throw
+          mSchematics.append(schematic);
+        }
+        Point symbolPos = Point::fromMm(50.8 * (cell % 5), -50.8 * (cell / 5));
+        transaction.append(new CmdAddSymbolToSchematic(
+            mWorkspace, *mSchematics[page], *cmp, item.getUuid(),
+            symbolPos));  // can throw
+        ++symbolCount;
+      }
+      transaction.append(new CmdAddDeviceToBoard(mWorkspace, board, *cmp,
+                                                 dev.device, tl::nullopt,
+                                                 boardPos));  // can throw
+      transaction.commit();  // can throw
+      mSymbolCount = symbolCount;
+    } catch (const Exception& e) {
+      // the transaction is aborted automatically
+      qWarning() << "Failed to add device" << dev.device.toStr() << ":"
+                 << e.getMsg();
+      ++failedCount;
+    }
+  }
+  qInfo() << "Added" << (mOptions.components - failedCount) << "components,"
+          << failedCount << "failed.";
+}
+
+QList<NetSignal*> ProjectGenerator::addNets(Project&   project,
+                                            UndoStack& undoStack) {
+  // get all signals which are connected to any pin or pad
+  QList<ComponentSignalInstance*> signalInstances;
+  foreach (ComponentInstance* cmp,
+           project.getCircuit().getComponentInstances()) {
+    for (const ComponentSignal& signal : cmp->getLibComponent().getSignals()) {
+      ComponentSignalInstance* sig = cmp->getSignalInstance(signal.getUuid());
+      if (sig && (!sig->isNetSignalNameForced()) &&
+          (!sig->getRegisteredSymbolPins().isEmpty()) &&
+          (!sig->getRegisteredFootprintPads().isEmpty())) {
+        signalInstances.append(sig);
+      }
+    }
+  }
+  std::shuffle(signalInstances.begin(), signalInstances.end(),
+               mRandomGenerator);
+
+  // create the nets, each of them with at least two signals
+  int netCount = qMin(mOptions.nets, signalInstances.count() / 2);
+  NetClass*         netclass = project.getCircuit().getNetClasses().first();
+  QList<NetSignal*> netsignals;
+  UndoStackTransaction transaction(undoStack, tr("Add nets"));
+  for (int i = 0; i < netCount; ++i) {
+    CmdNetSignalAdd* cmd = new CmdNetSignalAdd(
+        project.getCircuit(), *netclass,
+        CircuitIdentifier(QString("N%1").arg(i + 1)));  // can throw
+    transaction.append(cmd);                            // can throw
+    netsignals.append(cmd->getNetSignal());
+  }
+  for (int i = 0; (i < signalInstances.count()) && (netCount > 0); ++i) {
+    transaction.append(new CmdCompSigInstSetNetSignal(
+        *signalInstances[i], netsignals[i % netCount]));  // can throw
+  }
+  transaction.commit();  // can throw
+  return netsignals;
+}
+
+void ProjectGenerator::drawSchematicNets(NetSignal& netsignal,
+                                         UndoStack& undoStack) {
+  // every pin gets a short net line with a net label
+  UndoStackTransaction transaction(undoStack, tr("Draw net"));
+  foreach (ComponentSignalInstance* sig, netsignal.getComponentSignals()) {
+    foreach (SI_SymbolPin* pin, sig->getRegisteredSymbolPins()) {
+      Schematic& schematic = pin->getSymbol().getSchematic();
+      CmdSchematicNetSegmentAdd* cmdAddSegment =
+          new CmdSchematicNetSegmentAdd(schematic, netsignal);
+      transaction.append(cmdAddSegment);  // can throw
+      SI_NetSegment* segment = cmdAddSegment->getNetSegment();
+      Q_ASSERT(segment);
+      Point position = pin->getPosition() + Point::fromMm(0, 2.54);
+      QScopedPointer<CmdSchematicNetSegmentAddElements> cmdAddElements(
+          new CmdSchematicNetSegmentAddElements(*segment));
+      SI_NetPoint* netpoint = cmdAddElements->addNetPoint(position);
+      cmdAddElements->addNetLine(*pin, *netpoint);
+      transaction.append(cmdAddElements.take());  // can throw
+      transaction.append(new CmdSchematicNetLabelAdd(
+          *segment, position, Angle::deg0()));  // can throw
+    }
+  }
+  transaction.commit();  // can throw
+}
+
+void ProjectGenerator::routeBoardNet(Board& board, NetSignal& netsignal,
+                                     GraphicsLayer& layer,
+                                     UndoStack&     undoStack) {
+  // every pad gets a fanout via, all vias are chained on the given layer
+  const PositiveLength viaSize(600000);
+  const PositiveLength drillDiameter(300000);
+  const PositiveLength traceWidth(200000);
+  GraphicsLayer* topLayer = board.getLayerStack().getLayer(
+      GraphicsLayer::sTopCopper);
+  GraphicsLayer* botLayer = board.getLayerStack().getLayer(
+      GraphicsLayer::sBotCopper);
+  Q_ASSERT(topLayer && botLayer);
+  UndoStackTransaction transaction(undoStack, tr("Route net"));
+  CmdBoardNetSegmentAdd* cmdAddSegment =
+      new CmdBoardNetSegmentAdd(board, netsignal);
+  transaction.append(cmdAddSegment);  // can throw
+  BI_NetSegment* segment = cmdAddSegment->getNetSegment();
+  Q_ASSERT(segment);
+  QScopedPointer<CmdBoardNetSegmentAddElements> cmdAddElements(
+      new CmdBoardNetSegmentAddElements(*segment));
+  BI_Via* previousVia = nullptr;
+  foreach (ComponentSignalInstance* sig, netsignal.getComponentSignals()) {
+    foreach (BI_FootprintPad* pad, sig->getRegisteredFootprintPads()) {
+      Point   position = pad->getPosition() + Point::fromMm(0, 1.5);
+      BI_Via* via      = cmdAddElements->addVia(position, BI_Via::Shape::Round,
+                                           viaSize, drillDiameter);
+      GraphicsLayer* padLayer =
+          pad->isOnLayer(GraphicsLayer::sTopCopper) ? topLayer : botLayer;
+      cmdAddElements->addNetLine(*pad, *via, *padLayer, traceWidth);
+      if (previousVia) {
+        cmdAddElements->addNetLine(*previousVia, *via, layer, traceWidth);
+      }
+      previousVia = via;
+    }
+  }
+  transaction.append(cmdAddElements.take());  // can throw
+  transaction.commit();                       // can throw
+}
+
+void ProjectGenerator::addPlanes(Board& board, UndoStack& undoStack,
+                                 const QList<NetSignal*>& netsignals) {
+  if (netsignals.isEmpty()) return;
+
+  // the planes cover the whole board, starting on the bottom layer
+  QList<GraphicsLayer*> layers  = getCopperLayers(board);
+  const Length          inset   = Length::fromMm(0.5);
+  Path                  outline = Path::rect(
+      Point(inset, inset),
+      Point(mBoardSize.getX() - inset, mBoardSize.getY() - inset));
+  UndoStackTransaction transaction(undoStack, tr("Add planes"));
+  for (int i = 0; i < mOptions.planes; ++i) {
+    GraphicsLayer* layer = layers[layers.count() - 1 - (i % layers.count())];
+    BI_Plane*      plane =
+        new BI_Plane(board, Uuid::createRandom(),
+                     GraphicsLayerName(layer->getName()),
+                     *netsignals[i % netsignals.count()], outline);
+    transaction.append(new CmdBoardPlaneAdd(*plane));  // can throw
+  }
+  transaction.commit();  // can throw
+}
+
+QList<GraphicsLayer*> ProjectGenerator::getCopperLayers(
+    const Board& board) const noexcept {
+  QList<GraphicsLayer*> layers;
+  layers.append(board.getLayerStack().getLayer(GraphicsLayer::sTopCopper));
+  for (int i = 1; i <= board.getLayerStack().getInnerLayerCount(); ++i) {
+    layers.append(board.getLayerStack().getLayer(
+        GraphicsLayer::getInnerLayerName(i)));
+  }
+  layers.append(board.getLayerStack().getLayer(GraphicsLayer::sBotCopper));
+  return layers;
+}
+
+int ProjectGenerator::random(int max) noexcept {
+  return std::uniform_int_distribution<int>(0, max)(mRandomGenerator);
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace projectgenerator
+}  // namespace librepcb
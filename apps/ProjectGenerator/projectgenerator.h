@@ -0,0 +1,145 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_PROJECTGENERATOR_PROJECTGENERATOR_H
+#define LIBREPCB_PROJECTGENERATOR_PROJECTGENERATOR_H
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <librepcb/common/fileio/filepath.h>
+#include <librepcb/common/units/all_length_units.h>
+#include <librepcb/common/uuid.h>
+
+#include <QtCore>
+
+#include <random>
+
+/*******************************************************************************
+ *  Namespace / Forward Declarations
+ ******************************************************************************/
+namespace librepcb {
+
+class GraphicsLayer;
+class UndoStack;
+
+namespace workspace {
+class Workspace;
+}
+
+namespace project {
+class Board;
+class ComponentInstance;
+class NetSignal;
+class Project;
+class Schematic;
+}  // namespace project
+
+namespace projectgenerator {
+
+/*******************************************************************************
+ *  Class ProjectGenerator
+ ******************************************************************************/
+
+/**
+ * @brief Generates synthetic projects of configurable size for scale testing
+ *
+ * The generated project contains randomly chosen devices of the workspace
+ * library, placed in a grid on several schematic pages and on one board.
+ * Component signals are randomly assigned to nets, which are connected with
+ * net labels in the schematics. On the board, a part of the nets is routed
+ * (every pad gets a fanout via, the vias are chained on a copper layer), the
+ * other nets are left as air wires.
+ *
+ * The placement and routing are valid in terms of the file format and the
+ * data model, i.e. the project can be opened, edited and exported like any
+ * other project. But they are not DRC clean (traces of different nets may
+ * cross), so the generated projects are only useful for performance
+ * measurements.
+ *
+ * With the same workspace library and seed, the generated project always has
+ * the same structure. Only the UUIDs are different.
+ */
+class ProjectGenerator final {
+  Q_DECLARE_TR_FUNCTIONS(ProjectGenerator)
+
+public:
+  // Types
+  struct Options {
+    int           components;           ///< Number of components
+    int           nets;                 ///< Number of nets (upper limit)
+    int           planes;               ///< Number of planes
+    int           layers;               ///< Number of copper layers (>=2)
+    int           routedPercent;        ///< Percentage of routed nets
+    int           symbolsPerSchematic;  ///< Number of symbols per page
+    std::uint32_t seed;                 ///< Seed of the random generator
+  };
+
+  // Constructors / Destructor
+  ProjectGenerator()                              = delete;
+  ProjectGenerator(const ProjectGenerator& other) = delete;
+  ProjectGenerator(workspace::Workspace& workspace,
+                   const Options&        options) noexcept;
+  ~ProjectGenerator() noexcept;
+
+  // General Methods
+  void generate(const FilePath& projectFile);
+
+  // Operator Overloadings
+  ProjectGenerator& operator=(const ProjectGenerator& rhs) = delete;
+
+private:  // Types
+  struct DeviceInfo {
+    Uuid device;
+    Uuid component;
+    Uuid symbolVariant;
+  };
+
+private:  // Methods
+  QList<DeviceInfo> getAvailableDevices() const;
+  void addComponents(project::Project& project, project::Board& board,
+                     UndoStack& undoStack, const QList<DeviceInfo>& devices);
+  QList<project::NetSignal*> addNets(project::Project& project,
+                                     UndoStack&        undoStack);
+  void drawSchematicNets(project::NetSignal& netsignal, UndoStack& undoStack);
+  void routeBoardNet(project::Board& board, project::NetSignal& netsignal,
+                     GraphicsLayer& layer, UndoStack& undoStack);
+  void addPlanes(project::Board& board, UndoStack& undoStack,
+                 const QList<project::NetSignal*>& netsignals);
+  QList<GraphicsLayer*> getCopperLayers(const project::Board& board) const
+      noexcept;
+  int random(int max) noexcept;
+
+private:  // Data
+  workspace::Workspace&      mWorkspace;
+  Options                    mOptions;
+  std::mt19937               mRandomGenerator;
+  QList<project::Schematic*> mSchematics;   ///< Created schematic pages
+  int                        mSymbolCount;  ///< Number of placed symbols
+  Point                      mBoardSize;
+};
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace projectgenerator
+}  // namespace librepcb
+
+#endif  // LIBREPCB_PROJECTGENERATOR_PROJECTGENERATOR_H
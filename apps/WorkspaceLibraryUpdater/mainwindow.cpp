@@ -2,10 +2,7 @@
 
 #include "ui_mainwindow.h"
 
-#include <librepcb/common/fileio/sexpression.h>
-#include <librepcb/common/fileio/transactionalfilesystem.h>
-#include <librepcb/library/elements.h>
-#include <librepcb/workspace/library/workspacelibrarydb.h>
+#include <librepcb/library/libraryupgrader.h>
 
 #include <QtCore>
 #include <QtWidgets>
@@ -83,63 +80,43 @@ void MainWindow::on_updateBtn_clicked() {
   if (ui->libDirs->count() == 0) return;
   ui->log->clear();
 
-  elementCount = 0;
-  ignoreCount  = 0;
-  errorCount   = 0;
+  QList<FilePath> libDirs;
   for (int i = 0; i < ui->libDirs->count(); i++) {
-    QString dirStr = ui->libDirs->item(i)->text();
-
-    try {
-      std::shared_ptr<TransactionalFileSystem> fs =
-          TransactionalFileSystem::openRW(FilePath(dirStr));
-      library::Library lib(std::unique_ptr<TransactionalDirectory>(
-          new TransactionalDirectory(fs)));
-
-      if (ui->cbx_cmpcat->isChecked())
-        updateElements<ComponentCategory>(fs, lib);
-      if (ui->cbx_pkgcat->isChecked()) updateElements<PackageCategory>(fs, lib);
-      if (ui->cbx_sym->isChecked()) updateElements<Symbol>(fs, lib);
-      if (ui->cbx_pkg->isChecked()) updateElements<Package>(fs, lib);
-      if (ui->cbx_cmp->isChecked()) updateElements<Component>(fs, lib);
-      if (ui->cbx_dev->isChecked()) updateElements<Device>(fs, lib);
-
-      if (ui->cbx_lplib->isChecked()) {
-        lib.save();
-        fs->save();
-        elementCount++;
-      }
-    } catch (Exception& e) {
-      ui->log->addItem("ERROR: " % e.getMsg());
-      errorCount++;
-    }
+    libDirs.append(FilePath(ui->libDirs->item(i)->text()));
   }
 
-  ui->log->addItem(QString("FINISHED: %1 updated, %2 ignored, %3 errors")
-                       .arg(elementCount)
-                       .arg(ignoreCount)
-                       .arg(errorCount));
-  ui->log->setCurrentRow(ui->log->count() - 1);
-}
-
-template <typename ElementType>
-void MainWindow::updateElements(std::shared_ptr<TransactionalFileSystem> fs,
-                                const library::Library& lib) noexcept {
-  foreach (const QString& path, lib.searchForElements<ElementType>()) {
-    if (path.contains("00000000-0000-4001-8000-000000000000")) {
-      // ignore demo files as they contain documentation which would be removed
-      ignoreCount++;
-      continue;
-    }
-    try {
-      ElementType element(std::unique_ptr<TransactionalDirectory>(
-          new TransactionalDirectory(fs, path)));
-      element.save();
-      fs->save();
-      ui->log->addItem(fs->getAbsPath(path).toNative());
-      elementCount++;
-    } catch (const Exception& e) {
-      ui->log->addItem("ERROR: " % e.getMsg());
-      errorCount++;
-    }
+  LibraryUpgrader::Elements elements;
+  if (ui->cbx_lplib->isChecked()) elements |= LibraryUpgrader::LIBRARY;
+  if (ui->cbx_cmpcat->isChecked())
+    elements |= LibraryUpgrader::COMPONENT_CATEGORIES;
+  if (ui->cbx_pkgcat->isChecked())
+    elements |= LibraryUpgrader::PACKAGE_CATEGORIES;
+  if (ui->cbx_sym->isChecked()) elements |= LibraryUpgrader::SYMBOLS;
+  if (ui->cbx_pkg->isChecked()) elements |= LibraryUpgrader::PACKAGES;
+  if (ui->cbx_cmp->isChecked()) elements |= LibraryUpgrader::COMPONENTS;
+  if (ui->cbx_dev->isChecked()) elements |= LibraryUpgrader::DEVICES;
+
+  QApplication::setOverrideCursor(Qt::WaitCursor);
+  LibraryUpgrader upgrader;
+  upgrader.setElements(elements);
+  LibraryUpgrader::Result result = upgrader.upgrade(libDirs);
+  QApplication::restoreOverrideCursor();
+
+  foreach (const FilePath& dir, result.upgraded) {
+    ui->log->addItem(dir.toNative());
   }
+  foreach (const QString& error, result.errors) {
+    ui->log->addItem("ERROR: " % error);
+  }
+  ui->log->addItem(
+      QString("FINISHED: %1 updated, %2 unchanged, %3 ignored, %4 errors "
+              "(%5 elements/s)")
+          .arg(result.upgraded.count())
+          .arg(result.unchanged)
+          .arg(result.ignored)
+          .arg(result.errors.count())
+          .arg(result.getProcessedCount() * 1000.0 /
+                   qMax(result.elapsedMs, qint64(1)),
+               0, 'f', 1));
+  ui->log->setCurrentRow(ui->log->count() - 1);
 }
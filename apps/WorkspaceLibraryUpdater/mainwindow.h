@@ -6,23 +6,10 @@
 #include <QtCore>
 #include <QtWidgets>
 
-#include <memory>
-
 namespace Ui {
 class MainWindow;
 }
 
-namespace librepcb {
-
-class DomElement;
-class TransactionalFileSystem;
-
-namespace library {
-class Library;
-}
-
-}  // namespace librepcb
-
 class MainWindow : public QMainWindow {
   Q_OBJECT
 
@@ -38,16 +25,9 @@ private slots:
   void on_updateBtn_clicked();
 
 private:
-  template <typename ElementType>
-  void updateElements(std::shared_ptr<librepcb::TransactionalFileSystem> fs,
-                      const librepcb::library::Library& lib) noexcept;
-
   // Attributes
   Ui::MainWindow* ui;
   QString         lastDir;
-  int             elementCount;
-  int             ignoreCount;
-  int             errorCount;
 };
 
 #endif  // MAINWINDOW_H
@@ -4,5 +4,6 @@ SUBDIRS = \
     librepcb \
     librepcb-cli \
     EagleImport \
+    ProjectGenerator \
     UuidGenerator \
     WorkspaceLibraryUpdater
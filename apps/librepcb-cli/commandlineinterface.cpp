@@ -27,16 +27,25 @@
 #include <librepcb/common/debug.h>
 #include <librepcb/common/fileio/fileutils.h>
 #include <librepcb/common/fileio/transactionalfilesystem.h>
+#include <librepcb/common/profiler.h>
+#include <librepcb/eagleimport/converterdb.h>
+#include <librepcb/eagleimport/libraryconverter.h>
 #include <librepcb/library/elements.h>
+#include <librepcb/library/libraryupgrader.h>
 #include <librepcb/project/boards/board.h>
 #include <librepcb/project/boards/boardfabricationoutputsettings.h>
 #include <librepcb/project/boards/boardgerberexport.h>
+#include <librepcb/project/boards/drc/boarddesignrulecheck.h>
 #include <librepcb/project/erc/ercmsg.h>
 #include <librepcb/project/erc/ercmsglist.h>
 #include <librepcb/project/project.h>
 
+#include <QtConcurrent/QtConcurrent>
 #include <QtCore>
 
+#include <algorithm>
+#include <thread>
+
 /*******************************************************************************
  *  Namespace
  ******************************************************************************/
@@ -46,6 +55,15 @@ namespace cli {
 using namespace librepcb::library;
 using namespace librepcb::project;
 
+/*******************************************************************************
+ *  Static Variables
+ ******************************************************************************/
+
+/// If set, print() and printErr() append their output to this list (the bool
+/// is true for stderr) instead of writing it immediately. Used to keep the
+/// output of projects processed in parallel together.
+static thread_local QList<QPair<QString, bool>>* sOutputBuffer = nullptr;
+
 /*******************************************************************************
  *  Constructors / Destructor
  ******************************************************************************/
@@ -66,6 +84,12 @@ int CommandLineInterface::execute() noexcept {
       {"open-library",
        {tr("Open a library to execute library-related tasks."),
         tr("open-library [command_options]")}},
+      {"upgrade-library",
+       {tr("Upgrade the file format of libraries by re-saving all elements."),
+        tr("upgrade-library [command_options]")}},
+      {"import-eagle-library",
+       {tr("Convert Eagle libraries (*.lbr) to LibrePCB library elements."),
+        tr("import-eagle-library [command_options]")}},
   };
 
   // Add global options
@@ -75,14 +99,36 @@ int CommandLineInterface::execute() noexcept {
   const QCommandLineOption versionOption = parser.addVersionOption();
   QCommandLineOption       verboseOption("verbose", tr("Verbose output."));
   parser.addOption(verboseOption);
+  QCommandLineOption profileOption(
+      "profile",
+      tr("Print wall time, CPU time, peak memory usage and number of "
+         "'operator new' calls of the executed phases."));
+  parser.addOption(profileOption);
+  QCommandLineOption profileJsonOption(
+      "profile-json",
+      tr("Like '--profile', but write the report as JSON to the given file."),
+      tr("file"));
+  parser.addOption(profileJsonOption);
   parser.addPositionalArgument("command", tr("The command to execute."));
 
+  // Define options shared by several commands
+  QCommandLineOption jobsOption(
+      "jobs",
+      tr("Maximum number of items (projects or library elements) to process "
+         "in parallel. If not set or 0, the number of CPU cores is used."),
+      tr("count"));
+
   // Define options for "open-project"
   QCommandLineOption ercOption(
       "erc",
       tr("Run the electrical rule check, print all non-approved "
          "warnings/errors and "
          "report failure (exit code = 1) if there are non-approved messages."));
+  QCommandLineOption drcOption(
+      "drc",
+      tr("Run the design rule check on the boards (see '--board'), print all "
+         "violations and report failure (exit code = 1) if there are "
+         "violations."));
   QCommandLineOption exportSchematicsOption(
       "export-schematics",
       QString(tr("Export schematics to given file(s). Existing files will be "
@@ -101,13 +147,19 @@ int CommandLineInterface::execute() noexcept {
          "will be used instead."),
       tr("file"));
   QCommandLineOption boardOption("board",
-                                 tr("The name of the board(s) to export. Can "
-                                    "be given multiple times. If not set, "
-                                    "all boards are exported."),
+                                 tr("The name of the board(s) to check or "
+                                    "export. Can be given multiple times. If "
+                                    "not set, all boards are processed."),
                                  tr("name"));
   QCommandLineOption saveOption(
       "save",
       tr("Save project before closing it (useful to upgrade file format)."));
+  QCommandLineOption projectsFileOption(
+      "projects-file",
+      tr("Read the paths of the projects to open from a file, one path per "
+         "line (relative paths are relative to that file). Empty lines and "
+         "lines starting with '#' are ignored."),
+      tr("file"));
 
   // Define options for "open-library"
   QCommandLineOption libAllOption(
@@ -116,6 +168,32 @@ int CommandLineInterface::execute() noexcept {
   QCommandLineOption libSaveOption(
       "save", tr("Save library (and contained elements if '--all' is given) "
                  "before closing them (useful to upgrade file format)."));
+  QCommandLineOption libCheckOption(
+      "check", tr("Run the library element checks, print all messages and "
+                  "report failure (exit code = 1) if there are messages."));
+  QCommandLineOption libCheckJsonOption(
+      "check-json",
+      tr("Like '--check', but also write the messages as JSON to the given "
+         "file."),
+      tr("file"));
+
+  // Define options for "import-eagle-library"
+  QCommandLineOption eagleOutputOption(
+      "output",
+      tr("Directory to write the converted library elements to (required)."),
+      tr("dir"));
+  QCommandLineOption eagleUuidDbOption(
+      "uuid-db",
+      tr("INI file mapping Eagle element names to UUIDs, to get the same "
+         "UUIDs when converting the same libraries again (default: "
+         "'eagle-import-uuids.ini' in the output directory)."),
+      tr("file"));
+  QCommandLineOption eagleSymbolsOption(
+      "symbols", tr("Convert symbols (if none of '--symbols', '--packages' "
+                    "and '--devices' is set, all of them are converted)."));
+  QCommandLineOption eaglePackagesOption("packages", tr("Convert packages."));
+  QCommandLineOption eagleDevicesOption(
+      "devices", tr("Convert device sets to components and devices."));
 
   // First parse to get the supplied command (ignoring errors because the parser
   // does not yet know the command-dependent options).
@@ -132,14 +210,18 @@ int CommandLineInterface::execute() noexcept {
     parser.clearPositionalArguments();
     parser.addPositionalArgument(command, commands[command].first,
                                  commands[command].second);
-    parser.addPositionalArgument("project",
-                                 tr("Path to project file (*.lpp[z])."));
+    parser.addPositionalArgument(
+        "project", tr("Path to project file(s) (*.lpp[z])."),
+        tr("project [project...]"));
     parser.addOption(ercOption);
+    parser.addOption(drcOption);
     parser.addOption(exportSchematicsOption);
     parser.addOption(exportPcbFabricationDataOption);
     parser.addOption(pcbFabricationSettingsOption);
     parser.addOption(boardOption);
     parser.addOption(saveOption);
+    parser.addOption(projectsFileOption);
+    parser.addOption(jobsOption);
   } else if (command == "open-library") {
     parser.clearPositionalArguments();
     parser.addPositionalArgument(command, commands[command].first,
@@ -147,7 +229,31 @@ int CommandLineInterface::execute() noexcept {
     parser.addPositionalArgument("library",
                                  tr("Path to library directory (*.lplib)."));
     parser.addOption(libAllOption);
+    parser.addOption(libCheckOption);
+    parser.addOption(libCheckJsonOption);
     parser.addOption(libSaveOption);
+    parser.addOption(jobsOption);
+  } else if (command == "upgrade-library") {
+    parser.clearPositionalArguments();
+    parser.addPositionalArgument(command, commands[command].first,
+                                 commands[command].second);
+    parser.addPositionalArgument(
+        "library", tr("Path to library directory (*.lplib)."),
+        tr("library [library...]"));
+    parser.addOption(jobsOption);
+  } else if (command == "import-eagle-library") {
+    parser.clearPositionalArguments();
+    parser.addPositionalArgument(command, commands[command].first,
+                                 commands[command].second);
+    parser.addPositionalArgument("library",
+                                 tr("Path to Eagle library file(s) (*.lbr)."),
+                                 tr("library [library...]"));
+    parser.addOption(eagleOutputOption);
+    parser.addOption(eagleUuidDbOption);
+    parser.addOption(eagleSymbolsOption);
+    parser.addOption(eaglePackagesOption);
+    parser.addOption(eagleDevicesOption);
+    parser.addOption(jobsOption);
   } else if (!command.isEmpty()) {
     printErr(QString(tr("Unknown command '%1'.")).arg(command), 2);
     print(parser.helpText(), 0);
@@ -190,36 +296,117 @@ int CommandLineInterface::execute() noexcept {
     Debug::instance()->setDebugLevelStderr(Debug::DebugLevel_t::All);
   }
 
+  // --profile, --profile-json
+  if (parser.isSet(profileOption) || parser.isSet(profileJsonOption)) {
+    Profiler::instance().setEnabled(true);
+  }
+
+  // --jobs (supported by all commands)
+  int jobs = parseJobsOption(parser, jobsOption);
+  if (jobs < 1) {
+    printErr(QString(tr("Invalid value for '--%1'.")).arg("jobs"), 2);
+    print(parser.helpText(), 0);
+    return 1;
+  }
+
   // Execute command
   bool cmdSuccess = false;
   if (command == "open-project") {
-    if (positionalArgs.count() != 1) {
+    QStringList projectFiles = positionalArgs;
+    if (parser.isSet(projectsFileOption)) {
+      try {
+        projectFiles += readManifest(parser.value(projectsFileOption));
+      } catch (const Exception& e) {
+        printErr(QString(tr("ERROR: %1")).arg(e.getMsg()));
+        return 1;
+      }
+    }
+    if (projectFiles.isEmpty()) {
       printErr(tr("Wrong argument count."), 2);
       print(parser.helpText(), 0);
       return 1;
     }
-    cmdSuccess = openProject(
-        positionalArgs.value(0),                       // project filepath
-        parser.isSet(ercOption),                       // run ERC
-        parser.values(exportSchematicsOption),         // export schematics
-        parser.isSet(exportPcbFabricationDataOption),  // export PCB fab. data
-        parser.value(pcbFabricationSettingsOption),    // PCB fab. settings
-        parser.values(boardOption),                    // boards
-        parser.isSet(saveOption)                       // save project
-    );
+    // Note: Evaluate the options here since the parser is not thread-safe.
+    bool        runErc         = parser.isSet(ercOption);
+    bool        runDrc         = parser.isSet(drcOption);
+    QStringList exportSchFiles = parser.values(exportSchematicsOption);
+    bool        exportPcbFab   = parser.isSet(exportPcbFabricationDataOption);
+    QString     pcbFabSettings = parser.value(pcbFabricationSettingsOption);
+    QStringList boards         = parser.values(boardOption);
+    bool        save           = parser.isSet(saveOption);
+    cmdSuccess                 = processInBatch(
+        projectFiles, jobs, [&](const QString& projectFile) {
+          return openProject(projectFile,     // project filepath
+                             runErc,          // run ERC
+                             runDrc,          // run DRC
+                             exportSchFiles,  // export schematics
+                             exportPcbFab,    // export PCB fab. data
+                             pcbFabSettings,  // PCB fab. settings
+                             boards,          // boards
+                             save             // save project
+          );
+        });
   } else if (command == "open-library") {
     if (positionalArgs.count() != 1) {
       printErr(tr("Wrong argument count."), 2);
       print(parser.helpText(), 0);
       return 1;
     }
-    cmdSuccess = openLibrary(positionalArgs.value(0),     // library directory
-                             parser.isSet(libAllOption),  // all elements
-                             parser.isSet(libSaveOption)  // save
+    bool runChecks =
+        parser.isSet(libCheckOption) || parser.isSet(libCheckJsonOption);
+    cmdSuccess = openLibrary(positionalArgs.value(0),  // library directory
+                             parser.isSet(libAllOption),        // all elements
+                             runChecks,                         // run checks
+                             parser.value(libCheckJsonOption),  // JSON report
+                             parser.isSet(libSaveOption),       // save
+                             jobs  // number of threads
+    );
+  } else if (command == "upgrade-library") {
+    if (positionalArgs.isEmpty()) {
+      printErr(tr("Wrong argument count."), 2);
+      print(parser.helpText(), 0);
+      return 1;
+    }
+    cmdSuccess = upgradeLibraries(positionalArgs, jobs);
+  } else if (command == "import-eagle-library") {
+    if (positionalArgs.isEmpty() || (!parser.isSet(eagleOutputOption))) {
+      printErr(tr("Wrong argument count."), 2);
+      print(parser.helpText(), 0);
+      return 1;
+    }
+    bool symbols  = parser.isSet(eagleSymbolsOption);
+    bool packages = parser.isSet(eaglePackagesOption);
+    bool devices  = parser.isSet(eagleDevicesOption);
+    if ((!symbols) && (!packages) && (!devices)) {
+      symbols = packages = devices = true;
+    }
+    cmdSuccess = importEagleLibraries(
+        positionalArgs,                   // Eagle library files
+        parser.value(eagleOutputOption),  // output directory
+        parser.value(eagleUuidDbOption),  // UUID database
+        symbols, packages, devices,       // element types
+        jobs                              // number of threads
     );
   } else {
     printErr(tr("Internal failure."));
   }
+
+  // Print/write profiling report
+  if (parser.isSet(profileOption)) {
+    print(tr("Profile:"));
+    print(Profiler::instance().toText());
+  }
+  if (parser.isSet(profileJsonOption)) {
+    try {
+      QString  fpStr = parser.value(profileJsonOption);
+      FilePath fp(QFileInfo(fpStr).absoluteFilePath());
+      FileUtils::writeFile(fp, Profiler::instance().toJson());  // can throw
+    } catch (const Exception& e) {
+      printErr(QString(tr("ERROR: %1")).arg(e.getMsg()));
+      cmdSuccess = false;
+    }
+  }
+
   if (cmdSuccess) {
     print(tr("SUCCESS"));
     return 0;
@@ -234,7 +421,7 @@ int CommandLineInterface::execute() noexcept {
  ******************************************************************************/
 
 bool CommandLineInterface::openProject(
-    const QString& projectFile, bool runErc,
+    const QString& projectFile, bool runErc, bool runDrc,
     const QStringList& exportSchematicsFiles, bool exportPcbFabricationData,
     const QString& pcbFabricationSettingsPath, const QStringList& boards,
     bool save) const noexcept {
@@ -242,7 +429,8 @@ bool CommandLineInterface::openProject(
     bool success = true;
 
     // Open project
-    FilePath projectFp(QFileInfo(projectFile).absoluteFilePath());
+    ProfilerScope openScope("Open project");
+    FilePath      projectFp(QFileInfo(projectFile).absoluteFilePath());
     print(QString(tr("Open project '%1'..."))
               .arg(prettyPath(projectFp, projectFile)));
     std::shared_ptr<TransactionalFileSystem> projectFs;
@@ -263,9 +451,11 @@ bool CommandLineInterface::openProject(
     Project project(std::unique_ptr<TransactionalDirectory>(
                         new TransactionalDirectory(projectFs)),
                     projectFileName);  // can throw
+    openScope.finish();
 
     // ERC
     if (runErc) {
+      LIBREPCB_PROFILE_SCOPE("Run ERC");
       print(tr("Run ERC..."));
       QStringList messages;
       int         approvedMsgCount = 0;
@@ -299,6 +489,47 @@ bool CommandLineInterface::openProject(
       }
     }
 
+    // Determine boards to check or export
+    QList<Board*> boardList;
+    if (boards.isEmpty()) {
+      // process all boards
+      boardList = project.getBoards();
+    } else if (runDrc || exportPcbFabricationData) {
+      // process specified boards
+      foreach (const QString& boardName, boards) {
+        Board* board = project.getBoardByName(boardName);
+        if (board) {
+          boardList.append(board);
+        } else {
+          printErr(QString(tr("ERROR: No board with the name '%1' found."))
+                       .arg(boardName));
+          success = false;
+        }
+      }
+    }
+
+    // DRC
+    if (runDrc) {
+      LIBREPCB_PROFILE_SCOPE("Run DRC");
+      print(tr("Run DRC..."));
+      foreach (const Board* board, boardList) {
+        BoardDesignRuleCheck drc(*board, BoardDesignRuleCheck::Options());
+        drc.execute();  // can throw
+        QStringList messages;
+        foreach (const BoardDesignRuleCheckMessage& msg, drc.getMessages()) {
+          messages.append("    - " % msg.getMessage());
+        }
+        print("  " % QString(tr("Board '%1': %2 violation(s)"))
+                         .arg(*board->getName())
+                         .arg(messages.count()));
+        qSort(messages);  // increases readability of console output
+        foreach (const QString& msg, messages) { printErr(msg); }
+        if (messages.count() > 0) {
+          success = false;
+        }
+      }
+    }
+
     // Export schematics
     foreach (const QString& destStr, exportSchematicsFiles) {
       print(QString(tr("Export schematics to '%1'...")).arg(destStr));
@@ -322,23 +553,6 @@ bool CommandLineInterface::openProject(
     // Export PCB fabrication data
     if (exportPcbFabricationData) {
       print(tr("Export PCB fabrication data..."));
-      QList<Board*> boardList;
-      if (boards.isEmpty()) {
-        // export all boards
-        boardList = project.getBoards();
-      } else {
-        // export specified boards
-        foreach (const QString& boardName, boards) {
-          Board* board = project.getBoardByName(boardName);
-          if (board) {
-            boardList.append(board);
-          } else {
-            printErr(QString(tr("ERROR: No board with the name '%1' found."))
-                         .arg(boardName));
-            success = false;
-          }
-        }
-      }
       tl::optional<BoardFabricationOutputSettings> customSettings;
       if (!pcbFabricationSettingsPath.isEmpty()) {
         try {
@@ -379,6 +593,7 @@ bool CommandLineInterface::openProject(
 
     // Save project
     if (save) {
+      LIBREPCB_PROFILE_SCOPE("Save project");
       print(tr("Save project..."));
       project.save();  // can throw
       if (projectFp.getSuffix() == "lppz") {
@@ -396,11 +611,15 @@ bool CommandLineInterface::openProject(
 }
 
 bool CommandLineInterface::openLibrary(const QString& libDir, bool all,
-                                       bool save) const noexcept {
+                                       bool           runChecks,
+                                       const QString& checksJsonFile, bool save,
+                                       int jobs) const noexcept {
   try {
-    bool success = true;
+    bool       success = true;
+    QJsonArray jsonElements;
 
     // Open library
+    LIBREPCB_PROFILE_SCOPE("Open library");
     FilePath libFp(QFileInfo(libDir).absoluteFilePath());
     print(QString(tr("Open library '%1'...")).arg(prettyPath(libFp, libDir)));
 
@@ -409,128 +628,250 @@ bool CommandLineInterface::openLibrary(const QString& libDir, bool all,
     Library lib(std::unique_ptr<TransactionalDirectory>(
         new TransactionalDirectory(libFs)));  // can throw
 
-    // Open all component categories
-    if (all) {
-      QStringList elements = lib.searchForElements<ComponentCategory>();
-      print(QString(tr("Process %1 component categories..."))
-                .arg(elements.count()));
-      foreach (const QString& dir, elements) {
-        FilePath fp = libFp.getPathTo(dir);
-        qInfo() << QString(tr("Open '%1'...")).arg(prettyPath(fp, libDir));
-        std::shared_ptr<TransactionalFileSystem> fs =
-            TransactionalFileSystem::open(fp, save);  // can throw
-        ComponentCategory element(std::unique_ptr<TransactionalDirectory>(
-            new TransactionalDirectory(fs)));  // can throw
-        if (save) {
-          qInfo() << QString(tr("Save '%1'...")).arg(prettyPath(fp, libDir));
-          element.save();  // can throw
-          fs->save();      // can throw
-        }
-      }
+    // Check library
+    if (runChecks) {
+      print(tr("Check library..."));
+      success &= reportLibraryElement(prettyPath(libFp, libDir),
+                                      lib.getShortElementName(),
+                                      lib.runChecks(),  // can throw
+                                      QString(), jsonElements);
     }
 
-    // Open all package categories
+    // Open all elements, each type processed by a pool of worker threads
     if (all) {
-      QStringList elements = lib.searchForElements<PackageCategory>();
-      print(QString(tr("Process %1 package categories..."))
-                .arg(elements.count()));
-      foreach (const QString& dir, elements) {
-        FilePath fp = libFp.getPathTo(dir);
-        qInfo() << QString(tr("Open '%1'...")).arg(prettyPath(fp, libDir));
-        std::shared_ptr<TransactionalFileSystem> fs =
-            TransactionalFileSystem::open(fp, save);  // can throw
-        PackageCategory element(std::unique_ptr<TransactionalDirectory>(
-            new TransactionalDirectory(fs)));  // can throw
-        if (save) {
-          qInfo() << QString(tr("Save '%1'...")).arg(prettyPath(fp, libDir));
-          element.save();  // can throw
-          fs->save();      // can throw
-        }
-      }
+      QThreadPool pool;
+      pool.setMaxThreadCount(jobs);
+      success &= openLibraryElements<ComponentCategory>(
+          lib, libFp, libDir, tr("Process %1 component categories..."),
+          runChecks, save, pool, jsonElements);
+      success &= openLibraryElements<PackageCategory>(
+          lib, libFp, libDir, tr("Process %1 package categories..."),
+          runChecks, save, pool, jsonElements);
+      success &= openLibraryElements<Symbol>(lib, libFp, libDir,
+                                             tr("Process %1 symbols..."),
+                                             runChecks, save, pool,
+                                             jsonElements);
+      success &= openLibraryElements<Package>(lib, libFp, libDir,
+                                              tr("Process %1 packages..."),
+                                              runChecks, save, pool,
+                                              jsonElements);
+      success &= openLibraryElements<Component>(lib, libFp, libDir,
+                                                tr("Process %1 components..."),
+                                                runChecks, save, pool,
+                                                jsonElements);
+      success &= openLibraryElements<Device>(lib, libFp, libDir,
+                                             tr("Process %1 devices..."),
+                                             runChecks, save, pool,
+                                             jsonElements);
     }
 
-    // Open all symbols
-    if (all) {
-      QStringList elements = lib.searchForElements<Symbol>();
-      print(QString(tr("Process %1 symbols...")).arg(elements.count()));
-      foreach (const QString& dir, elements) {
-        FilePath fp = libFp.getPathTo(dir);
-        qInfo() << QString(tr("Open '%1'...")).arg(prettyPath(fp, libDir));
-        std::shared_ptr<TransactionalFileSystem> fs =
-            TransactionalFileSystem::open(fp, save);  // can throw
-        Symbol element(std::unique_ptr<TransactionalDirectory>(
-            new TransactionalDirectory(fs)));  // can throw
-        if (save) {
-          qInfo() << QString(tr("Save '%1'...")).arg(prettyPath(fp, libDir));
-          element.save();  // can throw
-          fs->save();      // can throw
-        }
-      }
+    // Save library
+    if (save) {
+      print(QString(tr("Save library '%1'...")).arg(prettyPath(libFp, libDir)));
+      lib.save();     // can throw
+      libFs->save();  // can throw
     }
 
-    // Open all packages
-    if (all) {
-      QStringList elements = lib.searchForElements<Package>();
-      print(QString(tr("Process %1 packages...")).arg(elements.count()));
-      foreach (const QString& dir, elements) {
-        FilePath fp = libFp.getPathTo(dir);
-        qInfo() << QString(tr("Open '%1'...")).arg(prettyPath(fp, libDir));
-        std::shared_ptr<TransactionalFileSystem> fs =
-            TransactionalFileSystem::open(fp, save);  // can throw
-        Package element(std::unique_ptr<TransactionalDirectory>(
-            new TransactionalDirectory(fs)));  // can throw
-        if (save) {
-          qInfo() << QString(tr("Save '%1'...")).arg(prettyPath(fp, libDir));
-          element.save();  // can throw
-          fs->save();      // can throw
-        }
-      }
+    // Write check messages
+    if (!checksJsonFile.isEmpty()) {
+      QJsonObject root;
+      root["library"]  = prettyPath(libFp, libDir);
+      root["elements"] = jsonElements;
+      QByteArray json = QJsonDocument(root).toJson(QJsonDocument::Indented);
+      FilePath   fp(QFileInfo(checksJsonFile).absoluteFilePath());
+      FileUtils::writeFile(fp, json);  // can throw
     }
 
-    // Open all components
-    if (all) {
-      QStringList elements = lib.searchForElements<Component>();
-      print(QString(tr("Process %1 components...")).arg(elements.count()));
-      foreach (const QString& dir, elements) {
-        FilePath fp = libFp.getPathTo(dir);
-        qInfo() << QString(tr("Open '%1'...")).arg(prettyPath(fp, libDir));
+    return success;
+  } catch (const Exception& e) {
+    printErr(QString(tr("ERROR: %1")).arg(e.getMsg()));
+    return false;
+  }
+}
+
+template <typename ElementType>
+bool CommandLineInterface::openLibraryElements(
+    const Library& lib, const FilePath& libFp, const QString& libDir,
+    const QString& title, bool runChecks, bool save, QThreadPool& pool,
+    QJsonArray& jsonElements) const noexcept {
+  struct ElementResult {
+    LibraryElementCheckMessageList messages;
+    QString                        error;
+  };
+
+  // Start processing all elements. Every element gets its own file system, so
+  // the worker threads don't share any state.
+  QStringList elements = lib.searchForElements<ElementType>();
+  print(title.arg(elements.count()));
+  QList<QFuture<ElementResult>> futures;
+  foreach (const QString& dir, elements) {
+    FilePath fp  = libFp.getPathTo(dir);
+    auto     job = [fp, runChecks, save]() {
+      ElementResult result;
+      try {
         std::shared_ptr<TransactionalFileSystem> fs =
             TransactionalFileSystem::open(fp, save);  // can throw
-        Component element(std::unique_ptr<TransactionalDirectory>(
+        ElementType element(std::unique_ptr<TransactionalDirectory>(
             new TransactionalDirectory(fs)));  // can throw
+        if (runChecks) {
+          result.messages = element.runChecks();  // can throw
+        }
         if (save) {
-          qInfo() << QString(tr("Save '%1'...")).arg(prettyPath(fp, libDir));
           element.save();  // can throw
           fs->save();      // can throw
         }
+      } catch (const Exception& e) {
+        result.error = e.getMsg();
       }
+      return result;
+    };
+    futures.append(QtConcurrent::run(&pool, job));
+  }
+
+  // Report the results in the original order to get a deterministic output
+  bool success = true;
+  for (int i = 0; i < elements.count(); ++i) {
+    ElementResult result = futures.at(i).result();
+    QString       path   = prettyPath(libFp.getPathTo(elements.at(i)), libDir);
+    qInfo() << QString(tr("Processed '%1'.")).arg(path);
+    success &= reportLibraryElement(path, ElementType::getShortElementName(),
+                                    result.messages, result.error,
+                                    jsonElements);
+  }
+  return success;
+}
+
+bool CommandLineInterface::reportLibraryElement(
+    const QString& path, const QString& type,
+    LibraryElementCheckMessageList messages, const QString& error,
+    QJsonArray& jsonElements) noexcept {
+  // most severe messages first, to make the output independent of the order
+  // the checks are executed
+  std::sort(messages.begin(), messages.end(),
+            [](const std::shared_ptr<const LibraryElementCheckMessage>& a,
+               const std::shared_ptr<const LibraryElementCheckMessage>& b) {
+              return *b < *a;
+            });
+
+  QJsonArray jsonMessages;
+  foreach (const auto& msg, messages) {
+    QString severity;
+    switch (msg->getSeverity()) {
+      case LibraryElementCheckMessage::Severity::Hint:
+        severity = "hint";
+        break;
+      case LibraryElementCheckMessage::Severity::Warning:
+        severity = "warning";
+        break;
+      default:
+        severity = "error";
+        break;
     }
+    printErr(QString("    - [%1] %2: %3")
+                 .arg(severity.toUpper(), path, msg->getMessage()));
+    QJsonObject obj;
+    obj["severity"]    = severity;
+    obj["message"]     = msg->getMessage();
+    obj["description"] = msg->getDescription();
+    jsonMessages.append(obj);
+  }
+  if (!error.isEmpty()) {
+    printErr("  " % QString(tr("ERROR: %1")).arg(error));
+  }
 
-    // Open all devices
-    if (all) {
-      QStringList elements = lib.searchForElements<Device>();
-      print(QString(tr("Process %1 devices...")).arg(elements.count()));
-      foreach (const QString& dir, elements) {
-        FilePath fp = libFp.getPathTo(dir);
-        qInfo() << QString(tr("Open '%1'...")).arg(prettyPath(fp, libDir));
-        std::shared_ptr<TransactionalFileSystem> fs =
-            TransactionalFileSystem::open(fp, save);  // can throw
-        Device element(std::unique_ptr<TransactionalDirectory>(
-            new TransactionalDirectory(fs)));  // can throw
-        if (save) {
-          qInfo() << QString(tr("Save '%1'...")).arg(prettyPath(fp, libDir));
-          element.save();  // can throw
-          fs->save();      // can throw
-        }
-      }
+  QJsonObject obj;
+  obj["path"]     = path;
+  obj["type"]     = type;
+  obj["messages"] = jsonMessages;
+  obj["error"]    = error.isEmpty() ? QJsonValue() : QJsonValue(error);
+  jsonElements.append(obj);
+  return messages.isEmpty() && error.isEmpty();
+}
+
+bool CommandLineInterface::upgradeLibraries(const QStringList& libDirs,
+                                            int jobs) const noexcept {
+  LIBREPCB_PROFILE_SCOPE("Upgrade libraries");
+  QList<FilePath> dirs;
+  foreach (const QString& dir, libDirs) {
+    FilePath fp(QFileInfo(dir).absoluteFilePath());
+    print(QString(tr("Upgrade library '%1'...")).arg(prettyPath(fp, dir)));
+    dirs.append(fp);
+  }
+
+  LibraryUpgrader upgrader;
+  upgrader.setMaxThreadCount(jobs);
+  LibraryUpgrader::Result result = upgrader.upgrade(dirs);
+  foreach (const FilePath& dir, result.upgraded) {
+    qInfo() << QString(tr("Upgraded '%1'.")).arg(dir.toNative());
+  }
+  foreach (const QString& error, result.errors) {
+    printErr("  " % QString(tr("ERROR: %1")).arg(error));
+  }
+  qreal seconds = qMax(result.elapsedMs, qint64(1)) / 1000.0;
+  print("  " % QString(tr("Upgraded: %1, unchanged: %2, ignored: %3, "
+                          "failed: %4"))
+                   .arg(result.upgraded.count())
+                   .arg(result.unchanged)
+                   .arg(result.ignored)
+                   .arg(result.errors.count()));
+  print("  " % QString(tr("Processed %1 elements in %2 s (%3 elements/s)."))
+                   .arg(result.getProcessedCount())
+                   .arg(seconds, 0, 'f', 1)
+                   .arg(result.getProcessedCount() / seconds, 0, 'f', 1));
+  return result.errors.isEmpty();
+}
+
+bool CommandLineInterface::importEagleLibraries(
+    const QStringList& libFiles, const QString& outputDir,
+    const QString& uuidDbFile, bool symbols, bool packages, bool devices,
+    int jobs) const noexcept {
+  try {
+    bool success = true;
+
+    LIBREPCB_PROFILE_SCOPE("Import Eagle libraries");
+    FilePath outputFp(QFileInfo(outputDir).absoluteFilePath());
+    FilePath dbFp = uuidDbFile.isEmpty()
+                        ? outputFp.getPathTo("eagle-import-uuids.ini")
+                        : FilePath(QFileInfo(uuidDbFile).absoluteFilePath());
+    QList<FilePath> files;
+    foreach (const QString& file, libFiles) {
+      files.append(FilePath(QFileInfo(file).absoluteFilePath()));
     }
+    FileUtils::makePath(outputFp);  // can throw
 
-    // Save library
-    if (save) {
-      print(QString(tr("Save library '%1'...")).arg(prettyPath(libFp, libDir)));
-      lib.save();     // can throw
-      libFs->save();  // can throw
+    eagleimport::ConverterDb      db(dbFp);
+    eagleimport::LibraryConverter converter(db, outputFp);
+    converter.setMaxThreadCount(jobs);
+    typedef eagleimport::LibraryConverter::ElementType ElementType;
+    QList<QPair<ElementType, QString>>                 steps;
+    if (symbols) {
+      steps.append(qMakePair(ElementType::Symbols,
+                             tr("Convert symbols of %1 file(s)...")));
+    }
+    if (packages) {
+      steps.append(qMakePair(ElementType::Packages,
+                             tr("Convert packages of %1 file(s)...")));
     }
+    if (devices) {
+      steps.append(qMakePair(ElementType::Devices,
+                             tr("Convert devices of %1 file(s)...")));
+    }
+    for (const auto& step : steps) {
+      print(step.second.arg(files.count()));
+      eagleimport::LibraryConverter::Result result =
+          converter.convert(step.first, files);
+      print("  " % QString(tr("Converted %1 of %2 elements."))
+                       .arg(result.convertedElements)
+                       .arg(result.readElements));
+      foreach (const QString& error, result.errors) {
+        printErr("  " % QString(tr("ERROR: %1")).arg(error));
+        success = false;
+      }
+    }
+
+    print(QString(tr("Save UUID database '%1'..."))
+              .arg(prettyPath(dbFp, uuidDbFile)));
+    db.save();  // can throw
 
     return success;
   } catch (const Exception& e) {
@@ -539,6 +880,132 @@ bool CommandLineInterface::openLibrary(const QString& libDir, bool all,
   }
 }
 
+bool CommandLineInterface::processInBatch(
+    const QStringList& files, int jobs,
+    const std::function<bool(const QString&)>& func) const noexcept {
+  // a single file is processed directly without any overhead
+  if (files.count() == 1) {
+    return func(files.first());
+  }
+
+  QStringList failedFiles;
+  if (jobs > 1) {
+    failedFiles = processInThreads(files, jobs, func);
+  } else {
+    // process the files one after the other in the main thread, exactly the
+    // same way as a single file
+    foreach (const QString& file, files) {
+      if (!func(file)) {
+        failedFiles.append(file);
+      }
+    }
+  }
+
+  // print summary
+  print(QString(tr("Processed %1 files, %2 failed."))
+            .arg(files.count())
+            .arg(failedFiles.count()));
+  foreach (const QString& file, failedFiles) {
+    printErr("  " % QString(tr("FAILED: %1")).arg(file));
+  }
+  return failedFiles.isEmpty();
+}
+
+QStringList CommandLineInterface::processInThreads(
+    const QStringList& files, int jobs,
+    const std::function<bool(const QString&)>& func) const noexcept {
+  struct Result {
+    bool                        finished;
+    bool                        success;
+    QList<QPair<QString, bool>> output;
+  };
+  std::vector<Result> results(files.count(), Result{false, false, {}});
+  int                 nextIndex = 0;
+  QMutex              mutex;
+  QWaitCondition      resultAvailable;
+
+  // Start worker threads which process one file after the other. Since they
+  // all use the same Application instance, shared resources like the stroke
+  // fonts are loaded only once for all files. Note that the worker threads
+  // are neither the GUI thread nor do they have an event loop, thus the
+  // project classes skip rendering icons and execute deferred updates on
+  // demand in this case.
+  std::vector<std::thread> workers;
+  for (int i = 0; i < qMin(jobs, files.count()); ++i) {
+    workers.emplace_back([&]() {
+      forever {
+        int index;
+        {
+          QMutexLocker lock(&mutex);
+          if (nextIndex >= files.count()) break;
+          index = nextIndex++;
+        }
+        QList<QPair<QString, bool>> output;
+        sOutputBuffer = &output;
+        bool success  = func(files.at(index));
+        sOutputBuffer = nullptr;
+        QMutexLocker lock(&mutex);
+        results[index] = Result{true, success, output};
+        resultAvailable.wakeAll();
+      }
+    });
+  }
+
+  // print the output in the original order as soon as it is available
+  QStringList failedFiles;
+  for (int i = 0; i < files.count(); ++i) {
+    Result result;
+    {
+      QMutexLocker lock(&mutex);
+      while (!results[i].finished) {
+        resultAvailable.wait(&mutex);
+      }
+      result = results[i];
+    }
+    foreach (const auto& line, result.output) {
+      if (line.second) {
+        printErr(line.first, 0);
+      } else {
+        print(line.first, 0);
+      }
+    }
+    if (!result.success) {
+      failedFiles.append(files.at(i));
+    }
+  }
+  for (std::thread& worker : workers) {
+    worker.join();
+  }
+  return failedFiles;
+}
+
+QStringList CommandLineInterface::readManifest(const QString& manifestFile) {
+  FilePath    fp(QFileInfo(manifestFile).absoluteFilePath());
+  QStringList files;
+  foreach (QString line, QString(FileUtils::readFile(fp)).split('\n')) {
+    line = line.trimmed();
+    if (line.isEmpty() || line.startsWith('#')) continue;
+    files.append(QFileInfo(line).isAbsolute()
+                     ? line
+                     : fp.getParentDir().getPathTo(line).toStr());
+  }
+  return files;
+}
+
+int CommandLineInterface::parseJobsOption(
+    const QCommandLineParser& parser,
+    const QCommandLineOption& option) noexcept {
+  int jobs = 0;  // 0 = number of CPU cores
+  if (parser.isSet(option)) {
+    bool valid = false;
+    jobs       = parser.value(option).toInt(&valid);
+    if ((!valid) || (jobs < 0)) {
+      return -1;
+    }
+  }
+  return (jobs > 0) ? jobs : qMax(QThread::idealThreadCount(), 1);
+}
+
 QString CommandLineInterface::prettyPath(const FilePath& path,
                                          const QString&  style) noexcept {
   if (QFileInfo(style).isAbsolute()) {
@@ -551,6 +1018,10 @@ QString CommandLineInterface::prettyPath(const FilePath& path,
 }
 
 void CommandLineInterface::print(const QString& str, int newlines) noexcept {
+  if (sOutputBuffer) {
+    sOutputBuffer->append(qMakePair(str % QString(newlines, '\n'), false));
+    return;
+  }
   QTextStream s(stdout);
   s << str;
   for (int i = 0; i < newlines; ++i) {
@@ -559,6 +1030,10 @@ void CommandLineInterface::print(const QString& str, int newlines) noexcept {
 }
 
 void CommandLineInterface::printErr(const QString& str, int newlines) noexcept {
+  if (sOutputBuffer) {
+    sOutputBuffer->append(qMakePair(str % QString(newlines, '\n'), true));
+    return;
+  }
   QTextStream s(stderr);
   s << str;
   for (int i = 0; i < newlines; ++i) {
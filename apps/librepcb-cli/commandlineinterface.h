@@ -25,6 +25,9 @@
  ******************************************************************************/
 #include <QtCore>
 
+#include <functional>
+#include <memory>
+
 /*******************************************************************************
  *  Namespace / Forward Declarations
  ******************************************************************************/
@@ -33,6 +36,11 @@ namespace librepcb {
 class Application;
 class FilePath;
 
+namespace library {
+class Library;
+class LibraryElementCheckMessage;
+}  // namespace library
+
 namespace cli {
 
 /*******************************************************************************
@@ -56,11 +64,49 @@ public:
 
 private:  // Methods
   bool           openProject(const QString& projectFile, bool runErc,
+                             bool               runDrc,
                              const QStringList& exportSchematicsFiles,
                              bool               exportPcbFabricationData,
                              const QString&     pcbFabricationSettingsPath,
                              const QStringList& boards, bool save) const noexcept;
-  bool openLibrary(const QString& libDir, bool all, bool save) const noexcept;
+  bool openLibrary(const QString& libDir, bool all, bool runChecks,
+                   const QString& checksJsonFile, bool save, int jobs) const
+      noexcept;
+  template <typename ElementType>
+  bool openLibraryElements(const library::Library& lib, const FilePath& libFp,
+                           const QString& libDir, const QString& title,
+                           bool runChecks, bool save, QThreadPool& pool,
+                           QJsonArray& jsonElements) const noexcept;
+  static bool reportLibraryElement(
+      const QString& path, const QString& type,
+      QVector<std::shared_ptr<const library::LibraryElementCheckMessage>>
+                     messages,
+      const QString& error, QJsonArray& jsonElements) noexcept;
+  bool upgradeLibraries(const QStringList& libDirs, int jobs) const noexcept;
+  bool importEagleLibraries(const QStringList& libFiles,
+                            const QString& outputDir, const QString& uuidDbFile,
+                            bool symbols, bool packages, bool devices,
+                            int jobs) const noexcept;
+  bool processInBatch(const QStringList& files, int jobs,
+                      const std::function<bool(const QString&)>& func) const
+      noexcept;
+  QStringList processInThreads(
+      const QStringList& files, int jobs,
+      const std::function<bool(const QString&)>& func) const noexcept;
+  static QStringList readManifest(const QString& manifestFile);
+
+  /**
+   * @brief Get the value of the "--jobs" option, used by all commands
+   *
+   * @param parser  The command line parser (already parsed).
+   * @param option  The "--jobs" option.
+   *
+   * @return The number of parallel jobs (>= 1), i.e. the given value or the
+   *         number of CPU cores if the option was not set or is 0. Returns -1
+   *         if the given value is invalid.
+   */
+  static int parseJobsOption(const QCommandLineParser& parser,
+                             const QCommandLineOption& option) noexcept;
   static QString prettyPath(const FilePath& path,
                             const QString&  style) noexcept;
   static void    print(const QString& str, int newlines = 1) noexcept;
@@ -10,7 +10,7 @@ TARGET = librepcb-cli
 # Use common project definitions
 include(../../common.pri)
 
-QT += core widgets opengl network xml printsupport sql
+QT += core widgets opengl network xml printsupport sql concurrent
 
 CONFIG += console
 
@@ -28,14 +28,17 @@ LIBS += \
     -llibrepcblibraryeditor \
     -llibrepcbworkspace \
     -llibrepcbproject \
+    -llibrepcbeagleimport \
     -llibrepcblibrary \
     -llibrepcbcommon \
+    -lparseagle \
     -lsexpresso \
     -lclipper \
     -lquazip -lz
 
 INCLUDEPATH += \
     ../../libs \
+    ../../libs/parseagle \
     ../../libs/quazip \
     ../../libs/type_safe/include \
     ../../libs/type_safe/external/debug_assert \
@@ -47,8 +50,10 @@ DEPENDPATH += \
     ../../libs/librepcb/libraryeditor \
     ../../libs/librepcb/workspace \
     ../../libs/librepcb/project \
+    ../../libs/librepcb/eagleimport \
     ../../libs/librepcb/library \
     ../../libs/librepcb/common \
+    ../../libs/parseagle \
     ../../libs/quazip \
     ../../libs/sexpresso \
     ../../libs/clipper \
@@ -60,8 +65,10 @@ PRE_TARGETDEPS += \
     $${DESTDIR}/liblibrepcblibraryeditor.a \
     $${DESTDIR}/liblibrepcbworkspace.a \
     $${DESTDIR}/liblibrepcbproject.a \
+    $${DESTDIR}/liblibrepcbeagleimport.a \
     $${DESTDIR}/liblibrepcblibrary.a \
     $${DESTDIR}/liblibrepcbcommon.a \
+    $${DESTDIR}/libparseagle.a \
     $${DESTDIR}/libquazip.a \
     $${DESTDIR}/libsexpresso.a \
     $${DESTDIR}/libclipper.a \
@@ -24,11 +24,15 @@
 
 #include <librepcb/common/application.h>
 #include <librepcb/common/debug.h>
+#include <librepcb/common/profiler.h>
 
 #include <QTranslator>
 #include <QtCore>
 #include <QtWidgets>
 
+#include <cstdlib>
+#include <new>
+
 /*******************************************************************************
  *  Namespace
  ******************************************************************************/
@@ -41,6 +45,26 @@ using namespace librepcb;
 static void setApplicationMetadata() noexcept;
 static void installTranslations() noexcept;
 
+/*******************************************************************************
+ *  Global Allocation Functions
+ ******************************************************************************/
+
+// Replaced to count calls of operator new for the "--profile" report. The
+// array and sized variants of these operators forward to them by default.
+// Note that allocations done with malloc() directly (e.g. by Qt containers)
+// are not counted, thus the count is only an indicator of allocation churn.
+void* operator new(std::size_t size) {
+  Profiler::countAllocation();
+  if (void* ptr = std::malloc(size ? size : 1)) {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept {
+  std::free(ptr);
+}
+
 /*******************************************************************************
  *  main()
  ******************************************************************************/
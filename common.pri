@@ -44,5 +44,10 @@ CONFIG += warn_on
 QMAKE_CXXFLAGS += -Wextra
 QMAKE_CXXFLAGS_DEBUG += -Wextra
 
+# optionally compile without profiling instrumentation (see profiler.h)
+no_profiling {
+    DEFINES += LIBREPCB_NO_PROFILING
+}
+
 # QuaZIP: use as static library
 DEFINES += QUAZIP_STATIC
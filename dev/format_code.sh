@@ -51,7 +51,7 @@ fi
 
 COUNTER=0
 
-for dir in apps/ libs/librepcb/ tests/unittests/
+for dir in apps/ libs/librepcb/ tests/benchmarks/ tests/unittests/
 do
   if [ "$ALL" == "--all" ]; then
     TRACKED=$(git ls-files -- "${dir}**.cpp" "${dir}**.hpp" "${dir}**.h")
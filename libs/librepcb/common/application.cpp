@@ -25,6 +25,7 @@
 #include "dialogs/aboutdialog.h"
 #include "fileio/transactionalfilesystem.h"
 #include "font/strokefontpool.h"
+#include "tracer.h"
 #include "units/all_length_units.h"
 
 #include <QtCore>
@@ -73,6 +74,9 @@ Application::Application(int& argc, char** argv) noexcept
     mGitRevision(GIT_COMMIT_SHA),
     mFileFormatVersion(Version::fromString(FILE_FORMAT_VERSION)),
     mIsFileFormatStable(FILE_FORMAT_STABLE) {
+  // start recording trace events if requested by environment variable
+  Tracer::startFromEnvironment();
+
   // register meta types
   qRegisterMetaType<FilePath>();
   qRegisterMetaType<Point>();
@@ -166,6 +170,7 @@ Application::Application(int& argc, char** argv) noexcept
 }
 
 Application::~Application() noexcept {
+  Tracer::stop();  // write recorded trace events, if any
 }
 
 /*******************************************************************************
@@ -25,6 +25,7 @@
 #include "../fileio/fileutils.h"
 #include "../geometry/circle.h"
 #include "../geometry/path.h"
+#include "../profiler.h"
 #include "../toolbox.h"
 #include "gerberaperturelist.h"
 
@@ -200,6 +201,7 @@ void GerberGenerator::reset() noexcept {
 }
 
 void GerberGenerator::generate() {
+  LIBREPCB_PROFILE_SCOPE("Generate Gerber file");
   mOutput.clear();
   printHeader();
   printApertureList();
@@ -65,7 +65,9 @@ SOURCES += \
     fileio/transactionaldirectory.cpp \
     fileio/transactionalfilesystem.cpp \
     fileio/versionfile.cpp \
+    fileio/zipstreamextractor.cpp \
     font/strokefont.cpp \
+    font/strokefontcache.cpp \
     font/strokefontpool.cpp \
     geometry/circle.cpp \
     geometry/cmd/cmdcircleedit.cpp \
@@ -99,10 +101,12 @@ SOURCES += \
     network/networkrequest.cpp \
     network/networkrequestbase.cpp \
     network/repository.cpp \
+    profiler.cpp \
     signalrole.cpp \
     sqlitedatabase.cpp \
     systeminfo.cpp \
     toolbox.cpp \
+    tracer.cpp \
     undocommand.cpp \
     undocommandgroup.cpp \
     undostack.cpp \
@@ -114,6 +118,7 @@ SOURCES += \
     utils/clipperhelpers.cpp \
     utils/exclusiveactiongroup.cpp \
     utils/graphicslayerstackappearancesettings.cpp \
+    utils/spatialindex.cpp \
     utils/toolbarproxy.cpp \
     utils/undostackactiongroup.cpp \
     uuid.cpp \
@@ -178,7 +183,9 @@ HEADERS += \
     fileio/transactionaldirectory.h \
     fileio/transactionalfilesystem.h \
     fileio/versionfile.h \
+    fileio/zipstreamextractor.h \
     font/strokefont.h \
+    font/strokefontcache.h \
     font/strokefontpool.h \
     geometry/circle.h \
     geometry/cmd/cmdcircleedit.h \
@@ -214,6 +221,7 @@ HEADERS += \
     network/networkrequest.h \
     network/networkrequestbase.h \
     network/repository.h \
+    profiler.h \
     scopeguard.h \
     scopeguardlist.h \
     signalrole.h \
@@ -221,6 +229,7 @@ HEADERS += \
     sqlitedatabase.h \
     systeminfo.h \
     toolbox.h \
+    tracer.h \
     undocommand.h \
     undocommandgroup.h \
     undostack.h \
@@ -233,6 +242,7 @@ HEADERS += \
     utils/clipperhelpers.h \
     utils/exclusiveactiongroup.h \
     utils/graphicslayerstackappearancesettings.h \
+    utils/spatialindex.h \
     utils/toolbarproxy.h \
     utils/undostackactiongroup.h \
     uuid.h \
@@ -54,6 +54,13 @@ public:
       mIndex(-1) {}
   ~CmdListElementRemove() noexcept {}
 
+  // Inherited from UndoCommand
+  qint64 getMemoryUsage() const noexcept override {
+    // the removed element is kept alive by this command until it gets deleted
+    return UndoCommand::getMemoryUsage() + sizeof(*this) -
+           sizeof(UndoCommand) + (mMemorizedElement ? sizeof(T) : 0);
+  }
+
   // Operator Overloadings
   CmdListElementRemove& operator=(const CmdListElementRemove& rhs) = delete;
 
@@ -55,7 +55,12 @@ namespace librepcb {
  *   `T`).
  * - Method #sortedByUuid() to create a copy of the list with elements sorted by
  *   UUID.
- * - Signals to get notified about added, removed and modified elements.
+ * - Lookups by pointer and by UUID in constant time (see @ref
+ *   serializableobjectlist_index "below").
+ * - Signals to get notified about added, removed and modified elements. Bulk
+ *   operations like #clear(), #loadFromSExpression() and assignments are
+ *   wrapped into a librepcb::SignalBatch, so coalescing slots get notified
+ *   only once.
  * - Undo commands librepcb::CmdListElementInsert,
  *   librepcb::CmdListElementRemove and ibrepcb::CmdListElementsSwap.
  * - Const correctness: A const list always returns pointers/references to const
@@ -85,6 +90,18 @@ namespace librepcb {
  * same address over the whole lifetime. To still minimize the risk of memory
  * leaks, `std::shared_ptr` is used instead of raw pointers.
  *
+ * @anchor serializableobjectlist_index
+ * @note    Lookups by pointer and by UUID (#indexOf(), #contains(), #find(),
+ * #get() etc.) are backed by hash indices which are built lazily on the first
+ * lookup. Inserting or removing elements only invalidates the index entries
+ * from the modified position up to the end of the list, so appending elements
+ * and querying them in a loop stays cheap. The UUID index relies on the UUID of
+ * an element never being changed while it is part of the list (UUIDs are part
+ * of the "interface" of elements, so they must not be changed anyway). Since
+ * building the indices modifies the list internally, it is protected by a
+ * mutex, so concurrent const lookups from multiple threads are still safe (as
+ * long as the list is not modified at the same time).
+ *
  * @warning Using Qt's `foreach` keyword on a #SerializableObjectList is not
  * recommended because it always creates a deep copy of the list! You should use
  * range based for loops (since C++11) instead.
@@ -142,13 +159,17 @@ public:
     : onEdited(*this),
       onElementEdited(*this),
       mOnEditedSlot(*this, &SerializableObjectList<
-                               T, P, OnEditedArgs...>::elementEditedHandler) {}
+                               T, P, OnEditedArgs...>::elementEditedHandler),
+      mPointerIndexCount(0),
+      mUuidIndexCount(0) {}
   SerializableObjectList(
       const SerializableObjectList<T, P, OnEditedArgs...>& other) noexcept
     : onEdited(*this),
       onElementEdited(*this),
       mOnEditedSlot(*this, &SerializableObjectList<
-                               T, P, OnEditedArgs...>::elementEditedHandler) {
+                               T, P, OnEditedArgs...>::elementEditedHandler),
+      mPointerIndexCount(0),
+      mUuidIndexCount(0) {
     *this = other;  // copy all elements
   }
   SerializableObjectList(
@@ -156,7 +177,9 @@ public:
     : onEdited(*this),
       onElementEdited(*this),
       mOnEditedSlot(*this, &SerializableObjectList<
-                               T, P, OnEditedArgs...>::elementEditedHandler) {
+                               T, P, OnEditedArgs...>::elementEditedHandler),
+      mPointerIndexCount(0),
+      mUuidIndexCount(0) {
     while (!other.isEmpty()) {
       append(other.take(0));  // copy all pointers (NOT the objects!)
     }
@@ -166,14 +189,18 @@ public:
     : onEdited(*this),
       onElementEdited(*this),
       mOnEditedSlot(*this, &SerializableObjectList<
-                               T, P, OnEditedArgs...>::elementEditedHandler) {
+                               T, P, OnEditedArgs...>::elementEditedHandler),
+      mPointerIndexCount(0),
+      mUuidIndexCount(0) {
     foreach (const std::shared_ptr<T>& obj, elements) { append(obj); }
   }
   explicit SerializableObjectList(const SExpression& node)
     : onEdited(*this),
       onElementEdited(*this),
       mOnEditedSlot(*this, &SerializableObjectList<
-                               T, P, OnEditedArgs...>::elementEditedHandler) {
+                               T, P, OnEditedArgs...>::elementEditedHandler),
+      mPointerIndexCount(0),
+      mUuidIndexCount(0) {
     loadFromSExpression(node);  // can throw
   }
   virtual ~SerializableObjectList() noexcept {}
@@ -200,20 +227,28 @@ public:
 
   // Element Query
   int indexOf(const T* obj) const noexcept {
-    for (int i = 0; i < count(); ++i) {
-      if (mObjects[i].get() == obj) {
-        return i;
-      }
+    QMutexLocker lock(&mIndexMutex);
+    // add elements to the index which were inserted since the last lookup
+    for (; mPointerIndexCount < count(); ++mPointerIndexCount) {
+      updateIndex(mPointerIndex,
+                  static_cast<const T*>(mObjects[mPointerIndexCount].get()),
+                  mPointerIndexCount, [this](int i) {
+                    return static_cast<const T*>(mObjects[i].get());
+                  });
     }
-    return -1;
+    int i = mPointerIndex.value(obj, -1);
+    return (contains(i) && (mObjects[i].get() == obj)) ? i : -1;
   }
   int indexOf(const Uuid& key) const noexcept {
-    for (int i = 0; i < count(); ++i) {
-      if (mObjects[i]->getUuid() == key) {
-        return i;
-      }
+    QMutexLocker lock(&mIndexMutex);
+    // add elements to the index which were inserted since the last lookup
+    for (; mUuidIndexCount < count(); ++mUuidIndexCount) {
+      updateIndex(mUuidIndex, mObjects[mUuidIndexCount]->getUuid(),
+                  mUuidIndexCount,
+                  [this](int i) { return mObjects[i]->getUuid(); });
     }
-    return -1;
+    int i = mUuidIndex.value(key, -1);
+    return (contains(i) && (mObjects[i]->getUuid() == key)) ? i : -1;
   }
   int indexOf(const QString& name) const noexcept {
     for (int i = 0; i < count(); ++i) {
@@ -295,6 +330,7 @@ public:
 
   // General Methods
   int loadFromSExpression(const SExpression& node) {
+    SignalBatch batch;
     clear();
     foreach (const SExpression& node, node.getChildren(P::tagname)) {
       append(std::make_shared<T>(node));  // can throw
@@ -338,6 +374,7 @@ public:
   void remove(const QString& name) noexcept { take(name); }
   void clear() noexcept {
     // do not call mObjects.clear() because it would not notify the observers
+    SignalBatch batch;
     for (int i = count() - 1; i >= 0; --i) {
       remove(i);
     }
@@ -391,6 +428,7 @@ public:
   }
   SerializableObjectList<T, P, OnEditedArgs...>& operator=(
       const SerializableObjectList<T, P, OnEditedArgs...>& rhs) noexcept {
+    SignalBatch batch;
     clear();
     mObjects.reserve(rhs.count());
     foreach (const std::shared_ptr<T>& ptr, rhs.mObjects) {
@@ -400,6 +438,7 @@ public:
   }
   SerializableObjectList<T, P, OnEditedArgs...>& operator=(
       SerializableObjectList<T, P, OnEditedArgs...>&& rhs) noexcept {
+    SignalBatch batch;
     clear();
     mObjects.reserve(rhs.count());
     foreach (const std::shared_ptr<T>& ptr, rhs.mObjects) {
@@ -411,11 +450,13 @@ public:
 
 protected:  // Methods
   void insertElement(int index, const std::shared_ptr<T>& obj) noexcept {
+    invalidateIndices(index);
     mObjects.insert(index, obj);
     obj->onEdited.attach(mOnEditedSlot);
     onEdited.notify(index, obj, Event::ElementAdded);
   }
   std::shared_ptr<T> takeElement(int index) noexcept {
+    invalidateIndices(index);
     std::shared_ptr<T> obj = mObjects.takeAt(index);
     obj->onEdited.detach(mOnEditedSlot);
     onEdited.notify(index, obj, Event::ElementRemoved);
@@ -431,6 +472,33 @@ protected:  // Methods
                      "unknown element!";
     }
   }
+  void invalidateIndices(int index) const noexcept {
+    QMutexLocker lock(&mIndexMutex);
+    // all index entries from the given position to the end are outdated now
+    mPointerIndexCount = qMin(mPointerIndexCount, index);
+    mUuidIndexCount    = qMin(mUuidIndexCount, index);
+
+    // outdated entries are only overwritten, so drop them from time to time to
+    // avoid growing the indices endlessly on frequently modified lists
+    if (mPointerIndex.count() > (2 * mObjects.count() + 16)) {
+      mPointerIndex.clear();
+      mPointerIndexCount = 0;
+    }
+    if (mUuidIndex.count() > (2 * mObjects.count() + 16)) {
+      mUuidIndex.clear();
+      mUuidIndexCount = 0;
+    }
+  }
+  template <typename K, typename F>
+  static void updateIndex(QHash<K, int>& index, const K& key, int i,
+                          F keyAt) noexcept {
+    // keep an existing entry if it points to a valid element with a lower
+    // index to get the same result as a linear search in case of duplicates
+    int existing = index.value(key, -1);
+    if ((existing < 0) || (existing >= i) || (keyAt(existing) != key)) {
+      index.insert(key, i);
+    }
+  }
   void throwKeyNotFoundException(const Uuid& key) const {
     throw RuntimeError(
         __FILE__, __LINE__,
@@ -453,6 +521,15 @@ protected:  // Methods
 protected:  // Data
   QVector<std::shared_ptr<T>> mObjects;
   Slot<T, OnEditedArgs...>    mOnEditedSlot;
+
+  // Lazily built lookup indices, only the first `m*IndexCount` elements of
+  // mObjects are guaranteed to be indexed correctly. The mutex protects them
+  // since they are modified by (otherwise thread-safe) const lookups.
+  mutable QMutex               mIndexMutex;
+  mutable QHash<const T*, int> mPointerIndex;
+  mutable int                  mPointerIndexCount;
+  mutable QHash<Uuid, int>     mUuidIndex;
+  mutable int                  mUuidIndexCount;
 };
 
 }  // namespace librepcb
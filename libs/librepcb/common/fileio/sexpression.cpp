@@ -22,6 +22,8 @@
  ******************************************************************************/
 #include "sexpression.h"
 
+#include "../profiler.h"
+
 #include <sexpresso/sexpresso.hpp>
 
 #include <QtCore>
@@ -291,6 +293,7 @@ SExpression SExpression::createLineBreak() {
 
 SExpression SExpression::parse(const QByteArray& content,
                                const FilePath&   filePath) {
+  LIBREPCB_PROFILE_SCOPE("Parse S-Expression");
   std::string     error;
   QString         str  = QString::fromUtf8(content);
   sexpresso::Sexp tree = sexpresso::parse(str.toStdString(), error);
@@ -22,6 +22,7 @@
  ******************************************************************************/
 #include "transactionalfilesystem.h"
 
+#include "../scopeguard.h"
 #include "../toolbox.h"
 #include "fileutils.h"
 #include "sexpression.h"
@@ -29,6 +30,9 @@
 #include <quazip/quazip.h>
 #include <quazip/quazipdir.h>
 #include <quazip/quazipfile.h>
+#include <zlib.h>
+
+#include <QtConcurrent/QtConcurrent>
 
 /*******************************************************************************
  *  Namespace
@@ -48,6 +52,9 @@ TransactionalFileSystem::TransactionalFileSystem(const FilePath& filepath,
     mIsWritable(writable),
     mLock(filepath),
     mRestoredFromAutosave(false) {
+  connect(&mAutosaveWatcher, &QFutureWatcher<bool>::finished, this,
+          [this]() { emit autosaveFinished(mAutosaveWatcher.result()); });
+
   // Load the backup if there is one (i.e. last save operation has failed).
   FilePath backupFile = mFilePath.getPathTo(".backup/backup.lp");
   if (backupFile.isExistingFile()) {
@@ -97,6 +104,8 @@ TransactionalFileSystem::TransactionalFileSystem(const FilePath& filepath,
 }
 
 TransactionalFileSystem::~TransactionalFileSystem() noexcept {
+  waitForBackgroundAutosave();
+
   // Remove autosave directory as it is not needed in case the file system
   // was gracefully closed. We only need it if the application has crashed.
   // But if the file system is opened in read-only mode, or if an autosave was
@@ -111,6 +120,15 @@ TransactionalFileSystem::~TransactionalFileSystem() noexcept {
   }
 }
 
+/*******************************************************************************
+ *  Getters
+ ******************************************************************************/
+
+bool TransactionalFileSystem::isModified() const noexcept {
+  return (!mModifiedFiles.isEmpty()) || (!mRemovedFiles.isEmpty()) ||
+         (!mRemovedDirs.isEmpty()) || (!mZipFiles.isEmpty());
+}
+
 /*******************************************************************************
  *  Inherited from FileSystem
  ******************************************************************************/
@@ -136,7 +154,7 @@ QStringList TransactionalFileSystem::getDirs(const QString& path) const
   }
 
   // add directories of new files
-  foreach (const QString& filepath, mModifiedFiles.keys()) {
+  foreach (const QString& filepath, mModifiedFiles.keys() + mZipFiles.keys()) {
     if (filepath.startsWith(dirpath)) {
       QStringList relpath = filepath.mid(dirpath.length()).split('/');
       if (relpath.count() > 1) {
@@ -163,7 +181,7 @@ QStringList TransactionalFileSystem::getFiles(const QString& path) const
   }
 
   // add new files
-  foreach (const QString& filepath, mModifiedFiles.keys()) {
+  foreach (const QString& filepath, mModifiedFiles.keys() + mZipFiles.keys()) {
     if (filepath.startsWith(dirpath)) {
       QStringList relpath = filepath.mid(dirpath.length()).split('/');
       if (relpath.count() == 1) {
@@ -177,7 +195,8 @@ QStringList TransactionalFileSystem::getFiles(const QString& path) const
 
 bool TransactionalFileSystem::fileExists(const QString& path) const noexcept {
   QString cleanedPath = cleanPath(path);
-  if (mModifiedFiles.contains(cleanedPath)) {
+  if (mModifiedFiles.contains(cleanedPath) ||
+      mZipFiles.contains(cleanedPath)) {
     return true;
   } else if (isRemoved(cleanedPath)) {
     return false;
@@ -190,6 +209,8 @@ QByteArray TransactionalFileSystem::read(const QString& path) const {
   QString cleanedPath = cleanPath(path);
   if (mModifiedFiles.contains(cleanedPath)) {
     return mModifiedFiles.value(cleanedPath);
+  } else if (mZipFiles.contains(cleanedPath)) {
+    return readFromZip(cleanedPath);  // can throw
   } else if (!isRemoved(cleanedPath)) {
     return FileUtils::readFile(mFilePath.getPathTo(cleanedPath));  // can throw
   } else {
@@ -201,14 +222,16 @@ QByteArray TransactionalFileSystem::read(const QString& path) const {
 
 void TransactionalFileSystem::write(const QString&    path,
                                     const QByteArray& content) {
-  QString cleanedPath         = cleanPath(path);
-  mModifiedFiles[cleanedPath] = content;
+  QString cleanedPath = cleanPath(path);
+  mZipFiles.remove(cleanedPath);
   mRemovedFiles.remove(cleanedPath);
+  mModifiedFiles[cleanedPath] = content;
 }
 
 void TransactionalFileSystem::removeFile(const QString& path) {
   QString cleanedPath = cleanPath(path);
   mModifiedFiles.remove(cleanedPath);
+  mZipFiles.remove(cleanedPath);
   mRemovedFiles.insert(cleanedPath);
 }
 
@@ -220,6 +243,11 @@ void TransactionalFileSystem::removeDirRecursively(const QString& path) {
       mModifiedFiles.remove(fp);
     }
   }
+  foreach (const QString& fp, mZipFiles.keys()) {
+    if (dirpath.isEmpty() || fp.startsWith(dirpath)) {
+      mZipFiles.remove(fp);
+    }
+  }
   foreach (const QString& fp, mRemovedFiles) {
     if (dirpath.isEmpty() || fp.startsWith(dirpath)) {
       mRemovedFiles.remove(fp);
@@ -233,45 +261,187 @@ void TransactionalFileSystem::removeDirRecursively(const QString& path) {
  ******************************************************************************/
 
 void TransactionalFileSystem::loadFromZip(const FilePath& fp) {
+  // files of a previously loaded ZIP file need to be read before switching
+  // to the new one
+  loadZipFiles();  // can throw
+
   QuaZip zip(fp.toStr());
   if (!zip.open(QuaZip::mdUnzip)) {
     throw RuntimeError(
         __FILE__, __LINE__,
         QString(tr("Failed to open the ZIP file '%1'.")).arg(fp.toNative()));
   }
-  QuaZipFile file(&zip);
-  for (bool f = zip.goToFirstFile(); f; f = zip.goToNextFile()) {
-    file.open(QIODevice::ReadOnly);
-    write(file.getActualFileName(), file.readAll());
-    file.close();
-  }
+  QStringList names = zip.getFileNameList();
   zip.close();
+
+  // only remember the contained files, they are read when accessed
+  closeZip();
+  mZipFilePath = fp;
+  foreach (const QString& name, names) {
+    if (name.endsWith('/')) continue;  // skip directory entries
+    QString cleanedPath = cleanPath(name);
+    mModifiedFiles.remove(cleanedPath);
+    mRemovedFiles.remove(cleanedPath);
+    mZipFiles.insert(cleanedPath, name);
+  }
 }
 
-void TransactionalFileSystem::exportToZip(const FilePath& fp) const {
-  QuaZip zip(fp.toStr());
+void TransactionalFileSystem::exportToZip(const FilePath& fp,
+                                          int compressionLevel) const {
+  // Determine all files to export before creating the temporary file, thus
+  // it won't be exported into itself.
+  QStringList files;
+  getFilesToExport(files, fp, "");
+
+  // Write to a temporary file first since the destination might be the ZIP
+  // file we are lazily reading files from.
+  FilePath tmpFp(fp.toStr() % "~");
+  QuaZip   zip(tmpFp.toStr());
   if (!zip.open(QuaZip::mdCreate)) {
     throw RuntimeError(
         __FILE__, __LINE__,
         QString(tr("Failed to create the ZIP file '%1'.")).arg(fp.toNative()));
   }
-  try {
-    QuaZipFile file(&zip);
-    exportDirToZip(file, fp, "");
-    zip.close();
-  } catch (const Exception& e) {
-    // Remove ZIP file because it is not complete
-    QFile(fp.toStr()).remove();
+
+  struct CompressedFile {
+    QString    filepath;
+    QByteArray data;
+    quint32    crc;
+    qint64     size;
+  };
+  QList<QFuture<CompressedFile>> queue;
+
+  // in case of an error, wait for running workers since they access this
+  // object, and remove the incomplete ZIP file
+  auto cleanup = scopeGuard([&]() {
+    foreach (QFuture<CompressedFile> future, queue) {
+      future.waitForFinished();
+    }
     zip.close();
-    throw;
+    QFile(tmpFp.toStr()).remove();
+  });
+
+  // Compress files in parallel, but only a limited number of files in advance
+  // to avoid holding all file contents in memory. The compressed files are
+  // written in the original order to get a deterministic archive.
+  int maxQueueSize = qMax(2, QThread::idealThreadCount() * 2);
+  int next         = 0;
+  while ((next < files.count()) || (!queue.isEmpty())) {
+    while ((next < files.count()) && (queue.count() < maxQueueSize)) {
+      QString filepath = files.at(next++);
+      queue.append(QtConcurrent::run([this, filepath, compressionLevel]() {
+        QByteArray content = read(filepath);  // can throw
+        quint32    crc     = crc32(0L, Z_NULL, 0);
+        crc = crc32(crc, reinterpret_cast<const Bytef*>(content.constData()),
+                    content.size());
+        QByteArray data = (compressionLevel == 0)
+                              ? content
+                              : deflateRaw(content, compressionLevel);
+        return CompressedFile{filepath, data, crc, content.size()};
+      }));
+    }
+    CompressedFile cf = queue.takeFirst().result();  // can throw
+
+    // write the already compressed data to the ZIP archive
+    QuaZipFile    file(&zip);
+    QuaZipNewInfo newFileInfo(cf.filepath);
+    newFileInfo.setPermissions(QFileDevice::ReadOwner | QFileDevice::ReadGroup |
+                               QFileDevice::ReadOther |
+                               QFileDevice::WriteOwner);
+    newFileInfo.uncompressedSize = cf.size;
+    if (!file.open(QIODevice::WriteOnly, newFileInfo, nullptr, cf.crc,
+                   (compressionLevel == 0) ? 0 : Z_DEFLATED, compressionLevel,
+                   true)) {
+      throw RuntimeError(__FILE__, __LINE__);
+    }
+    qint64 bytesWritten = file.write(cf.data);
+    file.close();
+    if ((bytesWritten != cf.data.length()) || (file.getZipError() != ZIP_OK)) {
+      throw RuntimeError(__FILE__, __LINE__,
+                         QString(tr("Failed to write file '%1' to '%2'."))
+                             .arg(cf.filepath, fp.toNative()));
+    }
+  }
+  zip.close();
+  if (zip.getZipError() != ZIP_OK) {
+    throw RuntimeError(
+        __FILE__, __LINE__,
+        QString(tr("Failed to create the ZIP file '%1'.")).arg(fp.toNative()));
+  }
+
+  // replace the destination file (the loaded ZIP file must be closed first)
+  closeZip();
+  if (fp.isExistingFile()) {
+    FileUtils::removeFile(fp);  // can throw
   }
+  FileUtils::move(tmpFp, fp);  // can throw
+  cleanup.dismiss();
 }
 
 void TransactionalFileSystem::autosave() {
+  waitForBackgroundAutosave();
+  loadZipFiles();        // can throw
   saveDiff("autosave");  // can throw
 }
 
+void TransactionalFileSystem::autosaveInBackground() {
+  if (!mIsWritable) {
+    throw RuntimeError(__FILE__, __LINE__, tr("File system is read-only."));
+  }
+
+  // only one autosave at a time, and in the right order
+  waitForBackgroundAutosave();
+  loadZipFiles();  // can throw
+
+  // Take a snapshot of the current modifications. This is cheap since the
+  // containers are implicitly shared, and modifications made while the
+  // autosave is running detach them from the snapshot.
+  FilePath                   root          = mFilePath;
+  QHash<QString, QByteArray> modifiedFiles = mModifiedFiles;
+  QSet<QString>              removedFiles  = mRemovedFiles;
+  QSet<QString>              removedDirs   = mRemovedDirs;
+  mAutosaveFuture = QtConcurrent::run([=]() {
+    try {
+      saveDiff(root, "autosave", modifiedFiles, removedFiles,
+               removedDirs);  // can throw
+      return true;
+    } catch (const Exception& e) {
+      qWarning() << "Background autosave failed:" << e.getMsg();
+      return false;
+    }
+  });
+  mAutosaveWatcher.setFuture(mAutosaveFuture);
+}
+
+void TransactionalFileSystem::discardUnmodifiedFiles() noexcept {
+  foreach (const QString& filepath, mModifiedFiles.keys()) {
+    if ((!isRemoved(filepath)) &&
+        isEqualToDisk(filepath, mModifiedFiles[filepath])) {
+      mModifiedFiles.remove(filepath);
+    }
+  }
+}
+
 void TransactionalFileSystem::save() {
+  if (!mIsWritable) {
+    throw RuntimeError(__FILE__, __LINE__, tr("File system is read-only."));
+  }
+
+  // make sure a running autosave does not write an outdated autosave backup
+  // after we removed it
+  waitForBackgroundAutosave();
+  loadZipFiles();  // can throw
+
+  discardUnmodifiedFiles();
+
+  // if there are no modifications, there is nothing to do at all
+  if (mModifiedFiles.isEmpty() && mRemovedFiles.isEmpty() &&
+      mRemovedDirs.isEmpty()) {
+    removeDiff("autosave");  // can throw
+    mRestoredFromAutosave = false;
+    return;
+  }
+
   // save to backup directory
   saveDiff("backup");  // can throw
 
@@ -289,6 +459,11 @@ void TransactionalFileSystem::save() {
     if (fp.isExistingDir()) {
       FileUtils::removeDirRecursively(fp);  // can throw
     }
+    foreach (const QString& filepath, mDiskFileHashes.keys()) {
+      if (dir.isEmpty() || filepath.startsWith(dir)) {
+        mDiskFileHashes.remove(filepath);
+      }
+    }
   }
 
   // remove files
@@ -297,12 +472,16 @@ void TransactionalFileSystem::save() {
     if (fp.isExistingFile()) {
       FileUtils::removeFile(fp);  // can throw
     }
+    mDiskFileHashes.remove(filepath);
   }
 
   // save new or modified files
   foreach (const QString& filepath, mModifiedFiles.keys()) {
+    const QByteArray& content = mModifiedFiles[filepath];
+    mDiskFileHashes.remove(filepath);  // in case writing fails
     FileUtils::writeFile(mFilePath.getPathTo(filepath),
-                         mModifiedFiles.value(filepath));  // can throw
+                         content);  // can throw
+    updateDiskFileHash(filepath, computeHash(content));
   }
 
   // remove backup
@@ -342,20 +521,63 @@ bool TransactionalFileSystem::isRemoved(const QString& path) const noexcept {
   return false;
 }
 
-void TransactionalFileSystem::exportDirToZip(QuaZipFile&     file,
-                                             const FilePath& zipFp,
-                                             const QString&  dir) const {
+bool TransactionalFileSystem::isEqualToDisk(
+    const QString& path, const QByteArray& content) noexcept {
+  // The file might have been modified by another application in the meantime,
+  // so the cached hash is only used if the file attributes are still the same.
+  FilePath  fp = mFilePath.getPathTo(path);
+  QFileInfo info(fp.toStr());
+  auto      it = mDiskFileHashes.constFind(path);
+  if (!info.isFile()) {
+    mDiskFileHashes.remove(path);
+    return false;
+  } else if ((it == mDiskFileHashes.constEnd()) ||
+             (it->size != info.size()) ||
+             (it->lastModified != info.lastModified())) {
+    try {
+      // note: attributes are determined before reading, so a modification
+      // while reading leads to a mismatch next time
+      QByteArray   hash = computeHash(FileUtils::readFile(fp));  // can throw
+      DiskFileHash entry{hash, info.size(), info.lastModified()};
+      it = mDiskFileHashes.insert(path, entry);
+    } catch (const Exception& e) {
+      mDiskFileHashes.remove(path);  // maybe it works next time
+      return false;
+    }
+  }
+  return it->hash == computeHash(content);
+}
+
+void TransactionalFileSystem::updateDiskFileHash(
+    const QString& path, const QByteArray& hash) noexcept {
+  QFileInfo info(mFilePath.getPathTo(path).toStr());
+  if (info.isFile()) {
+    mDiskFileHashes.insert(
+        path, DiskFileHash{hash, info.size(), info.lastModified()});
+  } else {
+    mDiskFileHashes.remove(path);
+  }
+}
+
+QByteArray TransactionalFileSystem::computeHash(
+    const QByteArray& content) noexcept {
+  return QCryptographicHash::hash(content, QCryptographicHash::Sha256);
+}
+
+void TransactionalFileSystem::getFilesToExport(QStringList&    files,
+                                               const FilePath& zipFp,
+                                               const QString&  dir) const {
   QString path = dir.isEmpty() ? dir : dir % "/";
 
   // export directories
-  foreach (const QString& dirname, getDirs(dir)) {
+  foreach (const QString& dirname, Toolbox::sorted(getDirs(dir))) {
     // skip dotdirs, e.g. ".git", ".svn", ".autosave", ".backup"
     if (dirname.startsWith('.')) continue;
-    exportDirToZip(file, zipFp, path % dirname);
+    getFilesToExport(files, zipFp, path % dirname);
   }
 
   // export files
-  foreach (const QString& filename, getFiles(dir)) {
+  foreach (const QString& filename, Toolbox::sorted(getFiles(dir))) {
     QString filepath = path % filename;
     if (filepath == zipFp.toRelative(mFilePath)) {
       // In case the exported ZIP file is located inside this file system,
@@ -364,53 +586,222 @@ void TransactionalFileSystem::exportDirToZip(QuaZipFile&     file,
     }
     // skip lock file
     if (filename == ".lock") continue;
-    // read file content and add it to the ZIP archive
-    const QByteArray& content = read(filepath);  // can throw
-    QuaZipNewInfo     newFileInfo(filepath);
-    newFileInfo.setPermissions(QFileDevice::ReadOwner | QFileDevice::ReadGroup |
-                               QFileDevice::ReadOther |
-                               QFileDevice::WriteOwner);
-    if (!file.open(QIODevice::WriteOnly, newFileInfo)) {
-      throw RuntimeError(__FILE__, __LINE__);
+    files.append(filepath);
+  }
+}
+
+QByteArray TransactionalFileSystem::readFromZip(const QString& path) const {
+  QMutexLocker lock(&mZipMutex);
+  if (!mZip) {
+    mZip.reset(new QuaZip(mZipFilePath.toStr()));
+    if (!mZip->open(QuaZip::mdUnzip)) {
+      mZip.reset();
+      throw RuntimeError(__FILE__, __LINE__,
+                         QString(tr("Failed to open the ZIP file '%1'."))
+                             .arg(mZipFilePath.toNative()));
     }
-    qint64 bytesWritten = file.write(content);
-    file.close();
-    if (bytesWritten != content.length()) {
+  }
+  // Note: If the ZIP file was overwritten by exportToZip() in the meantime,
+  // the file is stored with its cleaned path.
+  QuaZipFile file(mZip.data());
+  bool       found = mZip->setCurrentFile(mZipFiles.value(path)) ||
+               mZip->setCurrentFile(path);
+  if ((!found) || (!file.open(QIODevice::ReadOnly))) {
+    throw RuntimeError(__FILE__, __LINE__,
+                       QString(tr("Failed to read file '%1' from '%2'."))
+                           .arg(path, mZipFilePath.toNative()));
+  }
+  QByteArray content = file.readAll();
+  file.close();
+  if (file.getZipError() != UNZ_OK) {
+    throw RuntimeError(__FILE__, __LINE__,
+                       QString(tr("Failed to read file '%1' from '%2'."))
+                           .arg(path, mZipFilePath.toNative()));
+  }
+  return content;
+}
+
+void TransactionalFileSystem::loadZipFiles() {
+  if (mZipFiles.isEmpty()) return;
+
+  struct ZipEntry {
+    QString    filepath;
+    QByteArray data;
+    quint32    crc;
+    qint64     size;
+    int        method;
+  };
+
+  // Read the compressed data sequentially...
+  QList<ZipEntry> entries;
+  QuaZip          zip(mZipFilePath.toStr());
+  if (!zip.open(QuaZip::mdUnzip)) {
+    throw RuntimeError(__FILE__, __LINE__,
+                       QString(tr("Failed to open the ZIP file '%1'."))
+                           .arg(mZipFilePath.toNative()));
+  }
+  QuaZipFile file(&zip);
+  for (auto it = mZipFiles.constBegin(); it != mZipFiles.constEnd(); ++it) {
+    QuaZipFileInfo64 info;
+    ZipEntry         entry;
+    entry.filepath = it.key();
+    // Note: If the ZIP file was overwritten by exportToZip() in the meantime,
+    // the file is stored with its cleaned path (see readFromZip()).
+    bool found = zip.setCurrentFile(it.value()) || zip.setCurrentFile(it.key());
+    if ((!found) || (!zip.getCurrentFileInfo(&info)) ||
+        (!file.open(QIODevice::ReadOnly, &entry.method, nullptr, true))) {
       throw RuntimeError(__FILE__, __LINE__,
-                         QString(tr("Failed to write file '%1' to '%2'."))
-                             .arg(filepath, zipFp.toNative()));
+                         QString(tr("Failed to read file '%1' from '%2'."))
+                             .arg(it.key(), mZipFilePath.toNative()));
+    }
+    entry.data = file.readAll();
+    entry.crc  = info.crc;
+    entry.size = static_cast<qint64>(info.uncompressedSize);
+    file.close();
+    entries.append(entry);
+  }
+  zip.close();
+
+  // ...and decompress it in parallel
+  FilePath                   zipFp = mZipFilePath;
+  QList<QFuture<QByteArray>> futures;
+  foreach (const ZipEntry& entry, entries) {
+    futures.append(QtConcurrent::run([entry, zipFp]() {
+      try {
+        QByteArray data = entry.data;
+        if (entry.method == Z_DEFLATED) {
+          data = inflateRaw(data, entry.size);  // can throw
+        } else if (entry.method != 0) {
+          throw RuntimeError(__FILE__, __LINE__,
+                             tr("Unsupported ZIP compression method."));
+        }
+        quint32 crc = crc32(0L, Z_NULL, 0);
+        crc = crc32(crc, reinterpret_cast<const Bytef*>(data.constData()),
+                    data.size());
+        if ((crc != entry.crc) || (data.size() != entry.size)) {
+          throw RuntimeError(__FILE__, __LINE__, tr("Checksum mismatch."));
+        }
+        return data;
+      } catch (const Exception& e) {
+        throw RuntimeError(
+            __FILE__, __LINE__,
+            QString(tr("Failed to read file '%1' from '%2': %3"))
+                .arg(entry.filepath, zipFp.toNative(), e.getMsg()));
+      }
+    }));
+  }
+
+  // wait for all workers before applying the result or reporting an error
+  QHash<QString, QByteArray> files;
+  QScopedPointer<Exception>  error;
+  for (int i = 0; i < futures.count(); ++i) {
+    try {
+      files.insert(entries.at(i).filepath, futures[i].result());  // can throw
+    } catch (const Exception& e) {
+      if (!error) error.reset(e.clone());
     }
   }
+  if (error) {
+    error->raise();
+  }
+
+  for (auto it = files.constBegin(); it != files.constEnd(); ++it) {
+    mModifiedFiles.insert(it.key(), it.value());
+  }
+  mZipFiles.clear();
+  closeZip();
 }
 
-void TransactionalFileSystem::saveDiff(const QString& type) const {
-  QDateTime dt       = QDateTime::currentDateTime();
-  FilePath  dir      = mFilePath.getPathTo("." % type);
-  FilePath  filesDir = dir.getPathTo(dt.toString("yyyy-MM-dd_hh-mm-ss-zzz"));
+void TransactionalFileSystem::closeZip() const noexcept {
+  QMutexLocker lock(&mZipMutex);
+  mZip.reset();
+}
 
+QByteArray TransactionalFileSystem::deflateRaw(const QByteArray& data,
+                                               int               level) {
+  z_stream stream;
+  memset(&stream, 0, sizeof(stream));
+  // negative window bits -> raw deflate stream without zlib header, as needed
+  // for ZIP files
+  if (deflateInit2(&stream, level, Z_DEFLATED, -MAX_WBITS, 8,
+                   Z_DEFAULT_STRATEGY) != Z_OK) {
+    throw RuntimeError(__FILE__, __LINE__, tr("Failed to compress data."));
+  }
+  QByteArray output(static_cast<int>(deflateBound(&stream, data.size())),
+                    Qt::Uninitialized);
+  stream.next_in   = reinterpret_cast<Bytef*>(const_cast<char*>(data.data()));
+  stream.avail_in  = static_cast<uInt>(data.size());
+  stream.next_out  = reinterpret_cast<Bytef*>(output.data());
+  stream.avail_out = static_cast<uInt>(output.size());
+  int result       = deflate(&stream, Z_FINISH);
+  output.resize(static_cast<int>(stream.total_out));
+  deflateEnd(&stream);
+  if (result != Z_STREAM_END) {
+    throw RuntimeError(__FILE__, __LINE__, tr("Failed to compress data."));
+  }
+  return output;
+}
+
+QByteArray TransactionalFileSystem::inflateRaw(const QByteArray& data,
+                                               qint64            size) {
+  if ((size < 0) || (size > std::numeric_limits<int>::max())) {
+    throw RuntimeError(__FILE__, __LINE__, tr("Invalid file size."));
+  }
+  z_stream stream;
+  memset(&stream, 0, sizeof(stream));
+  if (inflateInit2(&stream, -MAX_WBITS) != Z_OK) {
+    throw RuntimeError(__FILE__, __LINE__, tr("Failed to decompress data."));
+  }
+  QByteArray output(static_cast<int>(size), Qt::Uninitialized);
+  stream.next_in   = reinterpret_cast<Bytef*>(const_cast<char*>(data.data()));
+  stream.avail_in  = static_cast<uInt>(data.size());
+  stream.next_out  = reinterpret_cast<Bytef*>(output.data());
+  stream.avail_out = static_cast<uInt>(output.size());
+  int result       = inflate(&stream, Z_FINISH);
+  inflateEnd(&stream);
+  if ((result != Z_STREAM_END) ||
+      (static_cast<int>(stream.total_out) != output.size())) {
+    throw RuntimeError(__FILE__, __LINE__, tr("Failed to decompress data."));
+  }
+  return output;
+}
+
+void TransactionalFileSystem::saveDiff(const QString& type) const {
   if (!mIsWritable) {
     throw RuntimeError(__FILE__, __LINE__, tr("File system is read-only."));
   }
 
-  SExpression root = SExpression::createList("librepcb_" % type);
-  root.appendChild("created", dt, true);
-  root.appendChild("modified_files_directory", filesDir.getFilename(), true);
-  foreach (const QString& filepath, Toolbox::sorted(mModifiedFiles.keys())) {
-    root.appendChild("modified_file", filepath, true);
+  saveDiff(mFilePath, type, mModifiedFiles, mRemovedFiles,
+           mRemovedDirs);  // can throw
+}
+
+void TransactionalFileSystem::saveDiff(
+    const FilePath& root, const QString& type,
+    const QHash<QString, QByteArray>& modifiedFiles,
+    const QSet<QString>& removedFiles, const QSet<QString>& removedDirs) {
+  QDateTime dt       = QDateTime::currentDateTime();
+  FilePath  dir      = root.getPathTo("." % type);
+  FilePath  filesDir = dir.getPathTo(dt.toString("yyyy-MM-dd_hh-mm-ss-zzz"));
+
+  SExpression index = SExpression::createList("librepcb_" % type);
+  index.appendChild("created", dt, true);
+  index.appendChild("modified_files_directory", filesDir.getFilename(), true);
+  foreach (const QString& filepath, Toolbox::sorted(modifiedFiles.keys())) {
+    index.appendChild("modified_file", filepath, true);
     FileUtils::writeFile(filesDir.getPathTo(filepath),
-                         mModifiedFiles.value(filepath));  // can throw
+                         modifiedFiles.value(filepath));  // can throw
   }
-  foreach (const QString& filepath, Toolbox::sorted(mRemovedFiles.toList())) {
-    root.appendChild("removed_file", filepath, true);
+  foreach (const QString& filepath, Toolbox::sorted(removedFiles.toList())) {
+    index.appendChild("removed_file", filepath, true);
   }
-  foreach (const QString& filepath, Toolbox::sorted(mRemovedDirs.toList())) {
-    root.appendChild("removed_directory", filepath, true);
+  foreach (const QString& filepath, Toolbox::sorted(removedDirs.toList())) {
+    index.appendChild("removed_directory", filepath, true);
   }
 
   // Writing the main file must be the last operation to "mark" this diff as
   // complete!
   FileUtils::writeFile(dir.getPathTo(type % ".lp"),
-                       root.toByteArray());  // can throw
+                       index.toByteArray());  // can throw
 }
 
 void TransactionalFileSystem::loadDiff(const FilePath& fp) {
@@ -449,8 +840,13 @@ void TransactionalFileSystem::removeDiff(const QString& type) {
   FileUtils::removeDirRecursively(dir);  // can throw
 }
 
+void TransactionalFileSystem::waitForBackgroundAutosave() noexcept {
+  mAutosaveFuture.waitForFinished();
+}
+
 void TransactionalFileSystem::discardChanges() noexcept {
   mModifiedFiles.clear();
+  mZipFiles.clear();
   mRemovedFiles.clear();
   mRemovedDirs.clear();
 }
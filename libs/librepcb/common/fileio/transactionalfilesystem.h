@@ -34,7 +34,7 @@
  *  Namespace / Forward Declarations
  ******************************************************************************/
 
-class QuaZipFile;
+class QuaZip;
 
 namespace librepcb {
 
@@ -58,7 +58,15 @@ namespace librepcb {
  *    an application crash (see @ref doc_project_autosave).
  *  - Holds all file modifications in memory and allows to write those in an
  *    atomic way to the disk (see @ref doc_project_save).
- *  - Allows to export the whole file system to a ZIP file.
+ *  - Allows to export the whole file system to a ZIP file, and to load the
+ *    content of a ZIP file (see #loadFromZip()).
+ *
+ * When saving, files with exactly the same content as the files on the disk
+ * are skipped (the content hashes are compared). So saving objects which were
+ * not modified does not lead to any file write operations, neither to the
+ * backup nor to the final location. The comparison is done only in #save()
+ * to keep disk accesses out of #write(), which is called while serializing
+ * the objects.
  */
 class TransactionalFileSystem final : public FileSystem {
   Q_OBJECT
@@ -82,6 +90,7 @@ public:
   // Getters
   bool isWritable() const noexcept { return mIsWritable; }
   bool isRestoredFromAutosave() const noexcept { return mRestoredFromAutosave; }
+  bool isModified() const noexcept;
 
   // Inherited from FileSystem
   virtual FilePath getAbsPath(const QString& path = "") const noexcept override;
@@ -95,9 +104,62 @@ public:
   virtual void removeDirRecursively(const QString& path = "") override;
 
   // General Methods
+
+  /**
+   * @brief Load all files from a ZIP archive
+   *
+   * The files are added as modified files, but their content is read from
+   * the archive only when they are accessed, so opening a project directly
+   * from a *.lppz file does not need to extract the whole archive.
+   *
+   * @param fp    The ZIP file to load. It must not be modified as long as any
+   *              of the loaded files is not yet saved or exported.
+   *
+   * @throw Exception if the ZIP file could not be opened.
+   */
   void loadFromZip(const FilePath& fp);
-  void exportToZip(const FilePath& fp) const;
+
+  /**
+   * @brief Export all files to a ZIP archive
+   *
+   * The files are compressed in parallel, but written to the archive in a
+   * deterministic order (sorted by path). The archive is first written to a
+   * temporary file which then replaces the destination file, so it's also
+   * possible to export to the ZIP file loaded with #loadFromZip().
+   *
+   * @param fp                The ZIP file to create (overwritten if existing).
+   * @param compressionLevel  The compression level, from 0 (store without
+   *                          compression) to 9 (best compression), or -1 for
+   *                          the default compression level.
+   *
+   * @throw Exception if the export failed.
+   */
+  void exportToZip(const FilePath& fp, int compressionLevel = -1) const;
+
   void autosave();
+
+  /**
+   * @brief Write an autosave backup of the current modifications in a worker
+   *        thread
+   *
+   * The modifications are copied (cheaply, thanks to implicit sharing), so
+   * the file system can be modified while the backup is written. When the
+   * backup is written, #autosaveFinished() is emitted (requires an event loop
+   * in the thread of this object).
+   *
+   * @throw Exception if the file system is read-only.
+   */
+  void autosaveInBackground();
+
+  /**
+   * @brief Discard written files which have the same content as on the disk
+   *
+   * This is done by #save() anyway, but can be called before to find out
+   * whether saving would write anything at all (see #isModified()). Since it
+   * reads files from the disk, avoid calling it in the GUI thread.
+   */
+  void discardUnmodifiedFiles() noexcept;
+
   void save();
 
   // Static Methods
@@ -119,11 +181,41 @@ public:
   }
   static QString cleanPath(QString path) noexcept;
 
+signals:
+  /**
+   * @brief Emitted when a backup started by #autosaveInBackground() is done
+   *
+   * @param success   Whether the backup was written successfully.
+   */
+  void autosaveFinished(bool success);
+
+private:  // Types
+  /// Content hash of a file on the disk, and the file attributes at the time
+  /// the hash was computed (to detect modifications by other applications)
+  struct DiskFileHash {
+    QByteArray hash;
+    qint64     size;
+    QDateTime  lastModified;
+  };
+
 private:  // Methods
   bool isRemoved(const QString& path) const noexcept;
-  void exportDirToZip(QuaZipFile& file, const FilePath& zipFp,
-                      const QString& dir) const;
+  bool isEqualToDisk(const QString& path, const QByteArray& content) noexcept;
+  void updateDiskFileHash(const QString& path, const QByteArray& hash) noexcept;
+  static QByteArray computeHash(const QByteArray& content) noexcept;
+  void getFilesToExport(QStringList& files, const FilePath& zipFp,
+                        const QString& dir) const;
+  QByteArray        readFromZip(const QString& path) const;
+  void              loadZipFiles();
+  void              closeZip() const noexcept;
+  static QByteArray deflateRaw(const QByteArray& data, int level);
+  static QByteArray inflateRaw(const QByteArray& data, qint64 size);
   void saveDiff(const QString& type) const;
+  static void saveDiff(const FilePath& root, const QString& type,
+                       const QHash<QString, QByteArray>& modifiedFiles,
+                       const QSet<QString>&              removedFiles,
+                       const QSet<QString>&              removedDirs);
+  void        waitForBackgroundAutosave() noexcept;
   void loadDiff(const FilePath& fp);
   void removeDiff(const QString& type);
   void discardChanges() noexcept;
@@ -138,6 +230,23 @@ private:  // Data
   QHash<QString, QByteArray> mModifiedFiles;
   QSet<QString>              mRemovedFiles;
   QSet<QString>              mRemovedDirs;
+
+  /// Files loaded with #loadFromZip() which are not read from the archive yet
+  /// (key: cleaned path, value: name in the archive), handled like modified
+  /// files
+  QHash<QString, QString>        mZipFiles;
+  FilePath                       mZipFilePath;
+  mutable QMutex                 mZipMutex;  ///< Protects #mZip
+  mutable QScopedPointer<QuaZip> mZip;       ///< Opened archive (or nullptr)
+
+  /// Running autosave started with #autosaveInBackground()
+  QFuture<bool>        mAutosaveFuture;
+  QFutureWatcher<bool> mAutosaveWatcher;  ///< Emits #autosaveFinished()
+
+  /// Content hashes of the files on the disk, used to skip saving files with
+  /// unmodified content. A hash is only valid as long as the size and
+  /// modification time of the file did not change.
+  QHash<QString, DiskFileHash> mDiskFileHashes;
 };
 
 /*******************************************************************************
@@ -0,0 +1,393 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "zipstreamextractor.h"
+
+#include "fileutils.h"
+
+#include <QtCore>
+
+#include <zlib.h>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+
+/*******************************************************************************
+ *  Constants
+ ******************************************************************************/
+
+static const quint32 sLocalFileHeaderSignature  = 0x04034b50;
+static const quint32 sDataDescriptorSignature   = 0x08074b50;
+static const quint32 sCentralDirectorySignature = 0x02014b50;
+static const quint32 sEndOfCentralDirSignature  = 0x06054b50;
+static const int     sLocalFileHeaderSize       = 30;
+static const int     sInflateBufferSize         = 64 * 1024;
+
+/*******************************************************************************
+ *  Constructors / Destructor
+ ******************************************************************************/
+
+ZipStreamExtractor::ZipStreamExtractor(const FilePath& destDir) noexcept
+  : mDestDir(destDir),
+    mState(State::EntryHeader),
+    mBuffer(),
+    mBufferPos(0),
+    mExtractedFiles(),
+    mInflateBuffer(),
+    mInflateStream(),
+    mEntryName(),
+    mEntryFile(),
+    mEntryMethod(0),
+    mEntryHasDataDescriptor(false),
+    mEntryIsZip64(false),
+    mEntryExpectedCrc(0),
+    mEntryCompressedSize(0),
+    mEntryCompressedRead(0),
+    mEntryCrc(0) {
+}
+
+ZipStreamExtractor::~ZipStreamExtractor() noexcept {
+  endInflate();
+}
+
+/*******************************************************************************
+ *  General Methods
+ ******************************************************************************/
+
+void ZipStreamExtractor::addData(const QByteArray& data) {
+  if (mState == State::Finished) {
+    return;  // the central directory is not needed
+  }
+
+  mBuffer.append(data);
+  bool progress = true;
+  while (progress) {
+    switch (mState) {
+      case State::EntryHeader:
+        progress = processEntryHeader();  // can throw
+        break;
+      case State::EntryData:
+        progress = processEntryData();  // can throw
+        break;
+      case State::DataDescriptor:
+        progress = processDataDescriptor();  // can throw
+        break;
+      default:
+        progress = false;
+        break;
+    }
+  }
+
+  // remove processed data at once to avoid moving the buffer for each entry
+  if (mState == State::Finished) {
+    mBuffer.clear();
+  } else {
+    mBuffer.remove(0, mBufferPos);
+  }
+  mBufferPos = 0;
+}
+
+void ZipStreamExtractor::finish() {
+  if (mState != State::Finished) {
+    throw RuntimeError(__FILE__, __LINE__,
+                       tr("The ZIP file is incomplete or corrupt."));
+  }
+}
+
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+bool ZipStreamExtractor::processEntryHeader() {
+  const char* p         = mBuffer.constData() + mBufferPos;
+  int         available = mBuffer.size() - mBufferPos;
+  if (available < 4) {
+    return false;
+  }
+  quint32 signature = readUInt32(p);
+  if ((signature == sCentralDirectorySignature) ||
+      (signature == sEndOfCentralDirSignature)) {
+    mState = State::Finished;  // all entries are extracted
+    return false;
+  } else if (signature != sLocalFileHeaderSignature) {
+    throw RuntimeError(__FILE__, __LINE__,
+                       tr("Invalid ZIP file: Unexpected data found."));
+  }
+  if (available < sLocalFileHeaderSize) {
+    return false;
+  }
+  quint16 flags          = readUInt16(p + 6);
+  quint16 method         = readUInt16(p + 8);
+  quint32 crc            = readUInt32(p + 14);
+  quint64 compressedSize = readUInt32(p + 18);
+  int     nameLength     = readUInt16(p + 26);
+  int     extraLength    = readUInt16(p + 28);
+  int     headerLength   = sLocalFileHeaderSize + nameLength + extraLength;
+  if (available < headerLength) {
+    return false;
+  }
+  QByteArray name(p + sLocalFileHeaderSize, nameLength);
+
+  // look for the Zip64 extended information, which contains the 64-bit sizes
+  bool        isZip64 = false;
+  const char* extra   = p + sLocalFileHeaderSize + nameLength;
+  for (int i = 0; i + 4 <= extraLength;) {
+    quint16 id   = readUInt16(extra + i);
+    int     size = readUInt16(extra + i + 2);
+    if ((id == 0x0001) && (i + 4 + size <= extraLength)) {
+      isZip64 = true;
+      // the local header contains both sizes (uncompressed first) if any of
+      // them is stored in the extra field
+      if (size >= 16) {
+        compressedSize = readUInt64(extra + i + 12);
+      }
+    }
+    i += 4 + size;
+  }
+
+  // check if the entry is supported
+  if (flags & 0x0001) {
+    throw RuntimeError(__FILE__, __LINE__,
+                       tr("Encrypted ZIP files are not supported."));
+  }
+  if ((method != 0) && (method != Z_DEFLATED)) {
+    throw RuntimeError(
+        __FILE__, __LINE__,
+        QString(tr("Unsupported ZIP compression method: %1")).arg(method));
+  }
+  if ((flags & 0x0008) && (method == 0)) {
+    // the end of such entries could only be determined from the central
+    // directory
+    throw RuntimeError(
+        __FILE__, __LINE__,
+        tr("Uncompressed ZIP entries of unknown size are not supported."));
+  }
+
+  // determine and check destination path, entries must not be located outside
+  // of the destination directory
+  mEntryName = (flags & 0x0800) ? QString::fromUtf8(name)
+                                : QString::fromLocal8Bit(name);
+  FilePath fp = mDestDir.getPathTo(mEntryName);
+  if ((mEntryName.isEmpty()) || (!fp.isLocatedInDir(mDestDir))) {
+    throw RuntimeError(
+        __FILE__, __LINE__,
+        QString(tr("Invalid file path in ZIP file: \"%1\"")).arg(mEntryName));
+  }
+
+  // create the directory resp. the file
+  if (mEntryName.endsWith('/')) {
+    FileUtils::makePath(fp);  // can throw
+  } else {
+    FileUtils::makePath(fp.getParentDir());  // can throw
+    mEntryFile.reset(new QFile(fp.toStr()));
+    if (!mEntryFile->open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+      throw RuntimeError(__FILE__, __LINE__,
+                         QString(tr("Could not open file \"%1\": %2"))
+                             .arg(fp.toNative(), mEntryFile->errorString()));
+    }
+    mExtractedFiles.append(fp);
+  }
+
+  // prepare decompression
+  if (method == Z_DEFLATED) {
+    mInflateStream.reset(new z_stream);
+    memset(mInflateStream.data(), 0, sizeof(z_stream));
+    // negative window bits -> raw deflate stream without zlib header, as used
+    // in ZIP files
+    if (inflateInit2(mInflateStream.data(), -MAX_WBITS) != Z_OK) {
+      mInflateStream.reset();
+      throw RuntimeError(__FILE__, __LINE__, tr("Failed to decompress data."));
+    }
+    if (mInflateBuffer.isEmpty()) {
+      mInflateBuffer.resize(sInflateBufferSize);
+    }
+  }
+
+  mEntryMethod            = method;
+  mEntryHasDataDescriptor = flags & 0x0008;
+  mEntryIsZip64           = isZip64;
+  mEntryExpectedCrc       = crc;
+  mEntryCompressedSize    = compressedSize;
+  mEntryCompressedRead    = 0;
+  mEntryCrc               = crc32(0L, Z_NULL, 0);
+  mBufferPos += headerLength;
+  mState = State::EntryData;
+  return true;
+}
+
+bool ZipStreamExtractor::processEntryData() {
+  const char* p         = mBuffer.constData() + mBufferPos;
+  quint64     available = mBuffer.size() - mBufferPos;
+  if (mEntryMethod == 0) {
+    // stored entry -> the size is known from the header
+    int size = static_cast<int>(
+        qMin(available, mEntryCompressedSize - mEntryCompressedRead));
+    writeEntryData(p, size);  // can throw
+    mBufferPos += size;
+    mEntryCompressedRead += size;
+    if (mEntryCompressedRead < mEntryCompressedSize) {
+      return false;  // need more data
+    }
+    closeEntry();  // can throw
+    mState = State::EntryHeader;
+    return true;
+  }
+
+  // deflated entry -> the end of the entry is marked in the deflate stream
+  if (!mEntryHasDataDescriptor) {
+    available = qMin(available, mEntryCompressedSize - mEntryCompressedRead);
+  }
+  if (available == 0) {
+    if ((!mEntryHasDataDescriptor) &&
+        (mEntryCompressedRead >= mEntryCompressedSize)) {
+      throw RuntimeError(__FILE__, __LINE__,
+                         QString(tr("Invalid compressed data in ZIP file: %1"))
+                             .arg(mEntryName));
+    }
+    return false;  // need more data
+  }
+  z_stream& stream = *mInflateStream;
+  stream.next_in   = reinterpret_cast<Bytef*>(const_cast<char*>(p));
+  stream.avail_in  = static_cast<uInt>(available);
+  int result       = Z_OK;
+  do {
+    stream.next_out  = reinterpret_cast<Bytef*>(mInflateBuffer.data());
+    stream.avail_out = static_cast<uInt>(mInflateBuffer.size());
+    result           = inflate(&stream, Z_NO_FLUSH);
+    if ((result != Z_OK) && (result != Z_STREAM_END) &&
+        (result != Z_BUF_ERROR)) {
+      throw RuntimeError(__FILE__, __LINE__,
+                         QString(tr("Invalid compressed data in ZIP file: %1"))
+                             .arg(mEntryName));
+    }
+    writeEntryData(mInflateBuffer.constData(),
+                   mInflateBuffer.size() - stream.avail_out);  // can throw
+  } while ((result == Z_OK) && ((stream.avail_in > 0) ||
+                                (stream.avail_out == 0)));
+  int consumed = static_cast<int>(available - stream.avail_in);
+  mBufferPos += consumed;
+  mEntryCompressedRead += consumed;
+  if (result != Z_STREAM_END) {
+    return consumed > 0;  // need more data
+  }
+  endInflate();
+  if (mEntryHasDataDescriptor) {
+    mState = State::DataDescriptor;
+  } else if (mEntryCompressedRead != mEntryCompressedSize) {
+    throw RuntimeError(__FILE__, __LINE__,
+                       QString(tr("Invalid compressed data in ZIP file: %1"))
+                           .arg(mEntryName));
+  } else {
+    closeEntry();  // can throw
+    mState = State::EntryHeader;
+  }
+  return true;
+}
+
+bool ZipStreamExtractor::processDataDescriptor() {
+  const char* p         = mBuffer.constData() + mBufferPos;
+  int         available = mBuffer.size() - mBufferPos;
+  if (available < 4) {
+    return false;
+  }
+  // the signature is optional
+  int offset   = (readUInt32(p) == sDataDescriptorSignature) ? 4 : 0;
+  int sizeSize = mEntryIsZip64 ? 8 : 4;
+  if (available < offset + 4 + 2 * sizeSize) {
+    return false;
+  }
+  mEntryExpectedCrc      = readUInt32(p + offset);
+  quint64 compressedSize = mEntryIsZip64 ? readUInt64(p + offset + 4)
+                                         : readUInt32(p + offset + 4);
+  if (compressedSize != mEntryCompressedRead) {
+    throw RuntimeError(__FILE__, __LINE__,
+                       QString(tr("Invalid compressed data in ZIP file: %1"))
+                           .arg(mEntryName));
+  }
+  mBufferPos += offset + 4 + 2 * sizeSize;
+  closeEntry();  // can throw
+  mState = State::EntryHeader;
+  return true;
+}
+
+void ZipStreamExtractor::writeEntryData(const char* data, int size) {
+  if (size <= 0) {
+    return;
+  }
+  mEntryCrc = crc32(mEntryCrc, reinterpret_cast<const Bytef*>(data),
+                    static_cast<uInt>(size));
+  if (!mEntryFile) {
+    throw RuntimeError(
+        __FILE__, __LINE__,
+        QString(tr("Directory entry in ZIP file contains data: %1"))
+            .arg(mEntryName));
+  } else if (mEntryFile->write(data, size) != size) {
+    throw RuntimeError(
+        __FILE__, __LINE__,
+        QString(tr("Error while writing file \"%1\": %2"))
+            .arg(mEntryFile->fileName(), mEntryFile->errorString()));
+  }
+}
+
+void ZipStreamExtractor::closeEntry() {
+  if (mEntryCrc != mEntryExpectedCrc) {
+    throw RuntimeError(
+        __FILE__, __LINE__,
+        QString(tr("CRC error in ZIP file: %1")).arg(mEntryName));
+  }
+  if (mEntryFile) {
+    if (!mEntryFile->flush()) {
+      throw RuntimeError(
+          __FILE__, __LINE__,
+          QString(tr("Error while writing file \"%1\": %2"))
+              .arg(mEntryFile->fileName(), mEntryFile->errorString()));
+    }
+    mEntryFile.reset();
+  }
+}
+
+void ZipStreamExtractor::endInflate() noexcept {
+  if (mInflateStream) {
+    inflateEnd(mInflateStream.data());
+    mInflateStream.reset();
+  }
+}
+
+quint16 ZipStreamExtractor::readUInt16(const char* p) noexcept {
+  return qFromLittleEndian<quint16>(reinterpret_cast<const uchar*>(p));
+}
+
+quint32 ZipStreamExtractor::readUInt32(const char* p) noexcept {
+  return qFromLittleEndian<quint32>(reinterpret_cast<const uchar*>(p));
+}
+
+quint64 ZipStreamExtractor::readUInt64(const char* p) noexcept {
+  return qFromLittleEndian<quint64>(reinterpret_cast<const uchar*>(p));
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace librepcb
@@ -0,0 +1,151 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_ZIPSTREAMEXTRACTOR_H
+#define LIBREPCB_ZIPSTREAMEXTRACTOR_H
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "filepath.h"
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace / Forward Declarations
+ ******************************************************************************/
+struct z_stream_s;
+
+namespace librepcb {
+
+/*******************************************************************************
+ *  Class ZipStreamExtractor
+ ******************************************************************************/
+
+/**
+ * @brief Extracts a ZIP file while its content is still being received
+ *
+ * The data of the ZIP file is passed in arbitrary chunks to #addData() (e.g.
+ * as received from the network) and every entry is written to the destination
+ * directory as soon as its data is available. Only the local file headers are
+ * evaluated, the central directory at the end of the file is ignored.
+ *
+ * Supported are "stored" and "deflated" entries (also in Zip64 format) and
+ * deflated entries with a trailing data descriptor. The CRC32 of every entry
+ * is verified. Encrypted entries and stored entries with a data descriptor are
+ * not supported, for these #addData() throws an exception and the caller
+ * should fall back to extracting the complete ZIP file.
+ *
+ * @note Extracted files are not removed if an error occurs, use
+ *       #getExtractedFiles() to clean them up if needed.
+ */
+class ZipStreamExtractor final {
+  Q_DECLARE_TR_FUNCTIONS(ZipStreamExtractor)
+
+public:
+  // Constructors / Destructor
+  ZipStreamExtractor()                                = delete;
+  ZipStreamExtractor(const ZipStreamExtractor& other) = delete;
+
+  /**
+   * @brief Constructor
+   *
+   * @param destDir   The directory to extract the files into (may or may not
+   *                  exist)
+   */
+  explicit ZipStreamExtractor(const FilePath& destDir) noexcept;
+  ~ZipStreamExtractor() noexcept;
+
+  // Getters
+  const FilePath& getDestinationDir() const noexcept { return mDestDir; }
+  bool isFinished() const noexcept { return mState == State::Finished; }
+
+  /**
+   * @brief Get all files (not directories) extracted so far
+   *
+   * @return Paths of all completely or partially extracted files
+   */
+  const QList<FilePath>& getExtractedFiles() const noexcept {
+    return mExtractedFiles;
+  }
+
+  // General Methods
+
+  /**
+   * @brief Process the next chunk of the ZIP file
+   *
+   * @param data      The next bytes of the ZIP file
+   *
+   * @throw Exception if the data is invalid, not supported or if writing a
+   *                  file failed
+   */
+  void addData(const QByteArray& data);
+
+  /**
+   * @brief Check that the whole ZIP file was received and extracted
+   *
+   * @throw Exception if the ZIP file is incomplete
+   */
+  void finish();
+
+  // Operator Overloadings
+  ZipStreamExtractor& operator=(const ZipStreamExtractor& rhs) = delete;
+
+private:  // Types
+  enum class State { EntryHeader, EntryData, DataDescriptor, Finished };
+
+private:  // Methods
+  bool           processEntryHeader();
+  bool           processEntryData();
+  bool           processDataDescriptor();
+  void           writeEntryData(const char* data, int size);
+  void           closeEntry();
+  void           endInflate() noexcept;
+  static quint16 readUInt16(const char* p) noexcept;
+  static quint32 readUInt32(const char* p) noexcept;
+  static quint64 readUInt64(const char* p) noexcept;
+
+private:  // Data
+  FilePath                   mDestDir;
+  State                      mState;
+  QByteArray                 mBuffer;     ///< Received, unprocessed data
+  int                        mBufferPos;  ///< Processed bytes in #mBuffer
+  QList<FilePath>            mExtractedFiles;
+  QByteArray                 mInflateBuffer;
+  QScopedPointer<z_stream_s> mInflateStream;  ///< Only set while inflating
+
+  // Current entry
+  QString               mEntryName;
+  QScopedPointer<QFile> mEntryFile;  ///< nullptr for directories
+  quint16               mEntryMethod;
+  bool                  mEntryHasDataDescriptor;
+  bool                  mEntryIsZip64;
+  quint32               mEntryExpectedCrc;
+  quint64               mEntryCompressedSize;  ///< Unknown if data descriptor
+  quint64               mEntryCompressedRead;
+  quint32               mEntryCrc;
+};
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace librepcb
+
+#endif  // LIBREPCB_ZIPSTREAMEXTRACTOR_H
@@ -22,9 +22,6 @@
  ******************************************************************************/
 #include "strokefont.h"
 
-#include <fontobene/font.h>
-#include <fontobene/glyphlistaccessor.h>
-
 #include <QtConcurrent/QtConcurrent>
 #include <QtCore>
 
@@ -33,24 +30,27 @@
  ******************************************************************************/
 namespace librepcb {
 
-namespace fb = fontobene;
-
 /*******************************************************************************
  *  Constructors / Destructor
  ******************************************************************************/
 
 StrokeFont::StrokeFont(const FilePath&   fontFilePath,
-                       const QByteArray& content) noexcept
-  : QObject(nullptr), mFilePath(fontFilePath) {
+                       const QByteArray& content,
+                       const FilePath&   cacheDir) noexcept
+  : QObject(nullptr), mFilePath(fontFilePath), mStrokeCache(1000) {
   // load the font in another thread because it takes some time to load it
   qDebug() << "Start loading font" << mFilePath.toNative();
-  mFuture = QtConcurrent::run([content]() {
-    QTextStream s(content);
-    return fb::Font(s);
+  mFuture = QtConcurrent::run([content, cacheDir]() {
+    return StrokeFontCache::load(cacheDir, content);  // can throw
   });
-  connect(&mWatcher, &QFutureWatcher<fb::Font>::finished, this,
-          &StrokeFont::fontLoaded);
-  mWatcher.setFuture(mFuture);
+  // Get notified about the loaded font only if there is an event loop, since
+  // the font may also be created in a worker thread (it's shared between all
+  // threads). Without notification, the font is processed when accessed.
+  if (thread()->eventDispatcher()) {
+    connect(&mWatcher, &QFutureWatcher<StrokeFontCache::Font>::finished, this,
+            &StrokeFont::fontLoaded);
+    mWatcher.setFuture(mFuture);
+  }
 }
 
 StrokeFont::~StrokeFont() noexcept {
@@ -61,13 +61,13 @@ StrokeFont::~StrokeFont() noexcept {
  ******************************************************************************/
 
 Ratio StrokeFont::getLetterSpacing() const noexcept {
-  accessor();  // block until the font is loaded.
-  return Ratio::fromNormalized(mFont->header.letterSpacing / 9);
+  return Ratio::fromNormalized(font().letterSpacing /
+                               9);  // blocks until the font is loaded
 }
 
 Ratio StrokeFont::getLineSpacing() const noexcept {
-  accessor();  // block until the font is loaded.
-  return Ratio::fromNormalized(mFont->header.lineSpacing / 9);
+  return Ratio::fromNormalized(font().lineSpacing /
+                               9);  // blocks until the font is loaded
 }
 
 /*******************************************************************************
@@ -80,8 +80,122 @@ QVector<Path> StrokeFont::stroke(const QString&        text,
                                  const Length&         lineSpacing,
                                  const Alignment& align, Point& bottomLeft,
                                  Point& topRight) const noexcept {
-  accessor();  // block until the font is loaded. TODO: abort instead of
-               // waiting?
+  QString key = QString("%1|%2|%3|%4|")
+                    .arg(height->toNm())
+                    .arg(letterSpacing.toNm())
+                    .arg(lineSpacing.toNm())
+                    .arg(static_cast<int>(align.toQtAlign())) %
+                text;
+  {
+    QMutexLocker        lock(&mCacheMutex);
+    const StrokeResult* cached = mStrokeCache.object(key);
+    if (cached) {
+      bottomLeft = cached->bottomLeft;
+      topRight   = cached->topRight;
+      return cached->paths;
+    }
+  }
+
+  QVector<Path> paths = strokeUncached(text, height, letterSpacing,
+                                       lineSpacing, align, bottomLeft,
+                                       topRight);
+  QMutexLocker lock(&mCacheMutex);
+  mStrokeCache.insert(key, new StrokeResult{paths, bottomLeft, topRight});
+  return paths;
+}
+
+QVector<QPair<QVector<Path>, Length>> StrokeFont::strokeLines(
+    const QString& text, const PositiveLength& height,
+    const Length& letterSpacing, Length& width) const noexcept {
+  QVector<QPair<QVector<Path>, Length>> result;
+  foreach (const QString& line, text.split('\n')) {
+    QPair<QVector<Path>, Length> pair;
+    pair.first = strokeLine(line, height, letterSpacing, pair.second);
+    result.append(pair);
+    if (pair.second > width) width = pair.second;
+  }
+  return result;
+}
+
+QVector<Path> StrokeFont::strokeLine(const QString&        text,
+                                     const PositiveLength& height,
+                                     const Length&         letterSpacing,
+                                     Length& width) const noexcept {
+  QVector<Path> paths;
+  Length        offset = 0;
+  width                = 0;  // same as offset, but without last letter spacing
+  for (int i = 0; i < text.length(); ++i) {
+    Glyph glyph = getGlyph(text.at(i), height);
+    if (!glyph.paths.isEmpty()) {
+      Length shift = (i == 0) ? -glyph.bottomLeft.getX()
+                              : 0;  // left-align first character
+      foreach (const Path& p, glyph.paths) {
+        paths.append(p.translated(Point(offset + shift, Length(0))));
+      }
+      width = offset + glyph.topRight.getX() +
+              shift;  // do *not* count glyph spacing as width!
+      offset = width + glyph.spacing + letterSpacing;
+    } else if (glyph.spacing != 0) {
+      // it's a whitespace-only glyph -> count additional glyph spacing as width
+      width  = offset + glyph.spacing;
+      offset = width + letterSpacing;
+    }
+  }
+  return paths;
+}
+
+QVector<Path> StrokeFont::strokeGlyph(const QChar&          glyph,
+                                      const PositiveLength& height,
+                                      Length& spacing) const noexcept {
+  Glyph g = getGlyph(glyph, height);
+  spacing = g.spacing;
+  return g.paths;
+}
+
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+StrokeFont::Glyph StrokeFont::getGlyph(const QChar&          glyph,
+                                       const PositiveLength& height) const
+    noexcept {
+  QPair<uint, LengthBase_t> key(glyph.unicode(), height->toNm());
+  QMutexLocker              lock(&mCacheMutex);
+  auto                      it = mGlyphCache.constFind(key);
+  if (it != mGlyphCache.constEnd()) {
+    return *it;
+  }
+
+  // Glyphs which don't exist in the font are replaced by U+FFFD REPLACEMENT
+  // CHARACTER (other replacements are already resolved by StrokeFontCache).
+  const QHash<uint, StrokeFontCache::Glyph>& glyphs = font().glyphs;
+  auto cached = glyphs.constFind(glyph.unicode());
+  if (cached == glyphs.constEnd()) {
+    cached = glyphs.constFind(0xFFFD);
+  }
+  Glyph g;
+  if (cached != glyphs.constEnd()) {
+    g.spacing = convertLength(height, cached->spacing);
+    g.paths   = polylines2paths(cached->polylines, height);
+    if (!g.paths.isEmpty()) {
+      computeBoundingRect(g.paths, g.bottomLeft, g.topRight);
+    }
+  } else {
+    qWarning() << "Failed to load stroke font glyph" << glyph;
+  }
+  mGlyphCache.insert(key, g);
+  return g;
+}
+
+QVector<Path> StrokeFont::strokeUncached(const QString&        text,
+                                         const PositiveLength& height,
+                                         const Length&         letterSpacing,
+                                         const Length&         lineSpacing,
+                                         const Alignment& align,
+                                         Point& bottomLeft, Point& topRight) const
+    noexcept {
+  font();  // block until the font is loaded. TODO: abort instead of
+           // waiting?
   QVector<Path>                         paths;
   Length                                totalWidth;
   QVector<QPair<QVector<Path>, Length>> lines =
@@ -133,122 +247,51 @@ QVector<Path> StrokeFont::stroke(const QString&        text,
   return paths;
 }
 
-QVector<QPair<QVector<Path>, Length>> StrokeFont::strokeLines(
-    const QString& text, const PositiveLength& height,
-    const Length& letterSpacing, Length& width) const noexcept {
-  QVector<QPair<QVector<Path>, Length>> result;
-  foreach (const QString& line, text.split('\n')) {
-    QPair<QVector<Path>, Length> pair;
-    pair.first = strokeLine(line, height, letterSpacing, pair.second);
-    result.append(pair);
-    if (pair.second > width) width = pair.second;
-  }
-  return result;
-}
-
-QVector<Path> StrokeFont::strokeLine(const QString&        text,
-                                     const PositiveLength& height,
-                                     const Length&         letterSpacing,
-                                     Length& width) const noexcept {
-  QVector<Path> paths;
-  Length        offset = 0;
-  width                = 0;  // same as offset, but without last letter spacing
-  for (int i = 0; i < text.length(); ++i) {
-    Length        glyphSpacing;
-    QVector<Path> glyphPaths = strokeGlyph(text.at(i), height, glyphSpacing);
-    if (!glyphPaths.isEmpty()) {
-      Point bottomLeft, topRight;
-      computeBoundingRect(glyphPaths, bottomLeft, topRight);
-      Length shift =
-          (i == 0) ? -bottomLeft.getX() : 0;  // left-align first character
-      foreach (const Path& p, glyphPaths) {
-        paths.append(p.translated(Point(offset + shift, Length(0))));
-      }
-      width = offset + topRight.getX() +
-              shift;  // do *not* count glyph spacing as width!
-      offset = width + glyphSpacing + letterSpacing;
-    } else if (glyphSpacing != 0) {
-      // it's a whitespace-only glyph -> count additional glyph spacing as width
-      width  = offset + glyphSpacing;
-      offset = width + letterSpacing;
-    }
-  }
-  return paths;
-}
-
-QVector<Path> StrokeFont::strokeGlyph(const QChar&          glyph,
-                                      const PositiveLength& height,
-                                      Length& spacing) const noexcept {
-  try {
-    qreal                 glyphSpacing = 0;
-    QVector<fb::Polyline> polylines =
-        accessor().getAllPolylinesOfGlyph(glyph.unicode(),
-                                          &glyphSpacing);  // can throw
-    spacing = convertLength(height, glyphSpacing);
-    return polylines2paths(polylines, height);
-  } catch (const fb::Exception& e) {
-    qWarning() << "Failed to load stroke font glyph" << glyph;
-    spacing = 0;
-    return QVector<Path>();
-  }
-}
-
-/*******************************************************************************
- *  Private Methods
- ******************************************************************************/
-
 void StrokeFont::fontLoaded() noexcept {
-  accessor();  // trigger the message about loading succeeded or failed
+  font();  // trigger the message about loading succeeded or failed
 }
 
-const fb::GlyphListAccessor& StrokeFont::accessor() const noexcept {
+const StrokeFontCache::Font& StrokeFont::font() const noexcept {
+  QMutexLocker lock(&mFontMutex);
   if (!mFont) {
     try {
-      mFont.reset(new fb::Font(mFuture.result()));  // can throw
+      mFont.reset(new StrokeFontCache::Font(mFuture.result()));  // can throw
       qDebug() << "Successfully loaded font" << mFilePath.toNative() << "with"
                << mFont->glyphs.count() << "glyphs";
-    } catch (const fb::Exception& e) {
-      mFont.reset(new fb::Font());
+    } catch (const Exception& e) {
+      mFont.reset(new StrokeFontCache::Font());
       qCritical() << "Failed to load font" << mFilePath.toNative();
-      qCritical() << "Error:" << e.msg();
+      qCritical() << "Error:" << e.getMsg();
     }
-
-    mGlyphListCache.reset(new fb::GlyphListCache(mFont->glyphs));
-    mGlyphListCache->setReplacementGlyph(
-        0xFFFD);  // U+FFFD REPLACEMENT CHARACTER
-    mGlyphListCache->addReplacements(
-        {0x00B5, 0x03BC});  // MICRO SIGN <-> GREEK SMALL LETTER MU
-    mGlyphListCache->addReplacements(
-        {0x2126, 0x03A9});  // OHM SIGN <-> GREEK CAPITAL LETTER OMEGA
-
-    mGlyphListAccessor.reset(new fb::GlyphListAccessor(*mGlyphListCache));
   }
-  return *mGlyphListAccessor;
+  return *mFont;
 }
 
 QVector<Path> StrokeFont::polylines2paths(
-    const QVector<fb::Polyline>& polylines,
-    const PositiveLength&        height) noexcept {
+    const QVector<QVector<StrokeFontCache::Vertex>>& polylines,
+    const PositiveLength&                            height) noexcept {
   QVector<Path> paths;
-  foreach (const fb::Polyline& p, polylines) {
+  foreach (const QVector<StrokeFontCache::Vertex>& p, polylines) {
     if (p.isEmpty()) continue;
     paths.append(polyline2path(p, height));
   }
   return paths;
 }
 
-Path StrokeFont::polyline2path(const fb::Polyline&   p,
+Path StrokeFont::polyline2path(const QVector<StrokeFontCache::Vertex>& p,
                                const PositiveLength& height) noexcept {
   Path path;
-  foreach (const fb::Vertex& v, p) { path.addVertex(convertVertex(v, height)); }
+  foreach (const StrokeFontCache::Vertex& v, p) {
+    path.addVertex(convertVertex(v, height));
+  }
   return path;
 }
 
-Vertex StrokeFont::convertVertex(const fb::Vertex&     v,
-                                 const PositiveLength& height) noexcept {
-  return Vertex(
-      Point::fromMm(v.scaledX(height->toMm()), v.scaledY(height->toMm())),
-      Angle::fromDeg(v.scaledBulge(180)));
+Vertex StrokeFont::convertVertex(const StrokeFontCache::Vertex& v,
+                                 const PositiveLength&          height) noexcept {
+  qreal scale = height->toMm() / 9;
+  return Vertex(Point::fromMm(v.x * scale, v.y * scale),
+                Angle::fromDeg(v.bulge));
 }
 
 Length StrokeFont::convertLength(const PositiveLength& height,
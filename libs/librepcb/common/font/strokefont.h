@@ -26,20 +26,13 @@
 #include "../alignment.h"
 #include "../fileio/filepath.h"
 #include "../geometry/path.h"
+#include "strokefontcache.h"
 
 #include <QtCore>
 
 /*******************************************************************************
  *  Namespace / Forward Declarations
  ******************************************************************************/
-namespace fontobene {
-struct Vertex;
-struct Polyline;
-struct Font;
-class GlyphListCache;
-class GlyphListAccessor;
-}  // namespace fontobene
-
 namespace librepcb {
 
 /*******************************************************************************
@@ -48,13 +41,21 @@ namespace librepcb {
 
 /**
  * @brief The StrokeFont class
+ *
+ * The stroked glyphs and the results of #stroke() are cached (per font and
+ * text height) since the same glyphs and texts are stroked again and again,
+ * for example when many footprints show the same "{{VALUE}}" text.
+ *
+ * The font file is loaded through librepcb::StrokeFontCache, so usually it
+ * does not need to be parsed at all.
  */
 class StrokeFont final : public QObject {
   Q_OBJECT
 
 public:
   // Constructors / Destructor
-  StrokeFont(const FilePath& fontFilePath, const QByteArray& content) noexcept;
+  StrokeFont(const FilePath& fontFilePath, const QByteArray& content,
+             const FilePath& cacheDir = FilePath()) noexcept;
   StrokeFont(const StrokeFont& other) = delete;
   ~StrokeFont() noexcept;
 
@@ -79,28 +80,53 @@ public:
   // Operator Overloadings
   StrokeFont& operator=(const StrokeFont& rhs) = delete;
 
-private:
-  void                                fontLoaded() noexcept;
-  const fontobene::GlyphListAccessor& accessor() const noexcept;
-  static QVector<Path>                polylines2paths(
-                     const QVector<fontobene::Polyline>& polylines,
-                     const PositiveLength&               height) noexcept;
-  static Path   polyline2path(const fontobene::Polyline& p,
-                              const PositiveLength&      height) noexcept;
-  static Vertex convertVertex(const fontobene::Vertex& v,
-                              const PositiveLength&    height) noexcept;
+private:  // Types
+  struct Glyph {
+    QVector<Path> paths;
+    Length        spacing;
+    Point         bottomLeft;
+    Point         topRight;
+  };
+  struct StrokeResult {
+    QVector<Path> paths;
+    Point         bottomLeft;
+    Point         topRight;
+  };
+
+private:  // Methods
+  Glyph getGlyph(const QChar& glyph, const PositiveLength& height) const
+      noexcept;
+  QVector<Path> strokeUncached(const QString&        text,
+                               const PositiveLength& height,
+                               const Length&         letterSpacing,
+                               const Length&         lineSpacing,
+                               const Alignment& align, Point& bottomLeft,
+                               Point& topRight) const noexcept;
+  void                          fontLoaded() noexcept;
+  const StrokeFontCache::Font&  font() const noexcept;
+  static QVector<Path>          polylines2paths(
+               const QVector<QVector<StrokeFontCache::Vertex>>& polylines,
+               const PositiveLength&                            height) noexcept;
+  static Path   polyline2path(const QVector<StrokeFontCache::Vertex>& p,
+                              const PositiveLength& height) noexcept;
+  static Vertex convertVertex(const StrokeFontCache::Vertex& v,
+                              const PositiveLength&          height) noexcept;
   Length        convertLength(const PositiveLength& height, qreal length) const
       noexcept;
   static void computeBoundingRect(const QVector<Path>& paths, Point& bottomLeft,
                                   Point& topRight) noexcept;
 
 private:  // Data
-  FilePath                                             mFilePath;
-  QFuture<fontobene::Font>                             mFuture;
-  QFutureWatcher<fontobene::Font>                      mWatcher;
-  mutable QScopedPointer<fontobene::Font>              mFont;
-  mutable QScopedPointer<fontobene::GlyphListCache>    mGlyphListCache;
-  mutable QScopedPointer<fontobene::GlyphListAccessor> mGlyphListAccessor;
+  FilePath                                           mFilePath;
+  QFuture<StrokeFontCache::Font>                     mFuture;
+  QFutureWatcher<StrokeFontCache::Font>              mWatcher;
+  mutable QMutex                                     mFontMutex;
+  mutable QScopedPointer<const StrokeFontCache::Font> mFont;
+
+  // Caches
+  mutable QMutex                                  mCacheMutex;
+  mutable QHash<QPair<uint, LengthBase_t>, Glyph> mGlyphCache;
+  mutable QCache<QString, StrokeResult>           mStrokeCache;
 };
 
 /*******************************************************************************
@@ -0,0 +1,266 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "strokefontcache.h"
+
+#include "../exceptions.h"
+#include "../fileio/fileutils.h"
+
+#include <fontobene/font.h>
+#include <fontobene/glyphlistaccessor.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+
+namespace fb = fontobene;
+
+/*******************************************************************************
+ *  Static Variables
+ ******************************************************************************/
+
+QMutex   StrokeFontCache::sDirectoryMutex;
+bool     StrokeFontCache::sDirectorySet = false;
+FilePath StrokeFontCache::sDirectory;
+
+/*******************************************************************************
+ *  General Methods
+ ******************************************************************************/
+
+StrokeFontCache::Font StrokeFontCache::load(const FilePath&   cacheDir,
+                                            const QByteArray& content) {
+  if (!cacheDir.isValid()) {
+    return compile(content);  // can throw
+  }
+
+  QByteArray hash =
+      QCryptographicHash::hash(content, QCryptographicHash::Sha256);
+  FilePath fp =
+      cacheDir.getPathTo(QString::fromLatin1(hash.toHex()) % ".lpsfc");
+  Font font;
+  if (readCacheFile(fp, hash, font)) {
+    return font;
+  }
+
+  font = compile(content);  // can throw
+  try {
+    FileUtils::writeFile(fp, serialize(font, hash));  // can throw
+    qDebug() << "Wrote stroke font cache file" << fp.toNative();
+  } catch (const Exception& e) {
+    // not critical, the font is just parsed again next time
+    qWarning() << "Failed to write stroke font cache:" << e.getMsg();
+  }
+  return font;
+}
+
+StrokeFontCache::Font StrokeFontCache::compile(const QByteArray& content) {
+  try {
+    QTextStream s(content);
+    fb::Font    fbFont(s);  // can throw
+
+    fb::GlyphListCache cache(fbFont.glyphs);
+    cache.setReplacementGlyph(0xFFFD);  // U+FFFD REPLACEMENT CHARACTER
+    cache.addReplacements(
+        {0x00B5, 0x03BC});  // MICRO SIGN <-> GREEK SMALL LETTER MU
+    cache.addReplacements(
+        {0x2126, 0x03A9});  // OHM SIGN <-> GREEK CAPITAL LETTER OMEGA
+    fb::GlyphListAccessor accessor(cache);
+
+    // Resolve all glyphs of the font, and additionally the replacements
+    // since they may refer to glyphs not contained in the font. Any other
+    // missing glyph is later mapped to the replacement character.
+    QSet<uint> codepoints = {0xFFFD, 0x00B5, 0x03BC, 0x2126, 0x03A9};
+    foreach (const fb::Glyph& glyph, fbFont.glyphs) {
+      codepoints.insert(glyph.codepoint);
+    }
+
+    Font font;
+    font.letterSpacing = fbFont.header.letterSpacing;
+    font.lineSpacing   = fbFont.header.lineSpacing;
+    foreach (uint codepoint, codepoints) {
+      try {
+        Glyph                 glyph;
+        QVector<fb::Polyline> polylines =
+            accessor.getAllPolylinesOfGlyph(codepoint,
+                                            &glyph.spacing);  // can throw
+        foreach (const fb::Polyline& polyline, polylines) {
+          if (polyline.isEmpty()) continue;
+          QVector<Vertex> vertices;
+          vertices.reserve(polyline.count());
+          foreach (const fb::Vertex& v, polyline) {
+            vertices.append(
+                Vertex{v.scaledX(9), v.scaledY(9), v.scaledBulge(180)});
+          }
+          glyph.polylines.append(vertices);
+        }
+        font.glyphs.insert(codepoint, glyph);
+      } catch (const fb::Exception& e) {
+        // glyph not available (e.g. a replacement without replacement glyph)
+      }
+    }
+    return font;
+  } catch (const fb::Exception& e) {
+    throw RuntimeError(__FILE__, __LINE__,
+                       QString(tr("Failed to parse stroke font: %1"))
+                           .arg(e.msg()));
+  }
+}
+
+QByteArray StrokeFontCache::serialize(const Font&       font,
+                                      const QByteArray& sourceHash) noexcept {
+  QByteArray  data;
+  QDataStream s(&data, QIODevice::WriteOnly);
+  s.setVersion(QDataStream::Qt_5_2);
+  s.setFloatingPointPrecision(QDataStream::DoublePrecision);
+  s << sMagic << sVersion << sourceHash;
+  s << static_cast<double>(font.letterSpacing)
+    << static_cast<double>(font.lineSpacing);
+  s << static_cast<quint32>(font.glyphs.count());
+  for (auto it = font.glyphs.constBegin(); it != font.glyphs.constEnd(); ++it) {
+    s << static_cast<quint32>(it.key()) << static_cast<double>(it->spacing);
+    s << static_cast<quint32>(it->polylines.count());
+    foreach (const QVector<Vertex>& polyline, it->polylines) {
+      s << static_cast<quint32>(polyline.count());
+      foreach (const Vertex& v, polyline) {
+        s << static_cast<double>(v.x) << static_cast<double>(v.y)
+          << static_cast<double>(v.bulge);
+      }
+    }
+  }
+  return data;
+}
+
+bool StrokeFontCache::deserialize(const QByteArray& data,
+                                  const QByteArray& sourceHash,
+                                  Font&             font) noexcept {
+  QDataStream s(data);
+  s.setVersion(QDataStream::Qt_5_2);
+  s.setFloatingPointPrecision(QDataStream::DoublePrecision);
+
+  quint32    magic = 0, version = 0;
+  QByteArray hash;
+  s >> magic >> version >> hash;
+  if ((magic != sMagic) || (version != sVersion) || (hash != sourceHash)) {
+    return false;
+  }
+
+  // Note: All counts are checked against the data size to avoid huge memory
+  // allocations in case of a corrupt file.
+  Font    result;
+  double  letterSpacing = 0, lineSpacing = 0;
+  quint32 glyphCount = 0;
+  s >> letterSpacing >> lineSpacing >> glyphCount;
+  if (glyphCount > static_cast<quint32>(data.size())) return false;
+  result.letterSpacing = letterSpacing;
+  result.lineSpacing   = lineSpacing;
+  result.glyphs.reserve(glyphCount);
+  for (quint32 i = 0; i < glyphCount; ++i) {
+    quint32 codepoint = 0, polylineCount = 0;
+    double  spacing = 0;
+    s >> codepoint >> spacing >> polylineCount;
+    if (polylineCount > static_cast<quint32>(data.size())) return false;
+    Glyph glyph;
+    glyph.spacing = spacing;
+    glyph.polylines.reserve(polylineCount);
+    for (quint32 k = 0; k < polylineCount; ++k) {
+      quint32 vertexCount = 0;
+      s >> vertexCount;
+      if (vertexCount > static_cast<quint32>(data.size())) return false;
+      QVector<Vertex> vertices;
+      vertices.reserve(vertexCount);
+      for (quint32 n = 0; n < vertexCount; ++n) {
+        double x = 0, y = 0, bulge = 0;
+        s >> x >> y >> bulge;
+        vertices.append(Vertex{x, y, bulge});
+      }
+      glyph.polylines.append(vertices);
+    }
+    result.glyphs.insert(codepoint, glyph);
+  }
+  if ((s.status() != QDataStream::Ok) || (!s.atEnd())) {
+    return false;
+  }
+  font = result;
+  return true;
+}
+
+FilePath StrokeFontCache::getDirectory() noexcept {
+  QMutexLocker lock(&sDirectoryMutex);
+  return sDirectorySet ? sDirectory : getDefaultDirectory();
+}
+
+void StrokeFontCache::setDirectory(const FilePath& dir) noexcept {
+  QMutexLocker lock(&sDirectoryMutex);
+  sDirectorySet = true;
+  sDirectory    = dir;
+}
+
+FilePath StrokeFontCache::getDefaultDirectory() noexcept {
+  QString dir = qgetenv("LIBREPCB_CACHE_DIR");
+  if (dir.isEmpty()) {
+    dir = QStandardPaths::writableLocation(QStandardPaths::CacheLocation);
+  }
+  if (dir.isEmpty()) {
+    return FilePath();
+  }
+  return FilePath(dir).getPathTo("stroke_fonts");
+}
+
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+bool StrokeFontCache::readCacheFile(const FilePath&   fp,
+                                    const QByteArray& sourceHash,
+                                    Font&             font) noexcept {
+  QFile file(fp.toStr());
+  if ((!file.exists()) || (!file.open(QIODevice::ReadOnly))) {
+    return false;
+  }
+
+  // Map the file into memory to avoid copying it into a buffer. If mapping is
+  // not supported, fall back to reading it.
+  bool        success = false;
+  qint64      size    = file.size();
+  const char* mapped  = reinterpret_cast<const char*>(file.map(0, size));
+  if (mapped) {
+    success = deserialize(
+        QByteArray::fromRawData(mapped, static_cast<int>(size)), sourceHash,
+        font);
+    file.unmap(reinterpret_cast<uchar*>(const_cast<char*>(mapped)));
+  } else {
+    success = deserialize(file.readAll(), sourceHash, font);
+  }
+  if (!success) {
+    qWarning() << "Ignoring invalid stroke font cache file" << fp.toNative();
+  }
+  return success;
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace librepcb
@@ -0,0 +1,172 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_STROKEFONTCACHE_H
+#define LIBREPCB_STROKEFONTCACHE_H
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "../fileio/filepath.h"
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace / Forward Declarations
+ ******************************************************************************/
+namespace librepcb {
+
+/*******************************************************************************
+ *  Class StrokeFontCache
+ ******************************************************************************/
+
+/**
+ * @brief Binary cache of compiled stroke fonts
+ *
+ * Parsing a FontoBene (*.bene) font file takes a considerable amount of time,
+ * and it is done on every application start and for every opened project.
+ * This class "compiles" a font file into the data actually needed for
+ * stroking texts (all references and replacements resolved), and stores it as
+ * a versioned binary file in a cache directory. The cache file is named by the
+ * SHA-256 hash of the font file content, so a modified font file automatically
+ * leads to a new cache entry.
+ *
+ * Cache files are memory-mapped for reading. Invalid, outdated or corrupt
+ * cache files are simply ignored and overwritten.
+ */
+class StrokeFontCache final {
+  Q_DECLARE_TR_FUNCTIONS(StrokeFontCache)
+
+public:
+  // Types
+  struct Vertex {
+    qreal x;      ///< Unscaled X coordinate (font height = 9)
+    qreal y;      ///< Unscaled Y coordinate (font height = 9)
+    qreal bulge;  ///< Bulge in degrees
+
+    bool operator==(const Vertex& rhs) const noexcept {
+      return (x == rhs.x) && (y == rhs.y) && (bulge == rhs.bulge);
+    }
+  };
+  struct Glyph {
+    qreal                    spacing;    ///< Unscaled (font height = 9)
+    QVector<QVector<Vertex>> polylines;  ///< Including referenced glyphs
+
+    bool operator==(const Glyph& rhs) const noexcept {
+      return (spacing == rhs.spacing) && (polylines == rhs.polylines);
+    }
+  };
+  struct Font {
+    qreal              letterSpacing;  ///< Unscaled (font height = 9)
+    qreal              lineSpacing;    ///< Unscaled (font height = 9)
+    QHash<uint, Glyph> glyphs;
+
+    Font() noexcept : letterSpacing(0), lineSpacing(0), glyphs() {}
+  };
+
+  // Constructors / Destructor
+  StrokeFontCache()                             = delete;
+  StrokeFontCache(const StrokeFontCache& other) = delete;
+  ~StrokeFontCache()                            = delete;
+
+  // General Methods
+
+  /**
+   * @brief Get the compiled data of a font, using the cache if possible
+   *
+   * @param cacheDir    The cache directory. If invalid, the cache is bypassed.
+   * @param content     Content of the FontoBene font file.
+   *
+   * @return The compiled font.
+   *
+   * @throw Exception if the font could not be parsed.
+   */
+  static Font load(const FilePath& cacheDir, const QByteArray& content);
+
+  /**
+   * @brief Parse and compile a FontoBene font file (without using the cache)
+   *
+   * @param content     Content of the FontoBene font file.
+   *
+   * @return The compiled font.
+   *
+   * @throw Exception if the font could not be parsed.
+   */
+  static Font compile(const QByteArray& content);
+
+  static QByteArray serialize(const Font& font,
+                              const QByteArray& sourceHash) noexcept;
+  static bool       deserialize(const QByteArray& data,
+                                const QByteArray& sourceHash,
+                                Font&             font) noexcept;
+
+  /**
+   * @brief Get the cache directory to be used by all stroke font pools
+   *
+   * @return The directory set by #setDirectory(), or #getDefaultDirectory()
+   *         if no directory was set. If invalid, the cache is bypassed.
+   */
+  static FilePath getDirectory() noexcept;
+
+  /**
+   * @brief Override the cache directory of the whole process
+   *
+   * Intended for tests, to avoid writing into the user's cache location.
+   * Must be called before any stroke font pool is created.
+   *
+   * @param dir   The cache directory. If invalid, the cache is bypassed.
+   */
+  static void setDirectory(const FilePath& dir) noexcept;
+
+  /**
+   * @brief Get the default cache directory
+   *
+   * This is a directory in the user's cache location, since fonts are loaded
+   * before any workspace is opened (and the CLI does not use a workspace).
+   * It can be overridden by the environment variable "LIBREPCB_CACHE_DIR"
+   * (useful for functional testing).
+   *
+   * @return The directory path (may not exist yet).
+   */
+  static FilePath getDefaultDirectory() noexcept;
+
+  // Operator Overloadings
+  StrokeFontCache& operator=(const StrokeFontCache& rhs) = delete;
+
+private:  // Methods
+  static bool readCacheFile(const FilePath& fp, const QByteArray& sourceHash,
+                            Font& font) noexcept;
+
+private:  // Data
+  static const quint32 sMagic   = 0x4C505346;  // "LPSF"
+  static const quint32 sVersion = 1;
+
+  // Directory set by setDirectory()
+  static QMutex   sDirectoryMutex;
+  static bool     sDirectorySet;
+  static FilePath sDirectory;
+};
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace librepcb
+
+#endif  // LIBREPCB_STROKEFONTCACHE_H
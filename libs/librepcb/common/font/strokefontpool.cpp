@@ -23,6 +23,7 @@
 #include "strokefontpool.h"
 
 #include "../fileio/filesystem.h"
+#include "strokefontcache.h"
 
 #include <QtCore>
 
@@ -31,19 +32,27 @@
  ******************************************************************************/
 namespace librepcb {
 
+/*******************************************************************************
+ *  Static Variables
+ ******************************************************************************/
+
+QMutex                                       StrokeFontPool::sSharedFontsMutex;
+QHash<QByteArray, std::weak_ptr<StrokeFont>> StrokeFontPool::sSharedFonts;
+
 /*******************************************************************************
  *  Constructors / Destructor
  ******************************************************************************/
 
 StrokeFontPool::StrokeFontPool(const FileSystem& directory) noexcept {
+  FilePath cacheDir = StrokeFontCache::getDirectory();
   foreach (const QString& filename, directory.getFiles()) {
     FilePath fp = directory.getAbsPath(filename);
     if (fp.getSuffix() != "bene") continue;
     try {
       qDebug() << "Load stroke font:" << filename;
-      mFonts.insert(filename, std::make_shared<StrokeFont>(
-                                  fp,
-                                  directory.read(filename)));  // can throw
+      mFonts.insert(filename,
+                    getSharedFont(fp, directory.read(filename),  // can throw
+                                  cacheDir));
     } catch (const Exception& e) {
       qCritical() << "Failed to load stroke font" << fp.toNative() << ":"
                   << e.getMsg();
@@ -69,6 +78,23 @@ const StrokeFont& StrokeFontPool::getFont(const QString& filename) const {
   }
 }
 
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+std::shared_ptr<StrokeFont> StrokeFontPool::getSharedFont(
+    const FilePath& fp, const QByteArray& content, const FilePath& cacheDir) {
+  QByteArray hash =
+      QCryptographicHash::hash(content, QCryptographicHash::Sha256);
+  QMutexLocker                lock(&sSharedFontsMutex);
+  std::shared_ptr<StrokeFont> font = sSharedFonts.value(hash).lock();
+  if (!font) {
+    font = std::make_shared<StrokeFont>(fp, content, cacheDir);
+    sSharedFonts.insert(hash, font);
+  }
+  return font;
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
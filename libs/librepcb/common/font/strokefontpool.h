@@ -42,6 +42,11 @@ class FileSystem;
 
 /**
  * @brief The StrokeFontPool class
+ *
+ * Fonts are loaded through the stroke font cache located at
+ * librepcb::StrokeFontCache::getDirectory(). In addition, fonts with
+ * identical content are shared between all pools of the process, so opening
+ * many projects (e.g. in the CLI) loads every font only once.
  */
 class StrokeFontPool final {
   Q_DECLARE_TR_FUNCTIONS(StrokeFontPool)
@@ -58,8 +63,17 @@ public:
   // Operator Overloadings
   StrokeFontPool& operator=(const StrokeFontPool& rhs) noexcept;
 
+private:  // Methods
+  static std::shared_ptr<StrokeFont> getSharedFont(const FilePath&   fp,
+                                                   const QByteArray& content,
+                                                   const FilePath& cacheDir);
+
 private:  // Data
   QHash<QString, std::shared_ptr<StrokeFont>> mFonts;
+
+  // Fonts of all pools (key: SHA-256 of the font file content)
+  static QMutex                                       sSharedFontsMutex;
+  static QHash<QByteArray, std::weak_ptr<StrokeFont>> sSharedFonts;
 };
 
 /*******************************************************************************
@@ -118,6 +118,23 @@ void CmdCircleEdit::rotate(const Angle& angle, const Point& center,
  *  Inherited from UndoCommand
  ******************************************************************************/
 
+bool CmdCircleEdit::canMergeWith(const UndoCommand& other) const noexcept {
+  const CmdCircleEdit* cmd = dynamic_cast<const CmdCircleEdit*>(&other);
+  return cmd && (&cmd->mCircle == &mCircle) && isCurrentlyExecuted() &&
+         cmd->isCurrentlyExecuted();
+}
+
+void CmdCircleEdit::mergeWith(const UndoCommand& other) noexcept {
+  Q_ASSERT(canMergeWith(other));
+  const CmdCircleEdit& cmd = dynamic_cast<const CmdCircleEdit&>(other);
+  mNewLayerName  = cmd.mNewLayerName;
+  mNewLineWidth  = cmd.mNewLineWidth;
+  mNewIsFilled   = cmd.mNewIsFilled;
+  mNewIsGrabArea = cmd.mNewIsGrabArea;
+  mNewDiameter   = cmd.mNewDiameter;
+  mNewCenter     = cmd.mNewCenter;
+}
+
 bool CmdCircleEdit::performExecute() {
   performRedo();  // can throw
 
@@ -58,6 +58,10 @@ public:
   void translate(const Point& deltaPos, bool immediate) noexcept;
   void rotate(const Angle& angle, const Point& center, bool immediate) noexcept;
 
+  // Inherited from UndoCommand
+  bool canMergeWith(const UndoCommand& other) const noexcept override;
+  void mergeWith(const UndoCommand& other) noexcept override;
+
   // Operator Overloadings
   CmdCircleEdit& operator=(const CmdCircleEdit& rhs) = delete;
 
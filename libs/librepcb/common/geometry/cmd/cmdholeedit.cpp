@@ -84,6 +84,19 @@ void CmdHoleEdit::setDiameter(const PositiveLength& diameter,
  *  Inherited from UndoCommand
  ******************************************************************************/
 
+bool CmdHoleEdit::canMergeWith(const UndoCommand& other) const noexcept {
+  const CmdHoleEdit* cmd = dynamic_cast<const CmdHoleEdit*>(&other);
+  return cmd && (&cmd->mHole == &mHole) && isCurrentlyExecuted() &&
+         cmd->isCurrentlyExecuted();
+}
+
+void CmdHoleEdit::mergeWith(const UndoCommand& other) noexcept {
+  Q_ASSERT(canMergeWith(other));
+  const CmdHoleEdit& cmd = dynamic_cast<const CmdHoleEdit&>(other);
+  mNewPosition = cmd.mNewPosition;
+  mNewDiameter = cmd.mNewDiameter;
+}
+
 bool CmdHoleEdit::performExecute() {
   performRedo();  // can throw
 
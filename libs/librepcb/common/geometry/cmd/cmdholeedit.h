@@ -56,6 +56,10 @@ public:
   void rotate(const Angle& angle, const Point& center, bool immediate) noexcept;
   void setDiameter(const PositiveLength& diameter, bool immediate) noexcept;
 
+  // Inherited from UndoCommand
+  bool canMergeWith(const UndoCommand& other) const noexcept override;
+  void mergeWith(const UndoCommand& other) noexcept override;
+
   // Operator Overloadings
   CmdHoleEdit& operator=(const CmdHoleEdit& rhs) = delete;
 
@@ -113,6 +113,29 @@ void CmdPolygonEdit::mirror(const Point& center, Qt::Orientation orientation,
  *  Inherited from UndoCommand
  ******************************************************************************/
 
+qint64 CmdPolygonEdit::getMemoryUsage() const noexcept {
+  int vertices = mOldPath.getVertices().capacity() +
+                 mNewPath.getVertices().capacity();
+  return UndoCommand::getMemoryUsage() + sizeof(CmdPolygonEdit) -
+         sizeof(UndoCommand) + vertices * sizeof(Vertex);
+}
+
+bool CmdPolygonEdit::canMergeWith(const UndoCommand& other) const noexcept {
+  const CmdPolygonEdit* cmd = dynamic_cast<const CmdPolygonEdit*>(&other);
+  return cmd && (&cmd->mPolygon == &mPolygon) && isCurrentlyExecuted() &&
+         cmd->isCurrentlyExecuted();
+}
+
+void CmdPolygonEdit::mergeWith(const UndoCommand& other) noexcept {
+  Q_ASSERT(canMergeWith(other));
+  const CmdPolygonEdit& cmd = dynamic_cast<const CmdPolygonEdit&>(other);
+  mNewLayerName  = cmd.mNewLayerName;
+  mNewLineWidth  = cmd.mNewLineWidth;
+  mNewIsFilled   = cmd.mNewIsFilled;
+  mNewIsGrabArea = cmd.mNewIsGrabArea;
+  mNewPath       = cmd.mNewPath;
+}
+
 bool CmdPolygonEdit::performExecute() {
   performRedo();  // can throw
 
@@ -59,6 +59,11 @@ public:
   void mirror(const Point& center, Qt::Orientation orientation,
               bool immediate) noexcept;
 
+  // Inherited from UndoCommand
+  qint64 getMemoryUsage() const noexcept override;
+  bool   canMergeWith(const UndoCommand& other) const noexcept override;
+  void   mergeWith(const UndoCommand& other) noexcept override;
+
   // Operator Overloadings
   CmdPolygonEdit& operator=(const CmdPolygonEdit& rhs) = delete;
 
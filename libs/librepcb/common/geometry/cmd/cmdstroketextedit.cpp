@@ -178,6 +178,28 @@ void CmdStrokeTextEdit::setAutoRotate(bool autoRotate,
  *  Inherited from UndoCommand
  ******************************************************************************/
 
+bool CmdStrokeTextEdit::canMergeWith(const UndoCommand& other) const noexcept {
+  const CmdStrokeTextEdit* cmd = dynamic_cast<const CmdStrokeTextEdit*>(&other);
+  return cmd && (&cmd->mText == &mText) && isCurrentlyExecuted() &&
+         cmd->isCurrentlyExecuted();
+}
+
+void CmdStrokeTextEdit::mergeWith(const UndoCommand& other) noexcept {
+  Q_ASSERT(canMergeWith(other));
+  const CmdStrokeTextEdit& cmd = dynamic_cast<const CmdStrokeTextEdit&>(other);
+  mNewLayerName     = cmd.mNewLayerName;
+  mNewText          = cmd.mNewText;
+  mNewPosition      = cmd.mNewPosition;
+  mNewRotation      = cmd.mNewRotation;
+  mNewHeight        = cmd.mNewHeight;
+  mNewStrokeWidth   = cmd.mNewStrokeWidth;
+  mNewLetterSpacing = cmd.mNewLetterSpacing;
+  mNewLineSpacing   = cmd.mNewLineSpacing;
+  mNewAlign         = cmd.mNewAlign;
+  mNewMirrored      = cmd.mNewMirrored;
+  mNewAutoRotate    = cmd.mNewAutoRotate;
+}
+
 bool CmdStrokeTextEdit::performExecute() {
   performRedo();  // can throw
 
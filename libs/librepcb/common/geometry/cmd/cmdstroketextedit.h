@@ -70,6 +70,10 @@ public:
               bool immediate) noexcept;
   void setAutoRotate(bool autoRotate, bool immediate) noexcept;
 
+  // Inherited from UndoCommand
+  bool canMergeWith(const UndoCommand& other) const noexcept override;
+  void mergeWith(const UndoCommand& other) noexcept override;
+
   // Operator Overloadings
   CmdStrokeTextEdit& operator=(const CmdStrokeTextEdit& rhs) = delete;
 
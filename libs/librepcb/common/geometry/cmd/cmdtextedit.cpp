@@ -120,6 +120,23 @@ void CmdTextEdit::rotate(const Angle& angle, const Point& center,
  *  Inherited from UndoCommand
  ******************************************************************************/
 
+bool CmdTextEdit::canMergeWith(const UndoCommand& other) const noexcept {
+  const CmdTextEdit* cmd = dynamic_cast<const CmdTextEdit*>(&other);
+  return cmd && (&cmd->mText == &mText) && isCurrentlyExecuted() &&
+         cmd->isCurrentlyExecuted();
+}
+
+void CmdTextEdit::mergeWith(const UndoCommand& other) noexcept {
+  Q_ASSERT(canMergeWith(other));
+  const CmdTextEdit& cmd = dynamic_cast<const CmdTextEdit&>(other);
+  mNewLayerName = cmd.mNewLayerName;
+  mNewText      = cmd.mNewText;
+  mNewPosition  = cmd.mNewPosition;
+  mNewRotation  = cmd.mNewRotation;
+  mNewHeight    = cmd.mNewHeight;
+  mNewAlign     = cmd.mNewAlign;
+}
+
 bool CmdTextEdit::performExecute() {
   performRedo();  // can throw
 
@@ -270,11 +270,53 @@ Path Path::octagon(const PositiveLength& width,
 
 Path Path::flatArc(const Point& p1, const Point& p2, const Angle& angle,
                    const PositiveLength& maxTolerance) noexcept {
+  QVector<Point> offsets = flatArcOffsets(p2 - p1, angle, maxTolerance);
+  Path           p;
+  p.mVertices.reserve(offsets.count() + 1);
+  p.addVertex(p1);
+  foreach (const Point& offset, offsets) { p.addVertex(p1 + offset); }
+  return p;
+}
+
+QVector<Point> Path::flatArcOffsets(
+    const Point& delta, const Angle& angle,
+    const PositiveLength& maxTolerance) noexcept {
+  typedef QPair<Vertex, Length>       Key;
+  typedef QCache<Key, QVector<Point>> Cache;
+  static QThreadStorage<Cache*>       caches;
+  if (!caches.hasLocalData()) {
+    caches.setLocalData(new Cache(1000));  // deleted by QThreadStorage
+  }
+  Cache&          cache = *caches.localData();
+  Key             key(Vertex(delta, angle), *maxTolerance);
+  QVector<Point>* cached = cache.object(key);
+  if (cached) {
+    return *cached;  // implicitly shared, no deep copy
+  }
+  QVector<Point> offsets = calcFlatArcOffsets(delta, angle, maxTolerance);
+  cache.insert(key, new QVector<Point>(offsets));
+  return offsets;
+}
+
+QPainterPath Path::toQPainterPathPx(const QVector<Path>& paths) noexcept {
+  QPainterPath p;
+  foreach (const Path& path, paths) { p.addPath(path.toQPainterPathPx()); }
+  return p;
+}
+
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+QVector<Point> Path::calcFlatArcOffsets(
+    const Point& delta, const Angle& angle,
+    const PositiveLength& maxTolerance) noexcept {
   // return straight line if radius is smaller than half of the allowed
   // tolerance
-  Length radiusAbs = Toolbox::arcRadius(p1, p2, angle).abs();
+  Point  origin(0, 0);
+  Length radiusAbs = Toolbox::arcRadius(origin, delta, angle).abs();
   if (radiusAbs <= maxTolerance / 2) {
-    return line(p1, p2);
+    return QVector<Point>{delta};
   }
 
   // calculate how many lines we need to create
@@ -285,24 +327,28 @@ Path Path::flatArc(const Point& p1, const Point& p2, const Angle& angle,
       qMin(qreal(0.5) / qAcos(1 - y / radiusAbsNm), radiusAbsNm / qreal(2));
   int steps = qCeil(stepsPerRad * angle.abs().toRad());
 
-  // some other very complex calculations...
-  qreal angleDelta = angle.toMicroDeg() / (qreal)steps;
-  Point center     = Toolbox::arcCenter(p1, p2, angle);
+  // Rotate the start point around the center step by step. Sine and cosine
+  // are calculated only once, the rotation is accumulated with floating point
+  // numbers and only the resulting coordinates are rounded.
+  Point center = Toolbox::arcCenter(origin, delta, angle);
+  qreal cx     = static_cast<qreal>(center.getX().toNm());
+  qreal cy     = static_cast<qreal>(center.getY().toNm());
+  qreal dx     = -cx;
+  qreal dy     = -cy;
+  qreal sin    = qSin(angle.toRad() / steps);
+  qreal cos    = qCos(angle.toRad() / steps);
 
   // create line segments
-  Path p;
-  p.addVertex(p1);
+  QVector<Point> offsets;
+  offsets.reserve(steps);
   for (int i = 1; i < steps; ++i) {
-    p.addVertex(p1.rotated(Angle(angleDelta * i), center));
+    qreal tmp = cos * dx - sin * dy;
+    dy        = sin * dx + cos * dy;
+    dx        = tmp;
+    offsets.append(Point(qRound64(cx + dx), qRound64(cy + dy)));
   }
-  p.addVertex(p2);
-  return p;
-}
-
-QPainterPath Path::toQPainterPathPx(const QVector<Path>& paths) noexcept {
-  QPainterPath p;
-  foreach (const Path& path, paths) { p.addPath(path.toQPainterPathPx()); }
-  return p;
+  offsets.append(delta);
+  return offsets;
 }
 
 /*******************************************************************************
@@ -113,12 +113,36 @@ public:
                       const PositiveLength& height) noexcept;
   static Path flatArc(const Point& p1, const Point& p2, const Angle& angle,
                       const PositiveLength& maxTolerance) noexcept;
+
+  /**
+   * @brief Get the points of a flattened arc, relative to its start point
+   *
+   * Returns the same points as #flatArc() except the start point, but
+   * relative to the start point of the arc. As the result only depends on the
+   * shape of the arc, it is cached (per thread). So flattening many arcs of
+   * the same shape at different positions (e.g. pads, vias or traces) is
+   * cheap.
+   *
+   * @param delta         End point minus start point of the arc.
+   * @param angle         Angle of the arc.
+   * @param maxTolerance  Maximum allowed deviation from the exact arc.
+   *
+   * @return All points of the flattened arc except the start point. The last
+   *         point is always exactly `delta`.
+   */
+  static QVector<Point> flatArcOffsets(
+      const Point& delta, const Angle& angle,
+      const PositiveLength& maxTolerance) noexcept;
+
   static QPainterPath toQPainterPathPx(const QVector<Path>& paths) noexcept;
 
 private:  // Methods
   void invalidatePainterPath() const noexcept {
     mPainterPathPx = QPainterPath();
   }
+  static QVector<Point> calcFlatArcOffsets(
+      const Point& delta, const Angle& angle,
+      const PositiveLength& maxTolerance) noexcept;
 
 private:  // Data
   QVector<Vertex>      mVertices;
@@ -51,7 +51,8 @@ StrokeText::StrokeText(const StrokeText& other) noexcept
     mMirrored(other.mMirrored),
     mAutoRotate(other.mAutoRotate),
     mAttributeProvider(nullptr),
-    mFont(nullptr) {
+    mFont(nullptr),
+    mPathsDirty(true) {
 }
 
 StrokeText::StrokeText(const Uuid& uuid, const StrokeText& other) noexcept
@@ -81,7 +82,8 @@ StrokeText::StrokeText(const Uuid& uuid, const GraphicsLayerName& layerName,
     mMirrored(mirrored),
     mAutoRotate(autoRotate),
     mAttributeProvider(nullptr),
-    mFont(nullptr) {
+    mFont(nullptr),
+    mPathsDirty(true) {
 }
 
 StrokeText::StrokeText(const SExpression& node)
@@ -99,7 +101,8 @@ StrokeText::StrokeText(const SExpression& node)
     mMirrored(node.getValueByPath<bool>("mirror")),
     mAutoRotate(node.getValueByPath<bool>("auto_rotate")),
     mAttributeProvider(nullptr),
-    mFont(nullptr) {
+    mFont(nullptr),
+    mPathsDirty(true) {
 }
 
 StrokeText::~StrokeText() noexcept {
@@ -113,6 +116,10 @@ const QVector<Path>& StrokeText::getPaths() const noexcept {
   if (!mFont) {
     qWarning() << "Tried to obtain StrokeFont paths, but no font is set!";
   }
+  if (mPathsDirty) {
+    layoutPaths(mPaths, mPathsRotated);
+    mPathsDirty = false;
+  }
   return needsAutoRotation() ? mPathsRotated : mPaths;
 }
 
@@ -298,27 +305,15 @@ void StrokeText::setFont(const StrokeFont* font) noexcept {
 }
 
 void StrokeText::updatePaths() noexcept {
-  QVector<Path> paths;
-  Point         center;
-  if (mFont) {
-    QString str = mText;
-    if (mAttributeProvider) {
-      str = AttributeSubstitutor::substitute(str, mAttributeProvider);
-    }
-    Point bottomLeft, topRight;
-    paths  = mFont->stroke(str, mHeight, calcLetterSpacing(), calcLineSpacing(),
-                          mAlign, bottomLeft, topRight);
-    center = (bottomLeft + topRight) / 2;
-  }
-  if (paths == mPaths) return;
-  mPaths = paths;
-
-  // rotate paths by 180° around their center
-  mPathsRotated = paths;
-  for (Path& p : mPathsRotated) {
-    p.rotate(Angle::deg180(), center);
-  }
-
+  // If nobody has fetched the paths yet, they will be calculated on the first
+  // access anyway, so there is no need to calculate and announce them now.
+  if (mPathsDirty) return;
+
+  QVector<Path> paths, pathsRotated;
+  layoutPaths(paths, pathsRotated);
+  if ((paths == mPaths) && (pathsRotated == mPathsRotated)) return;
+  mPaths        = paths;
+  mPathsRotated = pathsRotated;
   onEdited.notify(Event::PathsChanged);
 }
 
@@ -376,6 +371,32 @@ StrokeText& StrokeText::operator=(const StrokeText& rhs) noexcept {
   return *this;
 }
 
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+void StrokeText::layoutPaths(QVector<Path>& paths,
+                             QVector<Path>& pathsRotated) const noexcept {
+  Point center;
+  paths.clear();
+  if (mFont) {
+    QString str = mText;
+    if (mAttributeProvider) {
+      str = AttributeSubstitutor::substitute(str, mAttributeProvider);
+    }
+    Point bottomLeft, topRight;
+    paths  = mFont->stroke(str, mHeight, calcLetterSpacing(), calcLineSpacing(),
+                          mAlign, bottomLeft, topRight);
+    center = (bottomLeft + topRight) / 2;
+  }
+
+  // rotate paths by 180° around their center
+  pathsRotated = paths;
+  for (Path& p : pathsRotated) {
+    p.rotate(Angle::deg180(), center);
+  }
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
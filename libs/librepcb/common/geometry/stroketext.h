@@ -115,6 +115,12 @@ inline StrokeTextSpacing deserializeFromSExpression(const SExpression& sexpr,
 
 /**
  * @brief The StrokeText class
+ *
+ * The stroke paths are calculated lazily on the first call to #getPaths(), so
+ * setting up a text (e.g. while loading) doesn't lead to any layout
+ * calculation. Once the paths have been fetched, they are recalculated on every
+ * modification and Event::PathsChanged is emitted only if they really
+ * changed.
  */
 class StrokeText final : public SerializableObject {
   Q_DECLARE_TR_FUNCTIONS(StrokeText)
@@ -203,6 +209,10 @@ public:
   }
   StrokeText& operator=(const StrokeText& rhs) noexcept;
 
+private:  // Methods
+  void layoutPaths(QVector<Path>& paths, QVector<Path>& pathsRotated) const
+      noexcept;
+
 private:  // Data
   Uuid              mUuid;
   GraphicsLayerName mLayerName;
@@ -221,9 +231,11 @@ private:  // Data
   const AttributeProvider*
                     mAttributeProvider;  ///< for substituting placeholders in text
   const StrokeFont* mFont;               ///< font used for calculating paths
-  QVector<Path>     mPaths;     ///< stroke paths without transformations
-                                ///< (mirror/rotate/translate)
-  QVector<Path> mPathsRotated;  ///< same as #mPaths, but rotated by 180°
+  mutable bool      mPathsDirty;  ///< whether #mPaths needs to be updated
+  mutable QVector<Path> mPaths;   ///< stroke paths without transformations
+                                  ///< (mirror/rotate/translate)
+  mutable QVector<Path> mPathsRotated;  ///< same as #mPaths, but rotated by
+                                        ///< 180°
 };
 
 /*******************************************************************************
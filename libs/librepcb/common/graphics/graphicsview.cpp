@@ -23,6 +23,7 @@
 #include "graphicsview.h"
 
 #include "../gridproperties.h"
+#include "../profiler.h"
 #include "QtOpenGL"
 #include "graphicsscene.h"
 #include "if_graphicsvieweventhandler.h"
@@ -262,6 +263,11 @@ bool GraphicsView::eventFilter(QObject* obj, QEvent* event) {
   return QWidget::eventFilter(obj, event);
 }
 
+void GraphicsView::paintEvent(QPaintEvent* event) {
+  LIBREPCB_PROFILE_SCOPE("Paint graphics view");
+  QGraphicsView::paintEvent(event);
+}
+
 void GraphicsView::drawBackground(QPainter* painter, const QRectF& rect) {
   QPen gridPen(Qt::gray);
   gridPen.setCosmetic(true);
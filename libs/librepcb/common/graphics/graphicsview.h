@@ -103,6 +103,7 @@ private:
 
   // Inherited Methods
   bool eventFilter(QObject* obj, QEvent* event);
+  void paintEvent(QPaintEvent* event);
   void drawBackground(QPainter* painter, const QRectF& rect);
   void drawForeground(QPainter* painter, const QRectF& rect);
 
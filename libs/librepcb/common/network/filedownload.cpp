@@ -22,6 +22,7 @@
  ******************************************************************************/
 #include "filedownload.h"
 
+#include "../fileio/fileutils.h"
 #include "scopeguard.h"
 
 #include <QtCore>
@@ -41,10 +42,18 @@ FileDownload::FileDownload(const QUrl& url, const FilePath& dest) noexcept
     mDestination(dest),
     mHashAlgorithm(QCryptographicHash::Md5),
     mExpectedChecksum(),
-    mExtractZipToDir() {
+    mHash(),
+    mExtractZipToDir(),
+    mZipExtractor(),
+    mExtractZipToDirExisted(true),
+    mExtractionSucceeded(false),
+    mReceivedBytes(0),
+    mResuming(false) {
 }
 
 FileDownload::~FileDownload() noexcept {
+  // remove files of an aborted or failed download
+  removeExtractedFiles();
 }
 
 /*******************************************************************************
@@ -68,6 +77,18 @@ void FileDownload::setZipExtractionDirectory(const FilePath& dir) noexcept {
  ******************************************************************************/
 
 void FileDownload::prepareRequest() {
+  // when retrying after receiving some data, try to resume the download
+  if (mFile && (mRetryCount > 0) && (mReceivedBytes > 0)) {
+    qDebug() << "Resume download at byte" << mReceivedBytes;
+    mRequest.setRawHeader("Range",
+                          QString("bytes=%1-").arg(mReceivedBytes).toUtf8());
+    mResuming = true;
+    return;
+  }
+  mRequest.setRawHeader("Range", QByteArray());  // remove header
+  mResuming      = false;
+  mReceivedBytes = 0;
+
   // check destination filepath
   if (mDestination.isExistingFile() || mDestination.isExistingDir()) {
     throw RuntimeError(__FILE__, __LINE__,
@@ -91,6 +112,13 @@ void FileDownload::prepareRequest() {
                        QString("Could not open file \"%1\": %2")
                            .arg(mDestination.toNative(), mFile->errorString()));
   }
+
+  // calculate checksum and extract ZIP file while receiving the data
+  mHash.reset(new QCryptographicHash(mHashAlgorithm));
+  if (mExtractZipToDir.isValid()) {
+    mExtractZipToDirExisted = mExtractZipToDir.isExistingDir();
+    mZipExtractor.reset(new ZipStreamExtractor(mExtractZipToDir));
+  }
 }
 
 void FileDownload::finalizeRequest() {
@@ -108,21 +136,17 @@ void FileDownload::finalizeRequest() {
                            .arg(mDestination.toNative(), mFile->errorString()));
   }
 
-  // if an error occurs below this line, remove the downloaded file
-  auto sg = scopeGuard([this]() { QFile::remove(mDestination.toStr()); });
+  // if an error occurs below this line, remove the downloaded file and the
+  // already extracted files
+  auto sg = scopeGuard([this]() {
+    QFile::remove(mDestination.toStr());
+    removeExtractedFiles();
+  });
 
   // verify checksum of downloaded file
   if (!mExpectedChecksum.isEmpty()) {
-    emit  progressState(tr("Verify checksum..."));
-    QFile file(mDestination.toStr());
-    if (!file.open(QFile::ReadOnly)) {
-      throw RuntimeError(__FILE__, __LINE__,
-                         QString(tr("Error while readback file \"%1\": %2"))
-                             .arg(mDestination.toNative(), file.errorString()));
-    }
-    QCryptographicHash hash(mHashAlgorithm);
-    hash.addData(&file);
-    QString result   = hash.result().toHex();
+    emit    progressState(tr("Verify checksum..."));
+    QString result   = mHash->result().toHex();
     QString expected = mExpectedChecksum.toHex();
     if (result != expected) {
       qDebug() << "expected" << expected << "but got" << result;
@@ -136,15 +160,8 @@ void FileDownload::finalizeRequest() {
 
   // extract zip file if neccessary
   if (mExtractZipToDir.isValid()) {
-    emit        progressState(tr("Extract files..."));
-    QStringList files =
-        JlCompress::extractDir(mDestination.toStr(), mExtractZipToDir.toStr());
-    if (files.isEmpty()) {
-      throw RuntimeError(
-          __FILE__, __LINE__,
-          QString(tr("Error while extracting the ZIP file \"%1\"."))
-              .arg(mDestination.toNative()));
-    }
+    extractZipFile();  // can throw
+    mExtractionSucceeded = true;
   } else {
     // do NOT remove the downloaded file
     sg.dismiss();
@@ -159,7 +176,92 @@ void FileDownload::emitSuccessfullyFinishedSignals() noexcept {
 }
 
 void FileDownload::fetchNewData() noexcept {
-  mFile->write(mReply->readAll());
+  QByteArray data = mReply->readAll();
+  int        status =
+      mReply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt();
+  if (mReply->attribute(QNetworkRequest::RedirectionTargetAttribute)
+          .isValid()) {
+    return;  // the request will be restarted with the new URL
+  } else if (status >= 400) {
+    return;  // error page, the request fails or will be retried
+  }
+  if (mResuming) {
+    // check if the server really continues where the previous reply ended,
+    // otherwise start over with the received data
+    mResuming        = false;
+    QByteArray range = mReply->rawHeader("Content-Range");
+    QByteArray expectedRange =
+        "bytes " + QByteArray::number(mReceivedBytes) + "-";
+    if ((status != 206) || (!range.startsWith(expectedRange))) {
+      qDebug() << "Server does not support resuming, restart download.";
+      if (!restartDownload()) {
+        qCritical() << "Failed to restart download:" << mFile->errorString();
+        mReply->abort();
+        return;
+      }
+    }
+  }
+  mReceivedBytes += data.size();
+  mFile->write(data);
+  mHash->addData(data);
+  if (mZipExtractor) {
+    try {
+      mZipExtractor->addData(data);  // can throw
+    } catch (const Exception& e) {
+      qWarning() << "Could not extract ZIP file while downloading, will"
+                 << "extract it after downloading instead:" << e.getMsg();
+      removeExtractedFiles();
+      mZipExtractor.reset();
+    }
+  }
+}
+
+bool FileDownload::restartDownload() noexcept {
+  removeExtractedFiles();
+  mReceivedBytes = 0;
+  mHash.reset(new QCryptographicHash(mHashAlgorithm));
+  if (mExtractZipToDir.isValid()) {
+    mZipExtractor.reset(new ZipStreamExtractor(mExtractZipToDir));
+  }
+  return mFile->seek(0) && mFile->resize(0);
+}
+
+void FileDownload::extractZipFile() {
+  emit progressState(tr("Extract files..."));
+  if (mZipExtractor) {
+    mZipExtractor->finish();  // can throw
+  } else {
+    QStringList files =
+        JlCompress::extractDir(mDestination.toStr(), mExtractZipToDir.toStr());
+    if (files.isEmpty()) {
+      throw RuntimeError(
+          __FILE__, __LINE__,
+          QString(tr("Error while extracting the ZIP file \"%1\"."))
+              .arg(mDestination.toNative()));
+    }
+  }
+}
+
+void FileDownload::removeExtractedFiles() noexcept {
+  if ((!mExtractZipToDir.isValid()) || mExtractionSucceeded) {
+    return;
+  }
+  try {
+    if (!mExtractZipToDirExisted) {
+      // the directory was created by us, so it's safe to remove it completely
+      if (mExtractZipToDir.isExistingDir()) {
+        FileUtils::removeDirRecursively(mExtractZipToDir);  // can throw
+      }
+    } else if (mZipExtractor) {
+      foreach (const FilePath& fp, mZipExtractor->getExtractedFiles()) {
+        if (fp.isExistingFile()) {
+          FileUtils::removeFile(fp);  // can throw
+        }
+      }
+    }
+  } catch (const Exception& e) {
+    qWarning() << "Failed to remove extracted files:" << e.getMsg();
+  }
 }
 
 /*******************************************************************************
@@ -24,6 +24,7 @@
  *  Includes
  ******************************************************************************/
 #include "../fileio/filepath.h"
+#include "../fileio/zipstreamextractor.h"
 #include "networkrequestbase.h"
 
 #include <QtCore>
@@ -41,6 +42,10 @@ namespace librepcb {
  * @brief This class is used to download a file asynchronously in a separate
  * thread
  *
+ * If retries are enabled with #setMaxRetries() and the server supports HTTP
+ * range requests, a retried download continues at the position where the
+ * failed attempt ended.
+ *
  * @see librepcb::NetworkRequestBase, librepcb::DownloadManager
  *
  * @author ubruhin
@@ -83,9 +88,13 @@ public:
    * @brief Set extraction directory of the ZIP file to download
    *
    * If set (and valid), the downloaded file (must be a ZIP!) will be extracted
-   * into this directory after downloading it.
+   * into this directory. The files are extracted while the ZIP file is still
+   * being downloaded, only if this is not possible (e.g. unsupported ZIP
+   * features), the ZIP file is extracted after downloading it.
    *
-   * @note The downloaded ZIP file will be removed after extracting it.
+   * @note The downloaded ZIP file will be removed after extracting it. If the
+   *       download or the checksum verification fails, the extracted files are
+   *       removed again.
    *
    * @param dir           Destination directory (may or may not exist)
    */
@@ -121,13 +130,22 @@ private:  // Methods
   void finalizeRequest() override;
   void emitSuccessfullyFinishedSignals() noexcept override;
   void fetchNewData() noexcept override;
+  bool restartDownload() noexcept;
+  void extractZipFile();
+  void removeExtractedFiles() noexcept;
 
 private:  // Data
-  FilePath                      mDestination;
-  QScopedPointer<QSaveFile>     mFile;
-  QCryptographicHash::Algorithm mHashAlgorithm;
-  QByteArray                    mExpectedChecksum;
-  FilePath                      mExtractZipToDir;
+  FilePath                           mDestination;
+  QScopedPointer<QSaveFile>          mFile;
+  QCryptographicHash::Algorithm      mHashAlgorithm;
+  QByteArray                         mExpectedChecksum;
+  QScopedPointer<QCryptographicHash> mHash;  ///< Checksum of received data
+  FilePath                           mExtractZipToDir;
+  QScopedPointer<ZipStreamExtractor> mZipExtractor;  ///< nullptr on fallback
+  bool                               mExtractZipToDirExisted;
+  bool                               mExtractionSucceeded;
+  qint64                             mReceivedBytes;  ///< Without redirects
+  bool                               mResuming;  ///< Range request running
 };
 
 /*******************************************************************************
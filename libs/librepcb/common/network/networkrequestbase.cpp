@@ -39,10 +39,12 @@ namespace librepcb {
 NetworkRequestBase::NetworkRequestBase(const QUrl& url) noexcept
   : mUrl(url),
     mExpectedContentSize(-1),
+    mMaxRetries(0),
     mStarted(false),
     mAborted(false),
     mErrored(false),
-    mFinished(false) {
+    mFinished(false),
+    mRetryCount(0) {
   Q_ASSERT(QThread::currentThread() != NetworkAccessManager::instance());
 
   // set initial HTTP header fields
@@ -85,6 +87,12 @@ void NetworkRequestBase::setExpectedReplyContentSize(qint64 bytes) noexcept {
   mExpectedContentSize = bytes;
 }
 
+void NetworkRequestBase::setMaxRetries(int retries) noexcept {
+  Q_ASSERT(QThread::currentThread() != NetworkAccessManager::instance());
+  Q_ASSERT(!mStarted);
+  mMaxRetries = retries;
+}
+
 void NetworkRequestBase::start() noexcept {
   Q_ASSERT(QThread::currentThread() != NetworkAccessManager::instance());
 
@@ -102,9 +110,9 @@ void NetworkRequestBase::start() noexcept {
 
 void NetworkRequestBase::abort() noexcept {
   Q_ASSERT(QThread::currentThread() == NetworkAccessManager::instance());
+  mAborted = true;  // also handles aborting while waiting for a retry
   if (mReply) {
     emit progressState(tr("Abort request..."));
-    mAborted = true;
     mReply->abort();
   }
 }
@@ -116,6 +124,11 @@ void NetworkRequestBase::abort() noexcept {
 void NetworkRequestBase::executeRequest() noexcept {
   Q_ASSERT(QThread::currentThread() == NetworkAccessManager::instance());
 
+  if (mAborted) {
+    finalize(tr("Network request aborted."));
+    return;
+  }
+
   emit progressState(tr("Request started..."));
 
   // get network access manager object
@@ -165,6 +178,9 @@ void NetworkRequestBase::replyReadyReadSlot() noexcept {
 void NetworkRequestBase::replyErrorSlot(
     QNetworkReply::NetworkError code) noexcept {
   Q_ASSERT(QThread::currentThread() == NetworkAccessManager::instance());
+  if (retryRequest(code)) {
+    return;
+  }
   mErrored = true;
   finalize(QString(tr("%1 (%2)")).arg(mReply->errorString()).arg(code));
 }
@@ -238,6 +254,9 @@ void NetworkRequestBase::replyFinishedSlot() noexcept {
 
   // check for download error
   if (mReply->error() != QNetworkReply::NoError) {
+    if (retryRequest(mReply->error())) {
+      return;
+    }
     finalize(
         QString(tr("%1 (%2)")).arg(mReply->errorString()).arg(mReply->error()));
     return;
@@ -255,6 +274,26 @@ void NetworkRequestBase::replyFinishedSlot() noexcept {
   finalize();
 }
 
+bool NetworkRequestBase::retryRequest(
+    QNetworkReply::NetworkError error) noexcept {
+  if (mAborted || (mRetryCount >= mMaxRetries) || (!isTransientError(error))) {
+    return false;
+  }
+
+  // wait a bit longer with every retry to not overload the server
+  int delayMs = 1000 << qMin(mRetryCount, 5);
+  mRetryCount++;
+  qDebug() << "Request failed, retry in" << delayMs << "ms:" << mUrl.toString()
+           << "Error:" << error;
+  emit progressState(QString(tr("Retry request (%1/%2)..."))
+                         .arg(mRetryCount)
+                         .arg(mMaxRetries));
+  mReply->disconnect(this);  // ignore further signals of the failed reply
+  mReply.take()->deleteLater();
+  QTimer::singleShot(delayMs, this, &NetworkRequestBase::executeRequest);
+  return true;
+}
+
 void NetworkRequestBase::finalize(const QString& errorMsg) noexcept {
   Q_ASSERT(QThread::currentThread() == NetworkAccessManager::instance());
 
@@ -284,6 +323,26 @@ void NetworkRequestBase::finalize(const QString& errorMsg) noexcept {
  *  Static Methods
  ******************************************************************************/
 
+bool NetworkRequestBase::isTransientError(
+    QNetworkReply::NetworkError error) noexcept {
+  switch (error) {
+    case QNetworkReply::ConnectionRefusedError:
+    case QNetworkReply::RemoteHostClosedError:
+    case QNetworkReply::TimeoutError:
+    case QNetworkReply::TemporaryNetworkFailureError:
+    case QNetworkReply::NetworkSessionFailedError:
+    case QNetworkReply::UnknownNetworkError:
+    case QNetworkReply::ProxyConnectionClosedError:
+    case QNetworkReply::ProxyTimeoutError:
+    case QNetworkReply::InternalServerError:
+    case QNetworkReply::ServiceUnavailableError:
+    case QNetworkReply::UnknownServerError:
+      return true;
+    default:
+      return false;
+  }
+}
+
 QString NetworkRequestBase::formatFileSize(qint64 bytes) noexcept {
   qreal               num = bytes;
   QStringList         list({"KB", "MB", "GB", "TB"});
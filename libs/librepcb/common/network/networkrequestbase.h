@@ -88,6 +88,18 @@ public:
    */
   void setExpectedReplyContentSize(qint64 bytes) noexcept;
 
+  /**
+   * @brief Set how often the request is retried after a transient error
+   *
+   * If a request fails because of a (probably) temporary problem like a
+   * timeout, a closed connection or an overloaded server, it is executed again
+   * after a delay which doubles with every retry. Derived classes may use
+   * #mRetryCount in #prepareRequest() to resume the interrupted request.
+   *
+   * @param retries       Maximum count of retries (default: 0)
+   */
+  void setMaxRetries(int retries) noexcept;
+
   // Operator Overloadings
   NetworkRequestBase& operator=(const NetworkRequestBase& rhs) = delete;
 
@@ -189,13 +201,16 @@ private:  // Methods
   void           replyDownloadProgressSlot(qint64 bytesReceived,
                                            qint64 bytesTotal) noexcept;
   void           replyFinishedSlot() noexcept;
+  bool           retryRequest(QNetworkReply::NetworkError error) noexcept;
   void           finalize(const QString& errorMsg = QString()) noexcept;
+  static bool    isTransientError(QNetworkReply::NetworkError error) noexcept;
   static QString formatFileSize(qint64 bytes) noexcept;
 
 protected:  // Data
   // from constructor
   QUrl   mUrl;
   qint64 mExpectedContentSize;
+  int    mMaxRetries;
 
   // internal data
   QList<QUrl>                   mRedirectedUrls;
@@ -205,6 +220,7 @@ protected:  // Data
   bool                          mAborted;
   bool                          mErrored;
   bool                          mFinished;
+  int                           mRetryCount;  ///< Retries executed so far
 };
 
 /*******************************************************************************
@@ -0,0 +1,266 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "profiler.h"
+
+#include "tracer.h"
+
+#include <QtCore>
+
+#if defined(Q_OS_UNIX)
+#include <sys/resource.h>
+#include <time.h>
+#elif defined(Q_OS_WIN)
+#include <windows.h>
+#endif
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+
+/*******************************************************************************
+ *  Static Variables
+ ******************************************************************************/
+
+std::atomic<qint64> Profiler::sAllocations(0);
+
+/*******************************************************************************
+ *  Constructors / Destructor
+ ******************************************************************************/
+
+Profiler::Profiler() noexcept : mEnabled(false) {
+}
+
+Profiler::~Profiler() noexcept {
+}
+
+/*******************************************************************************
+ *  Getters
+ ******************************************************************************/
+
+QList<Profiler::Phase> Profiler::getPhases() const noexcept {
+  QMutexLocker lock(&mMutex);
+  return mPhases;
+}
+
+/*******************************************************************************
+ *  Setters
+ ******************************************************************************/
+
+void Profiler::setEnabled(bool enabled) noexcept {
+  mEnabled.store(enabled);
+}
+
+/*******************************************************************************
+ *  General Methods
+ ******************************************************************************/
+
+void Profiler::addMeasurement(const char* name, qint64 wallTimeNs,
+                              qint64 cpuTimeNs, qint64 allocations) noexcept {
+  qint64       peakMemory = getPeakMemoryUsage();
+  QMutexLocker lock(&mMutex);
+  int          index = mPhaseIndex.value(name, -1);
+  if (index < 0) {
+    index = mPhases.count();
+    mPhases.append(Phase{name, 0, 0, 0, -1, 0});
+    mPhaseIndex.insert(name, index);
+  }
+  Phase& phase = mPhases[index];
+  phase.count++;
+  phase.wallTimeNs += wallTimeNs;
+  phase.cpuTimeNs = ((phase.cpuTimeNs >= 0) && (cpuTimeNs >= 0))
+                        ? (phase.cpuTimeNs + cpuTimeNs)
+                        : -1;
+  phase.peakMemory  = qMax(phase.peakMemory, peakMemory);
+  phase.allocations = ((phase.allocations >= 0) && (allocations >= 0))
+                          ? (phase.allocations + allocations)
+                          : -1;
+}
+
+void Profiler::clear() noexcept {
+  QMutexLocker lock(&mMutex);
+  mPhases.clear();
+  mPhaseIndex.clear();
+}
+
+QString Profiler::toText() const noexcept {
+  auto formatTime = [](qint64 ns) {
+    return (ns >= 0) ? QString::number(ns / 1e6, 'f', 1) : QString("-");
+  };
+  auto formatMemory = [](qint64 bytes) {
+    return (bytes >= 0) ? QString::number(bytes / 1048576.0, 'f', 1)
+                        : QString("-");
+  };
+  auto formatCount = [](qint64 count) {
+    return (count >= 0) ? QString::number(count) : QString("-");
+  };
+
+  QList<Phase> phases = getPhases();
+  int          nameWidth = tr("Phase").length();
+  foreach (const Phase& phase, phases) {
+    nameWidth = qMax(nameWidth, phase.name.length());
+  }
+  QStringList lines;
+  lines << tr("Phase").leftJustified(nameWidth) % "  " %
+          tr("Count").rightJustified(6) % "  " %
+          tr("Wall [ms]").rightJustified(11) % "  " %
+          tr("CPU [ms]").rightJustified(11) % "  " %
+          tr("Peak RSS [MB]").rightJustified(13) % "  " %
+          tr("new Calls").rightJustified(12);
+  foreach (const Phase& phase, phases) {
+    lines << phase.name.leftJustified(nameWidth) % "  " %
+            QString::number(phase.count).rightJustified(6) % "  " %
+            formatTime(phase.wallTimeNs).rightJustified(11) % "  " %
+            formatTime(phase.cpuTimeNs).rightJustified(11) % "  " %
+            formatMemory(phase.peakMemory).rightJustified(13) % "  " %
+            formatCount(phase.allocations).rightJustified(12);
+  }
+  return lines.join("\n");
+}
+
+QByteArray Profiler::toJson() const noexcept {
+  QJsonArray phases;
+  foreach (const Phase& phase, getPhases()) {
+    QJsonObject obj;
+    obj["name"]         = phase.name;
+    obj["count"]        = phase.count;
+    obj["wall_time_ns"] = static_cast<double>(phase.wallTimeNs);
+    obj["cpu_time_ns"] =
+        (phase.cpuTimeNs >= 0)
+            ? QJsonValue(static_cast<double>(phase.cpuTimeNs))
+            : QJsonValue();
+    obj["peak_rss_bytes"] =
+        (phase.peakMemory >= 0)
+            ? QJsonValue(static_cast<double>(phase.peakMemory))
+            : QJsonValue();
+    obj["operator_new_calls"] =
+        (phase.allocations >= 0)
+            ? QJsonValue(static_cast<double>(phase.allocations))
+            : QJsonValue();
+    phases.append(obj);
+  }
+  qint64      peakMemory = getPeakMemoryUsage();
+  QJsonObject root;
+  root["phases"] = phases;
+  root["peak_rss_bytes"] =
+      (peakMemory >= 0) ? QJsonValue(static_cast<double>(peakMemory))
+                        : QJsonValue();
+  return QJsonDocument(root).toJson(QJsonDocument::Indented);
+}
+
+/*******************************************************************************
+ *  Static Methods
+ ******************************************************************************/
+
+Profiler& Profiler::instance() noexcept {
+  static Profiler profiler;
+  return profiler;
+}
+
+qint64 Profiler::getCpuTimeNs() noexcept {
+#if defined(Q_OS_UNIX)
+  struct timespec ts;
+  if (clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts) == 0) {
+    return static_cast<qint64>(ts.tv_sec) * 1000000000LL + ts.tv_nsec;
+  }
+#elif defined(Q_OS_WIN)
+  FILETIME creationTime, exitTime, kernelTime, userTime;
+  if (GetProcessTimes(GetCurrentProcess(), &creationTime, &exitTime,
+                      &kernelTime, &userTime)) {
+    auto toNs = [](const FILETIME& ft) {
+      return ((static_cast<qint64>(ft.dwHighDateTime) << 32) |
+              ft.dwLowDateTime) *
+             100;  // FILETIME has a resolution of 100ns
+    };
+    return toNs(kernelTime) + toNs(userTime);
+  }
+#endif
+  return -1;
+}
+
+qint64 Profiler::getPeakMemoryUsage() noexcept {
+#if defined(Q_OS_UNIX)
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) == 0) {
+#if defined(Q_OS_MAC)
+    return static_cast<qint64>(usage.ru_maxrss);  // bytes
+#else
+    return static_cast<qint64>(usage.ru_maxrss) * 1024;  // kilobytes
+#endif
+  }
+#endif
+  return -1;
+}
+
+qint64 Profiler::getAllocationCount() noexcept {
+  qint64 count = sAllocations.load(std::memory_order_relaxed);
+  return (count > 0) ? count : -1;  // zero means allocations are not counted
+}
+
+/*******************************************************************************
+ *  Class ProfilerScope
+ ******************************************************************************/
+
+ProfilerScope::ProfilerScope(const char* name) noexcept
+  : mName(nullptr),
+    mProfiling(false),
+    mCpuTimeNs(-1),
+    mAllocations(-1),
+    mTraceStartNs(-1) {
+  if (Tracer::isActive()) {
+    mName         = name;
+    mTraceStartNs = Tracer::getTimestampNs();
+  }
+  if (Profiler::instance().isEnabled()) {
+    mName        = name;
+    mProfiling   = true;
+    mCpuTimeNs   = Profiler::getCpuTimeNs();
+    mAllocations = Profiler::getAllocationCount();
+    mTimer.start();
+  }
+}
+
+void ProfilerScope::finish() noexcept {
+  if (mName && (mTraceStartNs >= 0)) {
+    Tracer::addEvent(mName, mTraceStartNs,
+                     Tracer::getTimestampNs() - mTraceStartNs);
+  }
+  if (mName && mProfiling) {
+    qint64 wallTimeNs  = mTimer.nsecsElapsed();
+    qint64 cpuTimeNs   = Profiler::getCpuTimeNs();
+    qint64 allocations = Profiler::getAllocationCount();
+    Profiler::instance().addMeasurement(
+        mName, wallTimeNs,
+        ((mCpuTimeNs >= 0) && (cpuTimeNs >= 0)) ? (cpuTimeNs - mCpuTimeNs) : -1,
+        ((mAllocations >= 0) && (allocations >= 0))
+            ? (allocations - mAllocations)
+            : -1);
+  }
+  mName = nullptr;
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace librepcb
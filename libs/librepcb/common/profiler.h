@@ -0,0 +1,189 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_PROFILER_H
+#define LIBREPCB_PROFILER_H
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <QtCore>
+
+#include <atomic>
+
+/*******************************************************************************
+ *  Macros
+ ******************************************************************************/
+
+#define LIBREPCB_PROFILE_CONCAT_IMPL(a, b) a##b
+#define LIBREPCB_PROFILE_CONCAT(a, b) LIBREPCB_PROFILE_CONCAT_IMPL(a, b)
+
+/**
+ * @brief Measure the rest of the current block as a phase of the given name
+ *
+ * This is the only instrumentation macro, it feeds both the phase summary of
+ * ::librepcb::Profiler and the trace events of ::librepcb::Tracer.
+ *
+ * Building with qmake "CONFIG+=no_profiling" defines `LIBREPCB_NO_PROFILING`,
+ * which makes this macro expand to nothing, i.e. removes the instrumentation
+ * completely.
+ *
+ * @see ::librepcb::ProfilerScope
+ */
+#ifdef LIBREPCB_NO_PROFILING
+#define LIBREPCB_PROFILE_SCOPE(name) static_cast<void>(0)
+#else
+#define LIBREPCB_PROFILE_SCOPE(name)                                \
+  ::librepcb::ProfilerScope LIBREPCB_PROFILE_CONCAT(profilerScope_, \
+                                                    __LINE__)(name)
+#endif
+
+/*******************************************************************************
+ *  Namespace / Forward Declarations
+ ******************************************************************************/
+namespace librepcb {
+
+/*******************************************************************************
+ *  Class Profiler
+ ******************************************************************************/
+
+/**
+ * @brief Collects timing and resource usage statistics of named phases
+ *
+ * The phases are measured with ::librepcb::ProfilerScope objects (or the
+ * #LIBREPCB_PROFILE_SCOPE() macro). As long as neither the profiler nor the
+ * ::librepcb::Tracer is enabled (the default), such a scope costs only two
+ * atomic loads, so it's fine to use them in production code.
+ *
+ * Measurements of the same phase name are accumulated. Phases may be nested,
+ * the values of nested phases are included in the values of the outer phase.
+ * CPU time, peak memory and `operator new` calls are process-wide values, so
+ * if phases are measured concurrently in several threads, their values
+ * overlap.
+ *
+ * Calls of `operator new` are only counted if the application replaces the
+ * global `operator new` and calls #countAllocation() from there. Otherwise
+ * they are reported as unknown. Memory allocated with `malloc()` directly
+ * (e.g. by Qt containers) is never counted, thus the value is labelled as
+ * "operator new calls" rather than as allocations in the reports.
+ */
+class Profiler final {
+  Q_DECLARE_TR_FUNCTIONS(Profiler)
+
+public:
+  // Types
+  struct Phase {
+    QString name;         ///< Name of the phase
+    int     count;        ///< How many times the phase was measured
+    qint64  wallTimeNs;   ///< Accumulated wall time [ns]
+    qint64  cpuTimeNs;    ///< Accumulated process CPU time [ns] (-1=unknown)
+    qint64  peakMemory;   ///< Peak resident set size at end [bytes] (-1=unk.)
+    qint64  allocations;  ///< Accumulated operator new calls (-1=unknown)
+  };
+
+  // Constructors / Destructor
+  Profiler(const Profiler& other) = delete;
+  ~Profiler() noexcept;
+
+  // Getters
+  bool isEnabled() const noexcept {
+    return mEnabled.load(std::memory_order_relaxed);
+  }
+  QList<Phase> getPhases() const noexcept;
+
+  // Setters
+  void setEnabled(bool enabled) noexcept;
+
+  // General Methods
+  void       addMeasurement(const char* name, qint64 wallTimeNs,
+                            qint64 cpuTimeNs, qint64 allocations) noexcept;
+  void       clear() noexcept;
+  QString    toText() const noexcept;
+  QByteArray toJson() const noexcept;
+
+  // Operator Overloadings
+  Profiler& operator=(const Profiler& rhs) = delete;
+
+  // Static Methods
+  static Profiler& instance() noexcept;
+  static qint64    getCpuTimeNs() noexcept;
+  static qint64    getPeakMemoryUsage() noexcept;
+  static qint64    getAllocationCount() noexcept;
+  static void      countAllocation() noexcept {
+    sAllocations.fetch_add(1, std::memory_order_relaxed);
+  }
+
+private:  // Methods
+  Profiler() noexcept;
+
+private:  // Data
+  std::atomic<bool>   mEnabled;
+  mutable QMutex      mMutex;
+  QList<Phase>        mPhases;      ///< In order of first occurrence
+  QHash<QString, int> mPhaseIndex;  ///< Phase name -> index in #mPhases
+
+  static std::atomic<qint64> sAllocations;
+};
+
+/*******************************************************************************
+ *  Class ProfilerScope
+ ******************************************************************************/
+
+/**
+ * @brief Measures the lifetime of a scope and reports it to the profiler and
+ *        to the tracer
+ *
+ * The measurement starts when the object is constructed and ends when it is
+ * destroyed or when #finish() is called, whatever happens first. It is
+ * reported as a phase to ::librepcb::Profiler if it is enabled, and as a trace
+ * event to ::librepcb::Tracer if it is active.
+ *
+ * @warning The passed name must remain valid until tracing is stopped, so it
+ *          should be a string literal.
+ */
+class ProfilerScope final {
+public:
+  // Constructors / Destructor
+  ProfilerScope()                           = delete;
+  ProfilerScope(const ProfilerScope& other) = delete;
+  explicit ProfilerScope(const char* name) noexcept;
+  ~ProfilerScope() noexcept { finish(); }
+
+  // General Methods
+  void finish() noexcept;
+
+  // Operator Overloadings
+  ProfilerScope& operator=(const ProfilerScope& rhs) = delete;
+
+private:  // Data
+  const char*   mName;       ///< nullptr if not measuring (anymore)
+  bool          mProfiling;  ///< Whether the profiler was enabled at start
+  QElapsedTimer mTimer;
+  qint64        mCpuTimeNs;
+  qint64        mAllocations;
+  qint64        mTraceStartNs;  ///< -1 if tracing was not active at start
+};
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace librepcb
+
+#endif  // LIBREPCB_PROFILER_H
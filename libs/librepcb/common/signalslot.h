@@ -25,6 +25,7 @@
  ******************************************************************************/
 #include <functional>
 #include <set>
+#include <utility>
 #include <vector>
 
 /*******************************************************************************
@@ -35,6 +36,139 @@ namespace librepcb {
 template <typename Tsender, typename... Args>
 class Slot;
 
+/*******************************************************************************
+ *  Class SignalBatch
+ ******************************************************************************/
+
+/**
+ * @brief The SignalBatch class allows to coalesce notifications of
+ *        ::librepcb::Signal objects during bulk operations
+ *
+ * As long as at least one SignalBatch object exists (in the current thread),
+ * notifications to slots which have enabled coalescing (see
+ * ::librepcb::Slot::setCoalescing()) are not delivered immediately. Instead,
+ * such slots get called only once per signal with the arguments of the last
+ * notification as soon as the outermost SignalBatch object is destroyed.
+ * Slots which did not enable coalescing are still notified immediately, so
+ * the behavior does not change for receivers which rely on getting every
+ * single notification.
+ *
+ * This is useful for receivers which update themselves completely on any
+ * change (e.g. a table showing all elements of a list) because a bulk edit
+ * of N elements then costs only one update instead of N updates.
+ *
+ * Example:
+ *
+ * @code
+ * {
+ *   SignalBatch batch;
+ *   for (...) {
+ *     list.append(...);  // coalescing slots are not called here...
+ *   }
+ * }  // ...but only once here
+ * @endcode
+ *
+ * @note Batches can be nested, only the outermost batch delivers the
+ *       collected notifications.
+ *
+ * @warning The notifications are not aggregated into a change set: the
+ *          arguments of all but the last notification per signal are
+ *          discarded. For example, if elements 1 and 2 of a list are edited
+ *          within a batch, a coalescing slot is only told about element 2.
+ *          Therefore only enable coalescing for slots which ignore the
+ *          arguments and update themselves completely.
+ */
+class SignalBatch final {
+public:
+  // Constructors / Destructor
+  SignalBatch() noexcept { ++depth(); }
+  SignalBatch(const SignalBatch& other) = delete;
+  ~SignalBatch() noexcept {
+    if (--depth() == 0) {
+      flush();
+    }
+  }
+
+  /**
+   * @brief Check whether notifications are currently collected
+   *
+   * @return True if at least one SignalBatch object exists in this thread
+   */
+  static bool isActive() noexcept { return depth() > 0; }
+
+  /**
+   * @brief Defer a notification until the batch ends
+   *
+   * If there is already a pending notification for the same signal/slot pair,
+   * it gets replaced by the new one.
+   *
+   * @param signal    The signal which emitted the notification
+   * @param slot      The slot to be notified
+   * @param callback  Function delivering the notification
+   */
+  static void defer(const void* signal, const void* slot,
+                    const std::function<void()>& callback) noexcept {
+    for (Entry& entry : pending()) {
+      if ((entry.signal == signal) && (entry.slot == slot)) {
+        entry.callback = callback;
+        return;
+      }
+    }
+    pending().push_back(Entry{signal, slot, callback});
+  }
+
+  /**
+   * @brief Discard pending notifications of a signal and/or slot
+   *
+   * Must be called when a signal or slot gets destroyed or disconnected. This
+   * is cheap if there are no pending notifications.
+   *
+   * @param signal  The signal (nullptr to match any signal)
+   * @param slot    The slot (nullptr to match any slot)
+   */
+  static void cancel(const void* signal, const void* slot) noexcept {
+    std::vector<Entry>& entries = pending();
+    if (entries.empty()) return;
+    for (auto it = entries.begin(); it != entries.end();) {
+      if (((!signal) || (it->signal == signal)) &&
+          ((!slot) || (it->slot == slot))) {
+        it = entries.erase(it);
+      } else {
+        ++it;
+      }
+    }
+  }
+
+  // Operator Overloadings
+  SignalBatch& operator=(const SignalBatch& rhs) = delete;
+
+private:  // Types
+  struct Entry {
+    const void*           signal;
+    const void*           slot;
+    std::function<void()> callback;
+  };
+
+private:  // Methods
+  static void flush() noexcept {
+    // Deliver one by one since callbacks might emit other signals or destroy
+    // signals/slots (which cancels their pending notifications).
+    while (!pending().empty()) {
+      std::function<void()> callback = std::move(pending().front().callback);
+      pending().erase(pending().begin());
+      callback();
+    }
+  }
+  static int& depth() noexcept {
+    static thread_local int depth = 0;
+    return depth;
+  }
+  static std::vector<Entry>& pending() noexcept {
+    static thread_local std::vector<Entry> entries;
+    return entries;
+  }
+};
+
 /*******************************************************************************
  *  Class Signal
  ******************************************************************************/
@@ -86,6 +220,7 @@ public:
     for (auto slot : mSlots) {
       slot->mSignals.erase(this);
     }
+    SignalBatch::cancel(this, nullptr);
   }
 
   /**
@@ -106,16 +241,26 @@ public:
   void detach(Slot<Tsender, Args...>& slot) const noexcept {
     slot.mSignals.erase(this);
     mSlots.erase(&slot);
+    SignalBatch::cancel(this, &slot);
   }
 
   /**
    * @brief Notify all attached slots
    *
+   * If a ::librepcb::SignalBatch is active, slots with coalescing enabled are
+   * notified later, when the batch ends.
+   *
    * @param args  Arguments passed to the slots
    */
   void notify(Args... args) noexcept {
     for (auto slot : mSlots) {
-      slot->mCallback(mSender, args...);
+      if (slot->mCoalescing && SignalBatch::isActive()) {
+        SignalBatch::defer(this, slot, [this, slot, args...]() {
+          slot->mCallback(mSender, args...);
+        });
+      } else {
+        slot->mCallback(mSender, args...);
+      }
     }
   }
 
@@ -166,7 +311,7 @@ public:
    * @warning The function must never throw an exception!!!
    */
   explicit Slot(std::function<void(const Tsender&, Args...)>& callback) noexcept
-    : mCallback(callback) {}
+    : mCallback(callback), mCoalescing(false) {}
 
   /**
    * @brief Constructor
@@ -180,7 +325,8 @@ public:
   explicit Slot(T& obj, void (T::*func)(const Tsender&, Args...)) noexcept
     : mCallback([=, &obj](const Tsender& s, Args... args) {
         (obj.*func)(s, args...);
-      }) {}
+      }),
+      mCoalescing(false) {}
 
   /**
    * @brief Destructor
@@ -197,8 +343,20 @@ public:
       signal->mSlots.erase(this);
     }
     mSignals.clear();
+    SignalBatch::cancel(nullptr, this);
   }
 
+  /**
+   * @brief Enable or disable coalescing of notifications
+   *
+   * @param coalescing  If true, notifications emitted while a
+   *                    ::librepcb::SignalBatch is active are collected and
+   *                    only the last one (per signal) is delivered when the
+   *                    batch ends. Only use this if the callback does not
+   *                    depend on getting each single notification.
+   */
+  void setCoalescing(bool coalescing) noexcept { mCoalescing = coalescing; }
+
   // Operator Overloadings
   Slot& operator=(Slot const& other) = delete;
 
@@ -208,6 +366,9 @@ private:
 
   /// The registered callback function
   std::function<void(const Tsender&, Args...)> mCallback;
+
+  /// Whether notifications are coalesced while a SignalBatch is active
+  bool mCoalescing;
 };
 
 /*******************************************************************************
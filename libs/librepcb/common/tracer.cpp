@@ -0,0 +1,155 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "tracer.h"
+
+#include "exceptions.h"
+#include "fileio/fileutils.h"
+
+#include <QtCore>
+
+#include <chrono>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+
+/*******************************************************************************
+ *  Static Variables
+ ******************************************************************************/
+
+std::atomic<bool>      Tracer::sActive(false);
+std::atomic<qint64>    Tracer::sStartTimeNs(0);
+std::atomic<int>       Tracer::sNextThreadId(1);
+QMutex                 Tracer::sMutex;
+FilePath               Tracer::sFilePath;
+QVector<Tracer::Event> Tracer::sEvents;
+int                    Tracer::sDroppedEvents = 0;
+
+/*******************************************************************************
+ *  Getters
+ ******************************************************************************/
+
+FilePath Tracer::getFilePath() noexcept {
+  QMutexLocker lock(&sMutex);
+  return sFilePath;
+}
+
+qint64 Tracer::getTimestampNs() noexcept {
+  return getSteadyClockNs() - sStartTimeNs.load(std::memory_order_relaxed);
+}
+
+/*******************************************************************************
+ *  General Methods
+ ******************************************************************************/
+
+void Tracer::start(const FilePath& fp) noexcept {
+  stop();  // write events of the previous trace, if any
+
+  QMutexLocker lock(&sMutex);
+  qInfo() << "Start recording trace events to" << fp.toNative();
+  sFilePath = fp;
+  sEvents.clear();
+  sDroppedEvents = 0;
+  sStartTimeNs.store(getSteadyClockNs());
+  sActive.store(true);
+}
+
+void Tracer::startFromEnvironment() noexcept {
+  QString path = qgetenv("LIBREPCB_TRACE_FILE");
+  if (!path.isEmpty()) {
+    start(FilePath(QFileInfo(path).absoluteFilePath()));
+  }
+}
+
+void Tracer::stop() noexcept {
+  QMutexLocker lock(&sMutex);
+  if (!sActive.load()) {
+    return;
+  }
+  sActive.store(false);
+  try {
+    QByteArray json = toJson(sEvents, sDroppedEvents);
+    FileUtils::writeFile(sFilePath, json);  // can throw
+    qInfo() << "Wrote" << sEvents.count() << "trace events to"
+            << sFilePath.toNative();
+  } catch (const Exception& e) {
+    qCritical() << "Failed to write trace events:" << e.getMsg();
+  }
+  sEvents.clear();
+  sEvents.squeeze();
+}
+
+void Tracer::addEvent(const char* name, qint64 startNs,
+                      qint64 durationNs) noexcept {
+  static thread_local int threadId = sNextThreadId.fetch_add(1);
+  QMutexLocker            lock(&sMutex);
+  if (!sActive.load(std::memory_order_relaxed)) {
+    return;  // tracing was stopped in the meantime
+  } else if (sEvents.count() >= sMaxEvents) {
+    ++sDroppedEvents;
+  } else {
+    sEvents.append(Event{name, threadId, startNs, durationNs});
+  }
+}
+
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+qint64 Tracer::getSteadyClockNs() noexcept {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+QByteArray Tracer::toJson(const QVector<Event>& events,
+                          int                   droppedEvents) noexcept {
+  qint64     pid = QCoreApplication::applicationPid();
+  QJsonArray array;
+  foreach (const Event& event, events) {
+    QJsonObject obj;
+    obj["name"] = QString(event.name);
+    obj["ph"]   = QString("X");  // "complete" event
+    obj["ts"]   = event.startNs / 1000.0;     // microseconds
+    obj["dur"]  = event.durationNs / 1000.0;  // microseconds
+    obj["pid"]  = static_cast<double>(pid);
+    obj["tid"]  = event.threadId;
+    array.append(obj);
+  }
+  QJsonObject root;
+  root["traceEvents"]     = array;
+  root["displayTimeUnit"] = QString("ms");
+  if (droppedEvents > 0) {
+    QJsonObject metadata;
+    metadata["dropped_events"] = droppedEvents;
+    root["metadata"]           = metadata;
+  }
+  return QJsonDocument(root).toJson(QJsonDocument::Compact);
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace librepcb
@@ -0,0 +1,116 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_TRACER_H
+#define LIBREPCB_TRACER_H
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "fileio/filepath.h"
+
+#include <QtCore>
+
+#include <atomic>
+
+/*******************************************************************************
+ *  Namespace / Forward Declarations
+ ******************************************************************************/
+namespace librepcb {
+
+/*******************************************************************************
+ *  Class Tracer
+ ******************************************************************************/
+
+/**
+ * @brief Records trace events and writes them as a Chrome trace JSON file
+ *
+ * This is the second sink of ::librepcb::ProfilerScope (resp.
+ * #LIBREPCB_PROFILE_SCOPE()), besides the phase summary of
+ * ::librepcb::Profiler. While tracing is active, every scope records a
+ * "complete" event with its start time and duration. When tracing is stopped,
+ * all recorded events are written to the trace file in the Trace Event Format,
+ * which can be opened with `chrome://tracing` or https://ui.perfetto.dev/.
+ *
+ * Tracing is started either by setting the environment variable
+ * `LIBREPCB_TRACE_FILE` to the path of the trace file (see
+ * #startFromEnvironment()), or by the corresponding workspace setting.
+ *
+ * To limit memory usage, at most #sMaxEvents events are recorded, later events
+ * are dropped.
+ */
+class Tracer final {
+  Q_DECLARE_TR_FUNCTIONS(Tracer)
+
+public:
+  // Constructors / Destructor
+  Tracer()                    = delete;
+  Tracer(const Tracer& other) = delete;
+  ~Tracer()                   = delete;
+
+  // Getters
+  static bool isActive() noexcept {
+    return sActive.load(std::memory_order_relaxed);
+  }
+  static FilePath getFilePath() noexcept;
+  static qint64   getTimestampNs() noexcept;
+
+  // General Methods
+  static void start(const FilePath& fp) noexcept;
+  static void startFromEnvironment() noexcept;
+  static void stop() noexcept;
+  static void addEvent(const char* name, qint64 startNs,
+                       qint64 durationNs) noexcept;
+
+  // Operator Overloadings
+  Tracer& operator=(const Tracer& rhs) = delete;
+
+  // Static Variables
+  static constexpr int sMaxEvents = 1000000;
+
+private:  // Types
+  struct Event {
+    const char* name;
+    int         threadId;
+    qint64      startNs;
+    qint64      durationNs;
+  };
+
+private:  // Methods
+  static qint64     getSteadyClockNs() noexcept;
+  static QByteArray toJson(const QVector<Event>& events,
+                           int                   droppedEvents) noexcept;
+
+private:  // Data
+  static std::atomic<bool>   sActive;
+  static std::atomic<qint64> sStartTimeNs;  ///< Steady clock time of start()
+  static std::atomic<int>    sNextThreadId;
+  static QMutex              sMutex;
+  static FilePath            sFilePath;
+  static QVector<Event>      sEvents;
+  static int                 sDroppedEvents;
+};
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace librepcb
+
+#endif  // LIBREPCB_TRACER_H
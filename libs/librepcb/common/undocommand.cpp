@@ -41,10 +41,29 @@ UndoCommand::~UndoCommand() noexcept {
   Q_ASSERT(qAbs(mRedoCount - mUndoCount) <= 1);
 }
 
+/*******************************************************************************
+ *  Getters
+ ******************************************************************************/
+
+qint64 UndoCommand::getMemoryUsage() const noexcept {
+  return sizeof(UndoCommand) + mText.capacity() * sizeof(QChar);
+}
+
+bool UndoCommand::canMergeWith(const UndoCommand& other) const noexcept {
+  Q_UNUSED(other);
+  return false;
+}
+
 /*******************************************************************************
  *  General Methods
  ******************************************************************************/
 
+void UndoCommand::mergeWith(const UndoCommand& other) noexcept {
+  Q_UNUSED(other);
+  Q_ASSERT(false);  // canMergeWith() returned false
+}
+
+
 bool UndoCommand::execute() {
   if (mIsExecuted) {
     throw LogicError(__FILE__, __LINE__);
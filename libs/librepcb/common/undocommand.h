@@ -80,8 +80,40 @@ public:
    */
   bool isCurrentlyExecuted() const noexcept { return mRedoCount > mUndoCount; }
 
+  /**
+   * @brief Get the approximate memory usage of this command
+   *
+   * Used by librepcb::UndoStack to limit the memory usage of its history. The
+   * default implementation counts only the base object and its text, so
+   * commands holding larger data (e.g. paths) should override this method.
+   *
+   * @return Approximate memory usage in bytes
+   */
+  virtual qint64 getMemoryUsage() const noexcept;
+
+  /**
+   * @brief Check whether another command can be merged into this command
+   *
+   * @param other     The command which was executed directly after this one
+   *
+   * @retval true     If #mergeWith() can be called with the passed command
+   * @retval false    If the commands can't be merged (the default)
+   */
+  virtual bool canMergeWith(const UndoCommand& other) const noexcept;
+
   // General Methods
 
+  /**
+   * @brief Merge another command into this command
+   *
+   * Afterwards this command represents the changes of both commands, so
+   * "other" can be deleted without undoing it.
+   *
+   * @param other     The command to merge (#canMergeWith() must have returned
+   *                  true for it)
+   */
+  virtual void mergeWith(const UndoCommand& other) noexcept;
+
   /**
    * @brief Execute the command (must only be called once)
    *
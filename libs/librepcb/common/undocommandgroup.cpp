@@ -23,9 +23,12 @@
 #include "undocommandgroup.h"
 
 #include "scopeguardlist.h"
+#include "signalslot.h"
 
 #include <QtCore>
 
+#include <typeinfo>
+
 /*******************************************************************************
  *  Namespace
  ******************************************************************************/
@@ -46,6 +49,35 @@ UndoCommandGroup::~UndoCommandGroup() noexcept {
   }
 }
 
+/*******************************************************************************
+ *  Getters
+ ******************************************************************************/
+
+qint64 UndoCommandGroup::getMemoryUsage() const noexcept {
+  qint64 usage = UndoCommand::getMemoryUsage() +
+                 mChilds.count() * sizeof(UndoCommand*);
+  foreach (const UndoCommand* cmd, mChilds) {
+    usage += cmd->getMemoryUsage();
+  }
+  return usage;
+}
+
+bool UndoCommandGroup::canMergeWith(const UndoCommand& other) const noexcept {
+  const UndoCommandGroup* group = dynamic_cast<const UndoCommandGroup*>(&other);
+  if ((!group) || (typeid(*group) != typeid(*this)) ||
+      (group->getText() != getText()) || (!isCurrentlyExecuted()) ||
+      (!group->isCurrentlyExecuted()) || (mChilds.isEmpty()) ||
+      (group->mChilds.count() != mChilds.count())) {
+    return false;
+  }
+  for (int i = 0; i < mChilds.count(); ++i) {
+    if (!mChilds.at(i)->canMergeWith(*group->mChilds.at(i))) {
+      return false;
+    }
+  }
+  return true;
+}
+
 /*******************************************************************************
  *  General Methods
  ******************************************************************************/
@@ -73,11 +105,20 @@ bool UndoCommandGroup::appendChild(UndoCommand* cmd) {
   return false;
 }
 
+void UndoCommandGroup::mergeWith(const UndoCommand& other) noexcept {
+  Q_ASSERT(canMergeWith(other));
+  const UndoCommandGroup& group = dynamic_cast<const UndoCommandGroup&>(other);
+  for (int i = 0; i < mChilds.count(); ++i) {
+    mChilds.at(i)->mergeWith(*group.mChilds.at(i));
+  }
+}
+
 /*******************************************************************************
  *  Inherited from UndoCommand
  ******************************************************************************/
 
 bool UndoCommandGroup::performExecute() {
+  SignalBatch batch;  // coalesce notifications of all child commands
   bool           modified = false;
   ScopeGuardList sgl(mChilds.count());
   for (int i = 0; i < mChilds.count(); ++i) {  // from bottom to top
@@ -92,6 +133,7 @@ bool UndoCommandGroup::performExecute() {
 }
 
 void UndoCommandGroup::performUndo() {
+  SignalBatch batch;
   ScopeGuardList sgl(mChilds.count());
   for (int i = mChilds.count() - 1; i >= 0; --i) {  // from top to bottom
     UndoCommand* cmd = mChilds.at(i);
@@ -102,6 +144,7 @@ void UndoCommandGroup::performUndo() {
 }
 
 void UndoCommandGroup::performRedo() {
+  SignalBatch batch;
   ScopeGuardList sgl(mChilds.count());
   for (int i = 0; i < mChilds.count(); ++i) {  // from bottom to top
     UndoCommand* cmd = mChilds.at(i);
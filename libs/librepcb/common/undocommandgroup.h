@@ -56,6 +56,17 @@ public:
   // Getters
   int getChildCount() const noexcept { return mChilds.count(); }
 
+  /// @copydoc UndoCommand::getMemoryUsage()
+  virtual qint64 getMemoryUsage() const noexcept override;
+
+  /**
+   * @copydoc UndoCommand::canMergeWith()
+   *
+   * Groups of the same type and text can be merged if all their child commands
+   * can be merged pairwise, e.g. repeated moves of the same selection.
+   */
+  virtual bool canMergeWith(const UndoCommand& other) const noexcept override;
+
   // General Methods
 
   /**
@@ -75,6 +86,9 @@ public:
    */
   bool appendChild(UndoCommand* cmd);
 
+  /// @copydoc UndoCommand::mergeWith()
+  virtual void mergeWith(const UndoCommand& other) noexcept override;
+
   // Operator Overloadings
   UndoCommandGroup& operator=(const UndoCommandGroup& rhs) = delete;
 
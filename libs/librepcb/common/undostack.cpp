@@ -22,6 +22,7 @@
  ******************************************************************************/
 #include "undostack.h"
 
+#include "profiler.h"
 #include "undocommand.h"
 #include "undocommandgroup.h"
 
@@ -77,7 +78,10 @@ UndoStack::UndoStack() noexcept
   : QObject(nullptr),
     mCurrentIndex(0),
     mCleanIndex(0),
-    mActiveCommandGroup(nullptr) {
+    mActiveCommandGroup(nullptr),
+    mMemoryUsage(0),
+    mMemoryLimit(sDefaultMemoryLimit),
+    mMergeInterval(sDefaultMergeInterval) {
 }
 
 UndoStack::~UndoStack() noexcept {
@@ -130,11 +134,22 @@ void UndoStack::setClean() noexcept {
   emit cleanChanged(true);
 }
 
+void UndoStack::setMemoryLimit(qint64 limit) noexcept {
+  mMemoryLimit = limit;
+  limitMemoryUsage();
+}
+
+void UndoStack::setMergeInterval(int interval) noexcept {
+  mMergeInterval = interval;
+}
+
 /*******************************************************************************
  *  General Methods
  ******************************************************************************/
 
 bool UndoStack::execCmd(UndoCommand* cmd, bool forceKeepCmd) {
+  LIBREPCB_PROFILE_SCOPE("Execute undo command");
+
   // make sure "cmd" is deleted when going out of scope (e.g. because of an
   // exception)
   QScopedPointer<UndoCommand> cmdScopeGuard(cmd);
@@ -158,17 +173,35 @@ bool UndoStack::execCmd(UndoCommand* cmd, bool forceKeepCmd) {
     // impossible)
     // --> in reverse order (from top to bottom)!
     while (mCurrentIndex < mCommands.count()) {
-      delete mCommands.takeLast();
+      deleteLastCmd();
     }
     Q_ASSERT(mCurrentIndex == mCommands.count());
 
-    // add command to the command stack
-    mCommands.append(
-        cmdScopeGuard.take());  // move ownership of "cmd" to "mCommands"
-    mCurrentIndex++;
+    // merge the command into the previous one if possible (but not across the
+    // clean state), otherwise add it to the command stack
+    bool merge = (!forceKeepCmd) && (mCurrentIndex > 0) &&
+                 (mCleanIndex != mCurrentIndex) && (mMergeInterval > 0) &&
+                 mLastCommandTimer.isValid() &&
+                 (mLastCommandTimer.elapsed() <= mMergeInterval) &&
+                 mCommands.last()->canMergeWith(*cmd);
+    if (merge) {
+      mCommands.last()->mergeWith(*cmd);  // "cmd" is deleted by scope guard
+      updateLastCmdMemoryUsage();
+    } else {
+      appendCmd(cmdScopeGuard.take());  // move ownership to "mCommands"
+      mCurrentIndex++;
+    }
+
+    // only commands pushed directly (not command groups) are merged
+    if (forceKeepCmd) {
+      mLastCommandTimer.invalidate();
+    } else {
+      mLastCommandTimer.start();
+      limitMemoryUsage();
+    }
 
     // emit signals
-    emit undoTextChanged(QString(tr("Undo: %1")).arg(cmd->getText()));
+    emit undoTextChanged(getUndoText());
     emit redoTextChanged(tr("Redo"));
     emit canUndoChanged(true);
     emit canRedoChanged(false);
@@ -236,6 +269,10 @@ bool UndoStack::commitCmdGroup() {
   // the currently active command group
   mActiveCommandGroup = nullptr;
 
+  // the command group has grown since it was pushed
+  updateLastCmdMemoryUsage();
+  limitMemoryUsage();
+
   // emit signals
   emit canUndoChanged(canUndo());
   emit commandGroupEnded();
@@ -254,8 +291,8 @@ void UndoStack::abortCmdGroup() {
     mActiveCommandGroup->undo();  // can throw (but should usually not)
     mActiveCommandGroup = nullptr;
     mCurrentIndex--;
-    delete mCommands.takeLast();  // delete and remove the aborted command group
-                                  // from the stack
+    deleteLastCmd();  // delete and remove the aborted command group from the
+                      // stack
   } catch (Exception& e) {
     qCritical() << "UndoCommand::undo() has thrown an exception:" << e.getMsg();
     throw;
@@ -279,6 +316,7 @@ void UndoStack::undo() {
   try {
     mCommands[mCurrentIndex - 1]->undo();  // can throw (but should usually not)
     mCurrentIndex--;
+    mLastCommandTimer.invalidate();  // don't merge with undone commands
   } catch (Exception& e) {
     qCritical() << "UndoCommand::undo() has thrown an exception:" << e.getMsg();
     throw;
@@ -301,6 +339,7 @@ void UndoStack::redo() {
   try {
     mCommands[mCurrentIndex]->redo();  // can throw (but should usually not)
     mCurrentIndex++;
+    mLastCommandTimer.invalidate();  // don't merge with redone commands
   } catch (Exception& e) {
     qCritical() << "UndoCommand::redo() has thrown an exception:" << e.getMsg();
     throw;
@@ -331,12 +370,15 @@ void UndoStack::clear() noexcept {
   // delete all commands in the stack from top to bottom (newest first, oldest
   // last)!
   while (!mCommands.isEmpty()) {
-    delete mCommands.takeLast();
+    deleteLastCmd();
   }
+  Q_ASSERT(mMemoryUsages.isEmpty());
 
   mCurrentIndex       = 0;
   mCleanIndex         = 0;
   mActiveCommandGroup = nullptr;
+  mMemoryUsage        = 0;
+  mLastCommandTimer.invalidate();
 
   // emit signals
   emit undoTextChanged(tr("Undo"));
@@ -346,6 +388,54 @@ void UndoStack::clear() noexcept {
   emit cleanChanged(true);
 }
 
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+void UndoStack::appendCmd(UndoCommand* cmd) noexcept {
+  qint64 usage = cmd->getMemoryUsage();
+  mCommands.append(cmd);
+  mMemoryUsages.append(usage);
+  mMemoryUsage += usage;
+}
+
+void UndoStack::deleteLastCmd() noexcept {
+  delete mCommands.takeLast();
+  mMemoryUsage -= mMemoryUsages.takeLast();
+}
+
+void UndoStack::updateLastCmdMemoryUsage() noexcept {
+  qint64 usage = mCommands.last()->getMemoryUsage();
+  mMemoryUsage += usage - mMemoryUsages.last();
+  mMemoryUsages.last() = usage;
+}
+
+void UndoStack::limitMemoryUsage() noexcept {
+  if (mMemoryLimit <= 0) {
+    return;  // unlimited
+  }
+
+  // Delete the oldest commands, but never the command on top of the undo
+  // stack (which also protects the active command group, if any). Commands
+  // above the current index are not deleted as they can be redone.
+  //
+  // Note that #clear() and #execCmd() delete commands newest first because
+  // undone commands may reference objects owned by older undone commands
+  // (e.g. an edit of an item which was added by the previous command). Here
+  // only executed commands are deleted, for which the dependencies point the
+  // other way: an executed command may own objects it removed, and only
+  // older commands may still reference them. So deleting from the front
+  // never leaves a remaining command with a dangling reference.
+  while ((mMemoryUsage > mMemoryLimit) && (mCurrentIndex > 1)) {
+    delete mCommands.takeFirst();
+    mMemoryUsage -= mMemoryUsages.takeFirst();
+    mCurrentIndex--;
+    if (mCleanIndex >= 0) {
+      mCleanIndex--;  // becomes -1 if the clean state was deleted
+    }
+  }
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
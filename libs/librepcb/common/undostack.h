@@ -180,6 +180,27 @@ public:
    */
   bool isCommandGroupActive() const noexcept;
 
+  /**
+   * @brief Get the approximate memory usage of all commands in the stack
+   *
+   * @return Sum of UndoCommand#getMemoryUsage() of all commands [bytes]
+   */
+  qint64 getMemoryUsage() const noexcept { return mMemoryUsage; }
+
+  /**
+   * @brief Get the memory limit (see #setMemoryLimit())
+   *
+   * @return Memory limit in bytes (0 = unlimited)
+   */
+  qint64 getMemoryLimit() const noexcept { return mMemoryLimit; }
+
+  /**
+   * @brief Get the merge interval (see #setMergeInterval())
+   *
+   * @return Merge interval in milliseconds (0 = merging disabled)
+   */
+  int getMergeInterval() const noexcept { return mMergeInterval; }
+
   // Setters
 
   /**
@@ -187,6 +208,31 @@ public:
    */
   void setClean() noexcept;
 
+  /**
+   * @brief Set the maximum memory usage of the stack
+   *
+   * If the commands in the stack use more memory than this limit (see
+   * #getMemoryUsage()), the oldest commands are deleted, so they can no longer
+   * be undone. The command on top of the stack is never deleted, and neither
+   * are commands which can be redone, so only executed commands get deleted.
+   *
+   * @param limit     Memory limit in bytes (0 = unlimited)
+   */
+  void setMemoryLimit(qint64 limit) noexcept;
+
+  /**
+   * @brief Set the interval within which consecutive commands are merged
+   *
+   * If a command is executed within this interval after the previous command
+   * was pushed and UndoCommand#canMergeWith() of the previous command returns
+   * true, the new command is merged into the previous one instead of being
+   * pushed (e.g. repeated moves of the same selection become a single undo
+   * step). Commands are never merged across the clean state.
+   *
+   * @param interval  Interval in milliseconds (0 = never merge commands)
+   */
+  void setMergeInterval(int interval) noexcept;
+
   // General Methods
 
   /**
@@ -303,7 +349,13 @@ signals:
   void commandGroupAborted();
   void stateModified();
 
-private:
+private:  // Methods
+  void appendCmd(UndoCommand* cmd) noexcept;
+  void deleteLastCmd() noexcept;
+  void updateLastCmdMemoryUsage() noexcept;
+  void limitMemoryUsage() noexcept;
+
+private:  // Data
   /**
    * @brief This list holds all commands of the undo stack
    *
@@ -337,6 +389,18 @@ private:
    * nullptr.
    */
   UndoCommandGroup* mActiveCommandGroup;
+
+  /// Approximate memory usage of each command in #mCommands [bytes]
+  QList<qint64> mMemoryUsages;
+  qint64        mMemoryUsage;  ///< Sum of #mMemoryUsages [bytes]
+  qint64        mMemoryLimit;  ///< See #setMemoryLimit()
+
+  int           mMergeInterval;     ///< See #setMergeInterval()
+  QElapsedTimer mLastCommandTimer;  ///< Invalid if merging is not allowed
+
+  // Static Variables
+  static constexpr qint64 sDefaultMemoryLimit   = 200 * 1024 * 1024;
+  static constexpr int    sDefaultMergeInterval = 1000;
 };
 
 /*******************************************************************************
@@ -22,6 +22,8 @@
  ******************************************************************************/
 #include "clipperhelpers.h"
 
+#include "spatialindex.h"
+
 #include <QtCore>
 
 /*******************************************************************************
@@ -45,6 +47,27 @@ void ClipperHelpers::offset(ClipperLib::Paths& paths, const Length& offset,
   }
 }
 
+ClipperLib::Paths ClipperHelpers::clip(const ClipperLib::Paths& subject,
+                                       const ClipperLib::Paths& clip,
+                                       ClipperLib::ClipType     type,
+                                       ClipperLib::PolyFillType fillType) {
+  ClipperLib::Paths result;
+  bool              success = false;
+  try {
+    ClipperLib::Clipper c;
+    c.AddPaths(subject, ClipperLib::ptSubject, true);
+    c.AddPaths(clip, ClipperLib::ptClip, true);
+    success = c.Execute(type, result, fillType, fillType);
+  } catch (const std::exception& e) {
+    throw LogicError(__FILE__, __LINE__,
+                     QString(tr("Failed to clip paths: %1")).arg(e.what()));
+  }
+  if (!success) {
+    throw LogicError(__FILE__, __LINE__, tr("Failed to clip paths."));
+  }
+  return result;
+}
+
 ClipperLib::Paths ClipperHelpers::flattenTree(
     const ClipperLib::PolyNode& node) {
   ClipperLib::Paths paths;
@@ -105,18 +128,21 @@ ClipperLib::Paths ClipperHelpers::convert(
 ClipperLib::Path ClipperHelpers::convert(
     const Path& path, const PositiveLength& maxArcTolerance) noexcept {
   ClipperLib::Path p;
+  p.reserve(path.getVertices().count());
   for (int i = 0; i < path.getVertices().count(); ++i) {
     const Vertex& v  = path.getVertices().at(i);
     const Vertex& v0 = path.getVertices().at(qMax(i - 1, 0));
     if ((i == 0) || (v0.getAngle() == 0)) {
       p.push_back(convert(v.getPos()));
     } else {
-      // approximate arcs by many short straight line segments
-      Path arc = Path::flatArc(v0.getPos(), v.getPos(), v0.getAngle(),
-                               maxArcTolerance);
-      // skip first point as it is would be a duplicate
-      for (int k = 1; k < arc.getVertices().count(); ++k) {
-        p.push_back(convert(arc.getVertices().at(k).getPos()));
+      // approximate arcs by many short straight line segments (without the
+      // start point as it would be a duplicate)
+      QVector<Point> offsets = Path::flatArcOffsets(
+          v.getPos() - v0.getPos(), v0.getAngle(), maxArcTolerance);
+      ClipperLib::IntPoint start = convert(v0.getPos());
+      foreach (const Point& offset, offsets) {
+        p.push_back(ClipperLib::IntPoint(start.X + offset.getX().toNm(),
+                                         start.Y + offset.getY().toNm()));
       }
     }
   }
@@ -138,12 +164,20 @@ ClipperLib::IntPoint ClipperHelpers::convert(const Point& point) noexcept {
 
 ClipperLib::Path ClipperHelpers::convertHolesToCutIns(
     const ClipperLib::Path& outline, const ClipperLib::Paths& holes) {
-  ClipperLib::Path  path          = outline;
   ClipperLib::Paths preparedHoles = prepareHoles(holes);
+  if (preparedHoles.empty()) {
+    return outline;
+  }
+
+  // the outline is the first path, followed by the sorted holes
+  QVector<const ClipperLib::Path*> paths;
+  paths.reserve(preparedHoles.size() + 1);
+  paths.append(&outline);
   for (const ClipperLib::Path& hole : preparedHoles) {
-    addCutInToPath(path, hole);  // can throw
+    paths.append(&hole);
   }
-  return path;
+  QVector<QVector<CutIn>> cutIns = calcCutIns(paths);  // can throw
+  return joinCutIns(paths, cutIns);
 }
 
 ClipperLib::Paths ClipperHelpers::prepareHoles(
@@ -187,37 +221,139 @@ int ClipperHelpers::getHoleConnectionPointIndex(
   return index;
 }
 
-void ClipperHelpers::addCutInToPath(ClipperLib::Path&       outline,
-                                    const ClipperLib::Path& hole) {
-  int index = insertConnectionPointToPath(outline, hole.front());  // can throw
-  outline.insert(outline.begin() + index, hole.begin(), hole.end());
-}
-
-int ClipperHelpers::insertConnectionPointToPath(ClipperLib::Path& path,
-                                                const ClipperLib::IntPoint& p) {
-  int                  nearestIndex = -1;
-  ClipperLib::IntPoint nearestPoint;
-  for (size_t i = 0; i < path.size(); ++i) {
-    ClipperLib::cInt y;
-    if (calcIntersectionPos(path.at(i), path.at((i + 1) % path.size()), p.X,
-                            y)) {
-      if ((y <= p.Y) &&
-          ((nearestIndex < 0) || (p.Y - y < p.Y - nearestPoint.Y))) {
-        nearestIndex = i;
-        nearestPoint = ClipperLib::IntPoint(p.X, y);
+QVector<QVector<ClipperHelpers::CutIn>> ClipperHelpers::calcCutIns(
+    const QVector<const ClipperLib::Path*>& paths) {
+  // the holes are always inside the outline, so its bounding box is enough
+  const ClipperLib::Path& outline = *paths.first();
+  ClipperLib::cInt        left    = outline.front().X;
+  ClipperLib::cInt        right   = outline.front().X;
+  ClipperLib::cInt        bottom  = outline.front().Y;
+  ClipperLib::cInt        top     = outline.front().Y;
+  for (const ClipperLib::IntPoint& p : outline) {
+    left   = qMin(left, p.X);
+    right  = qMax(right, p.X);
+    bottom = qMin(bottom, p.Y);
+    top    = qMax(top, p.Y);
+  }
+
+  // add the edges of all paths to a spatial index, with roughly one edge per
+  // grid cell
+  QVector<QPair<int, int>> edges;  // path index, vertex index
+  for (int i = 0; i < paths.count(); ++i) {
+    for (std::size_t k = 0; k < paths.at(i)->size(); ++k) {
+      edges.append(qMakePair(i, static_cast<int>(k)));
+    }
+  }
+  qreal          area = qreal(right - left + 1) * qreal(top - bottom + 1);
+  PositiveLength cellSize(qMax(
+      LengthBase_t(1), static_cast<LengthBase_t>(qSqrt(area / edges.count()))));
+  SpatialIndex index(cellSize);
+  foreach (const auto& edge, edges) {
+    const ClipperLib::Path& path = *paths.at(edge.first);
+    index.insert(convert(path.at(edge.second)),
+                 convert(path.at((edge.second + 1) % path.size())));
+  }
+
+  // For each hole, search the nearest edge below its connection point. Only
+  // the outline and the holes connected before (i.e. with a lower connection
+  // point) are taken into account. The search area is extended downwards
+  // until an edge is found within it.
+  QVector<QVector<CutIn>> cutIns(paths.count());
+  for (int i = 1; i < paths.count(); ++i) {
+    const ClipperLib::IntPoint& p           = paths.at(i)->front();
+    int                         nearestEdge = -1;
+    ClipperLib::cInt            nearestY    = 0;
+    for (ClipperLib::cInt height = cellSize->toNm(); nearestEdge < 0;
+         height *= 2) {
+      ClipperLib::cInt minY = qMax(p.Y - height, bottom);
+      foreach (int id, index.query(convert(ClipperLib::IntPoint(p.X, minY)),
+                                   convert(p))) {
+        const QPair<int, int>& edge = edges.at(id);
+        if (edge.first >= i) {
+          continue;  // hole is not connected yet
+        }
+        const ClipperLib::Path& path = *paths.at(edge.first);
+        ClipperLib::cInt        y;
+        if (calcIntersectionPos(path.at(edge.second),
+                                path.at((edge.second + 1) % path.size()), p.X,
+                                y) &&
+            (y <= p.Y) && (y >= minY) &&
+            ((nearestEdge < 0) || (y > nearestY))) {
+          nearestEdge = id;
+          nearestY    = y;
+        }
+      }
+      if ((nearestEdge < 0) && (minY <= bottom)) {
+        throw LogicError(__FILE__, __LINE__,
+                         tr("Failed to calculate the connection point of a "
+                            "cut-in to an outline!"));
       }
     }
+    const QPair<int, int>& edge = edges.at(nearestEdge);
+    cutIns[edge.first].append(
+        CutIn{i, edge.second, ClipperLib::IntPoint(p.X, nearestY)});
   }
-  if (nearestIndex >= 0) {
-    path.insert(path.begin() + nearestIndex + 1, nearestPoint);
-    path.insert(path.begin() + nearestIndex + 1, p);
-    path.insert(path.begin() + nearestIndex + 1, nearestPoint);
-    return nearestIndex + 2;
-  } else {
-    throw LogicError(__FILE__, __LINE__,
-                     tr("Failed to calculate the connection point of a cut-in "
-                        "to an outline!"));
+
+  // sort the cut-ins of each path in the order they appear along the path
+  for (int i = 0; i < cutIns.count(); ++i) {
+    const ClipperLib::Path& path = *paths.at(i);
+    std::stable_sort(cutIns[i].begin(), cutIns[i].end(),
+                     [&path](const CutIn& a, const CutIn& b) {
+                       if (a.edge != b.edge) {
+                         return a.edge < b.edge;
+                       }
+                       const ClipperLib::IntPoint& p1 = path.at(a.edge);
+                       const ClipperLib::IntPoint& p2 =
+                           path.at((a.edge + 1) % path.size());
+                       return (p2.X > p1.X) ? (a.point.X < b.point.X)
+                                            : (a.point.X > b.point.X);
+                     });
+  }
+  return cutIns;
+}
+
+ClipperLib::Path ClipperHelpers::joinCutIns(
+    const QVector<const ClipperLib::Path*>& paths,
+    const QVector<QVector<CutIn>>&          cutIns) noexcept {
+  std::size_t size = 0;
+  foreach (const ClipperLib::Path* path, paths) {
+    size += path->size() + 3;  // hole + closing point + 2 connection points
+  }
+  ClipperLib::Path result;
+  result.reserve(size);
+
+  // Traverse the tree of cut-ins depth-first. An explicit stack is used since
+  // cut-ins may be nested very deeply (e.g. a long column of holes).
+  struct Frame {
+    int                  path;
+    std::size_t          vertex;      ///< Next vertex to append
+    int                  cutIn;       ///< Next cut-in to append
+    ClipperLib::IntPoint connection;  ///< Connection point of a hole
+  };
+  QVector<Frame> stack;
+  stack.append(Frame{0, 0, 0, ClipperLib::IntPoint()});
+  while (!stack.isEmpty()) {
+    Frame&                  frame   = stack.last();
+    const ClipperLib::Path& path    = *paths.at(frame.path);
+    const QVector<CutIn>&   pending = cutIns.at(frame.path);
+    if ((frame.cutIn < pending.count()) &&
+        (static_cast<std::size_t>(pending.at(frame.cutIn).edge) <
+         frame.vertex)) {
+      // the edge after the last appended vertex has a cut-in
+      const CutIn& cutIn = pending.at(frame.cutIn++);
+      result.push_back(cutIn.point);
+      stack.append(Frame{cutIn.hole, 0, 0, cutIn.point});
+    } else if (frame.vertex < path.size()) {
+      result.push_back(path.at(frame.vertex++));
+    } else {
+      if (frame.path > 0) {
+        result.push_back(path.front());      // close the hole
+        result.push_back(frame.connection);  // back to the connected edge
+      }
+      stack.removeLast();
+    }
   }
+  return result;
 }
 
 bool ClipperHelpers::calcIntersectionPos(const ClipperLib::IntPoint& p1,
@@ -52,6 +52,10 @@ public:
   // General Methods
   static void offset(ClipperLib::Paths& paths, const Length& offset,
                      const PositiveLength& maxArcTolerance);
+  static ClipperLib::Paths clip(
+      const ClipperLib::Paths& subject, const ClipperLib::Paths& clip,
+      ClipperLib::ClipType     type,
+      ClipperLib::PolyFillType fillType = ClipperLib::pftNonZero);
   static ClipperLib::Paths flattenTree(const ClipperLib::PolyNode& node);
 
   // Type Conversions
@@ -65,6 +69,13 @@ public:
       const Path& path, const PositiveLength& maxArcTolerance) noexcept;
   static ClipperLib::IntPoint convert(const Point& point) noexcept;
 
+private:  // Types
+  struct CutIn {
+    int                  hole;   ///< Index of the hole to connect
+    int                  edge;   ///< Index of the edge to connect it to
+    ClipperLib::IntPoint point;  ///< Connection point on that edge
+  };
+
 private:  // Internal Helper Methods
   static ClipperLib::Path  convertHolesToCutIns(const ClipperLib::Path&  outline,
                                                 const ClipperLib::Paths& holes);
@@ -73,10 +84,11 @@ private:  // Internal Helper Methods
   static ClipperLib::Path rotateCutInHole(
       const ClipperLib::Path& hole) noexcept;
   static int getHoleConnectionPointIndex(const ClipperLib::Path& hole) noexcept;
-  static void addCutInToPath(ClipperLib::Path&       outline,
-                             const ClipperLib::Path& hole);
-  static int  insertConnectionPointToPath(ClipperLib::Path&           path,
-                                          const ClipperLib::IntPoint& p);
+  static QVector<QVector<CutIn>> calcCutIns(
+      const QVector<const ClipperLib::Path*>& paths);
+  static ClipperLib::Path joinCutIns(
+      const QVector<const ClipperLib::Path*>& paths,
+      const QVector<QVector<CutIn>>&          cutIns) noexcept;
   static bool calcIntersectionPos(const ClipperLib::IntPoint& p1,
                                   const ClipperLib::IntPoint& p2,
                                   const ClipperLib::cInt&     x,
@@ -0,0 +1,134 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "spatialindex.h"
+
+#include <QtCore>
+
+#include <algorithm>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+
+/*******************************************************************************
+ *  Constructors / Destructor
+ ******************************************************************************/
+
+SpatialIndex::SpatialIndex(const PositiveLength& cellSize) noexcept
+  : mCellSize(cellSize) {
+}
+
+SpatialIndex::~SpatialIndex() noexcept {
+}
+
+/*******************************************************************************
+ *  General Methods
+ ******************************************************************************/
+
+int SpatialIndex::insert(const Point& p1, const Point& p2) noexcept {
+  int index = mBoxes.count();
+  Box box   = toBox(p1, p2);
+  mBoxes.append(box);
+  for (qint64 x = getCellIndex(box.left); x <= getCellIndex(box.right); ++x) {
+    for (qint64 y = getCellIndex(box.bottom); y <= getCellIndex(box.top);
+         ++y) {
+      mCells[Cell(x, y)].append(index);
+    }
+  }
+  return index;
+}
+
+QVector<int> SpatialIndex::query(const Point& p1, const Point& p2) const
+    noexcept {
+  Box          box = toBox(p1, p2);
+  QVector<int> result;
+  for (qint64 x = getCellIndex(box.left); x <= getCellIndex(box.right); ++x) {
+    for (qint64 y = getCellIndex(box.bottom); y <= getCellIndex(box.top);
+         ++y) {
+      auto it = mCells.constFind(Cell(x, y));
+      if (it == mCells.constEnd()) continue;
+      foreach (int index, *it) {
+        if (mBoxes.at(index).overlaps(box)) {
+          result.append(index);
+        }
+      }
+    }
+  }
+  // boxes covering several cells are found multiple times
+  std::sort(result.begin(), result.end());
+  result.erase(std::unique(result.begin(), result.end()), result.end());
+  return result;
+}
+
+QVector<QPair<int, int>> SpatialIndex::getOverlappingPairs() const noexcept {
+  QVector<QPair<int, int>> result;
+  for (auto it = mCells.constBegin(); it != mCells.constEnd(); ++it) {
+    const QVector<int>& indices = it.value();
+    for (int i = 0; i < indices.count(); ++i) {
+      const Box& a = mBoxes.at(indices.at(i));
+      for (int k = i + 1; k < indices.count(); ++k) {
+        const Box& b = mBoxes.at(indices.at(k));
+        if (!a.overlaps(b)) continue;
+        // Two boxes may share several cells, but only the cell containing the
+        // bottom left corner of their intersection reports the pair. This
+        // avoids duplicates without keeping track of the reported pairs.
+        Cell reference(getCellIndex(qMax(a.left, b.left)),
+                       getCellIndex(qMax(a.bottom, b.bottom)));
+        if (reference != it.key()) continue;
+        result.append(qMakePair(qMin(indices.at(i), indices.at(k)),
+                                qMax(indices.at(i), indices.at(k))));
+      }
+    }
+  }
+  std::sort(result.begin(), result.end());
+  return result;
+}
+
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+SpatialIndex::Box SpatialIndex::toBox(const Point& p1,
+                                      const Point& p2) noexcept {
+  return Box{qMin(p1.getX(), p2.getX()).toNm(),
+             qMin(p1.getY(), p2.getY()).toNm(),
+             qMax(p1.getX(), p2.getX()).toNm(),
+             qMax(p1.getY(), p2.getY()).toNm()};
+}
+
+qint64 SpatialIndex::getCellIndex(LengthBase_t coordinate) const noexcept {
+  // round towards negative infinity to get equally sized cells around zero
+  LengthBase_t size  = mCellSize->toNm();
+  qint64       index = coordinate / size;
+  if ((coordinate % size) < 0) {
+    --index;
+  }
+  return index;
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace librepcb
@@ -0,0 +1,128 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_SPATIALINDEX_H
+#define LIBREPCB_SPATIALINDEX_H
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "../units/all_length_units.h"
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace / Forward Declarations
+ ******************************************************************************/
+namespace librepcb {
+
+/*******************************************************************************
+ *  Class SpatialIndex
+ ******************************************************************************/
+
+/**
+ * @brief Uniform grid index to find overlapping axis-aligned bounding boxes
+ *
+ * Every inserted bounding box gets an index (in order of insertion) and is
+ * registered in all grid cells it covers. Queries then only need to look at
+ * the boxes registered in the covered cells instead of at all boxes.
+ *
+ * The grid works best if the cell size is in the order of magnitude of the
+ * typical box size. Very large boxes work as well, but are registered in many
+ * cells.
+ *
+ * @note All methods are reentrant, and const methods may be called from
+ *       several threads concurrently.
+ */
+class SpatialIndex final {
+public:
+  // Constructors / Destructor
+  SpatialIndex()                          = delete;
+  SpatialIndex(const SpatialIndex& other) = delete;
+  explicit SpatialIndex(const PositiveLength& cellSize) noexcept;
+  ~SpatialIndex() noexcept;
+
+  // Getters
+  const PositiveLength& getCellSize() const noexcept { return mCellSize; }
+  int                   count() const noexcept { return mBoxes.count(); }
+
+  // General Methods
+
+  /**
+   * @brief Add a bounding box to the index
+   *
+   * @param p1    One corner of the bounding box.
+   * @param p2    The opposite corner of the bounding box.
+   *
+   * @return The index of the inserted bounding box.
+   */
+  int insert(const Point& p1, const Point& p2) noexcept;
+
+  /**
+   * @brief Get all bounding boxes overlapping (or touching) the given box
+   *
+   * @param p1    One corner of the bounding box to search.
+   * @param p2    The opposite corner of the bounding box to search.
+   *
+   * @return Indices of the found bounding boxes in ascending order.
+   */
+  QVector<int> query(const Point& p1, const Point& p2) const noexcept;
+
+  /**
+   * @brief Get all pairs of overlapping (or touching) bounding boxes
+   *
+   * @return All pairs of box indices (lower index first), sorted ascending.
+   *         Every pair is contained only once.
+   */
+  QVector<QPair<int, int>> getOverlappingPairs() const noexcept;
+
+  // Operator Overloadings
+  SpatialIndex& operator=(const SpatialIndex& rhs) = delete;
+
+private:  // Types
+  struct Box {
+    LengthBase_t left;
+    LengthBase_t bottom;
+    LengthBase_t right;
+    LengthBase_t top;
+
+    bool overlaps(const Box& other) const noexcept {
+      return (left <= other.right) && (other.left <= right) &&
+             (bottom <= other.top) && (other.bottom <= top);
+    }
+  };
+  typedef QPair<qint64, qint64> Cell;
+
+private:  // Methods
+  static Box toBox(const Point& p1, const Point& p2) noexcept;
+  qint64     getCellIndex(LengthBase_t coordinate) const noexcept;
+
+private:  // Data
+  PositiveLength            mCellSize;
+  QVector<Box>              mBoxes;
+  QHash<Cell, QVector<int>> mCells;  ///< Box indices registered in each cell
+};
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace librepcb
+
+#endif  // LIBREPCB_SPATIALINDEX_H
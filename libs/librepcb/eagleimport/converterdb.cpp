@@ -22,6 +22,9 @@
  ******************************************************************************/
 #include "converterdb.h"
 
+#include <librepcb/common/fileio/fileutils.h>
+#include <librepcb/common/toolbox.h>
+
 #include <QtCore>
 
 /*******************************************************************************
@@ -35,10 +38,53 @@ namespace eagleimport {
  ******************************************************************************/
 
 ConverterDb::ConverterDb(const FilePath& ini) noexcept
-  : mIniFile(ini.toStr(), QSettings::IniFormat) {
+  : mRoot(this),
+    mFilePath(ini),
+    mLibFilePath(),
+    mMutex(),
+    mUuids(),
+    mModified(false) {
+  // read the whole file at once, accessing QSettings for every lookup is slow
+  QSettings settings(mFilePath.toStr(), QSettings::IniFormat);
+  foreach (const QString& key, settings.allKeys()) {
+    QString            value = settings.value(key).toString();
+    tl::optional<Uuid> uuid  = Uuid::tryFromString(value);
+    if (uuid) {
+      mUuids.insert(key, *uuid);
+    } else {
+      qWarning() << "Ignoring invalid UUID in converter database:" << key
+                 << value;
+    }
+  }
+}
+
+ConverterDb::ConverterDb(ConverterDb& parent, const FilePath& libFp) noexcept
+  : mRoot(parent.mRoot),
+    mFilePath(),
+    mLibFilePath(libFp),
+    mMutex(),
+    mUuids(),
+    mModified(false) {
 }
 
 ConverterDb::~ConverterDb() noexcept {
+  if (mRoot != this) {
+    return;  // entries are saved by the root database
+  }
+  try {
+    save();  // can throw
+  } catch (const Exception& e) {
+    qCritical() << "Could not save the converter database:" << e.getMsg();
+  }
+}
+
+/*******************************************************************************
+ *  Getters
+ ******************************************************************************/
+
+int ConverterDb::getEntryCount() const noexcept {
+  QMutexLocker lock(&mRoot->mMutex);
+  return mRoot->mUuids.count();
 }
 
 /*******************************************************************************
@@ -93,35 +139,80 @@ Uuid ConverterDb::getDeviceUuid(const QString& deviceSetName,
   return getOrCreateUuid("devices_to_devices", deviceSetName, deviceName);
 }
 
+void ConverterDb::save() {
+  if (mRoot != this) {
+    mRoot->save();  // can throw
+    return;
+  }
+
+  QMutexLocker lock(&mMutex);
+  if (!mModified) {
+    return;
+  }
+
+  // Write the file in the same format as QSettings does, but with sorted
+  // entries to get a deterministic file. Since all keys are escaped, there is
+  // no need to escape anything here.
+  QByteArray content;
+  QString    currentCategory;
+  foreach (const QString& key, Toolbox::sorted(mUuids.keys())) {
+    int     separator = key.indexOf('/');
+    QString category  = (separator >= 0) ? key.left(separator) : "General";
+    if ((category != currentCategory) || content.isEmpty()) {
+      if (!content.isEmpty()) {
+        content.append('\n');
+      }
+      content.append("[" + category.toUtf8() + "]\n");
+      currentCategory = category;
+    }
+    content.append(key.mid(separator + 1).toUtf8());
+    content.append('=');
+    content.append(mUuids.constFind(key)->toStr().toUtf8());
+    content.append('\n');
+  }
+  FileUtils::writeFile(mFilePath, content);  // can throw, writes atomically
+  mModified = false;
+}
+
 /*******************************************************************************
  *  Private Methods
  ******************************************************************************/
 
 Uuid ConverterDb::getOrCreateUuid(const QString& cat, const QString& key1,
                                   const QString& key2) {
-  QString allowedChars(
-      "_-.0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz");
-
-  QString settingsKey = mLibFilePath.getFilename() % '_' % key1 % '_' % key2;
-  settingsKey.replace("{", "");
-  settingsKey.replace("}", "");
-  settingsKey.replace(" ", "_");
-  for (int i = 0; i < settingsKey.length(); i++) {
-    if (!allowedChars.contains(settingsKey[i]))
-      settingsKey.replace(
-          i, 1,
-          QString("__U%1__").arg(
-              QString::number(settingsKey[i].unicode(), 16).toUpper()));
+  QString name = mLibFilePath.getFilename() % '_' % key1 % '_' % key2;
+  QString key  = cat % '/' % escapeKey(name);
+  QMutexLocker lock(&mRoot->mMutex);
+  auto         it = mRoot->mUuids.constFind(key);
+  if (it != mRoot->mUuids.constEnd()) {
+    return *it;
   }
-  settingsKey.prepend(cat % '/');
-
-  Uuid    uuid  = Uuid::createRandom();
-  QString value = mIniFile.value(settingsKey).toString();
-  if (!value.isEmpty()) uuid = Uuid::fromString(value);  // can throw
-  mIniFile.setValue(settingsKey, uuid.toStr());
+  Uuid uuid = Uuid::createRandom();
+  mRoot->mUuids.insert(key, uuid);
+  mRoot->mModified = true;
   return uuid;
 }
 
+QString ConverterDb::escapeKey(const QString& key) noexcept {
+  QString escaped;
+  escaped.reserve(key.length());
+  foreach (const QChar& c, key) {
+    ushort u = c.unicode();
+    if ((u == '{') || (u == '}')) {
+      // remove curly braces
+    } else if (u == ' ') {
+      escaped.append('_');
+    } else if (((u >= 'a') && (u <= 'z')) || ((u >= 'A') && (u <= 'Z')) ||
+               ((u >= '0') && (u <= '9')) || (u == '_') || (u == '-') ||
+               (u == '.')) {
+      escaped.append(c);
+    } else {
+      escaped.append("__U" % QString::number(u, 16).toUpper() % "__");
+    }
+  }
+  return escaped;
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
@@ -42,7 +42,17 @@ namespace eagleimport {
  ******************************************************************************/
 
 /**
- * @brief The ConverterDb class
+ * @brief Persistent mapping of Eagle library element names to UUIDs
+ *
+ * The mapping is stored in an INI file which is read completely into memory
+ * by the constructor. Lookups and newly created UUIDs only operate on the
+ * in-memory hash, the file is written atomically by #save() (or the
+ * destructor) and only if there were any changes.
+ *
+ * The UUID lookups are thread-safe. To convert elements of several libraries
+ * concurrently, create a child database per library (see
+ * #ConverterDb(ConverterDb&, const FilePath&)). It shares the entries of its
+ * parent, but has its own current library file path.
  */
 class ConverterDb final {
 public:
@@ -50,8 +60,21 @@ public:
   ConverterDb()                         = delete;
   ConverterDb(const ConverterDb& other) = delete;
   ConverterDb(const FilePath& ini) noexcept;
+
+  /**
+   * @brief Create a child database sharing the entries of another database
+   *
+   * @param parent  The database to share the entries with. It must outlive
+   *                the created child.
+   * @param libFp   The current library file path of the child.
+   */
+  ConverterDb(ConverterDb& parent, const FilePath& libFp) noexcept;
   ~ConverterDb() noexcept;
 
+  // Getters
+  const FilePath& getFilePath() const noexcept { return mRoot->mFilePath; }
+  int             getEntryCount() const noexcept;
+
   // General Methods
   void setCurrentLibraryFilePath(const FilePath& fp) noexcept {
     mLibFilePath = fp;
@@ -72,15 +95,28 @@ public:
                                 const QString& gateName);
   Uuid getDeviceUuid(const QString& deviceSetName, const QString& deviceName);
 
+  /**
+   * @brief Write all entries to the INI file, if there are any changes
+   *
+   * @throw Exception if the file could not be written.
+   */
+  void save();
+
   // Operator Overloadings
   ConverterDb& operator=(const ConverterDb& rhs) = delete;
 
-private:
+private:  // Methods
   Uuid getOrCreateUuid(const QString& cat, const QString& key1,
                        const QString& key2 = QString());
+  static QString escapeKey(const QString& key) noexcept;
 
-  QSettings mIniFile;
-  FilePath  mLibFilePath;
+private:  // Data
+  ConverterDb*         mRoot;  ///< Owner of the entries (`this` if no child)
+  FilePath             mFilePath;
+  FilePath             mLibFilePath;
+  mutable QMutex       mMutex;     ///< Protects #mUuids and #mModified
+  QHash<QString, Uuid> mUuids;     ///< Key: "category/key" as in the INI file
+  bool                 mModified;  ///< Whether #mUuids needs to be saved
 };
 
 /*******************************************************************************
@@ -10,7 +10,7 @@ TARGET = librepcbeagleimport
 # Use common project definitions
 include(../../../common.pri)
 
-QT += core widgets xml sql printsupport
+QT += core widgets xml sql printsupport concurrent
 
 CONFIG += staticlib
 
@@ -24,14 +24,18 @@ SOURCES += \
     converterdb.cpp \
     deviceconverter.cpp \
     devicesetconverter.cpp \
+    libraryconverter.cpp \
     packageconverter.cpp \
+    polygonsimplifier.cpp \
     symbolconverter.cpp \
 
 HEADERS += \
     converterdb.h \
     deviceconverter.h \
     devicesetconverter.h \
+    libraryconverter.h \
     packageconverter.h \
+    polygonsimplifier.h \
     symbolconverter.h \
 
 FORMS += \
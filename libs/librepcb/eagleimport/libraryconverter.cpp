@@ -0,0 +1,284 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "libraryconverter.h"
+
+#include "converterdb.h"
+#include "deviceconverter.h"
+#include "devicesetconverter.h"
+#include "packageconverter.h"
+#include "polygonsimplifier.h"
+#include "symbolconverter.h"
+
+#include <librepcb/common/exceptions.h>
+#include <librepcb/common/fileio/transactionaldirectory.h>
+#include <librepcb/common/fileio/transactionalfilesystem.h>
+#include <librepcb/library/cmp/component.h>
+#include <librepcb/library/dev/device.h>
+#include <librepcb/library/pkg/package.h>
+#include <librepcb/library/sym/symbol.h>
+#include <parseagle/library.h>
+
+#include <QtConcurrent/QtConcurrent>
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace eagleimport {
+
+using namespace library;
+
+/*******************************************************************************
+ *  Constructors / Destructor
+ ******************************************************************************/
+
+LibraryConverter::LibraryConverter(ConverterDb& db, const FilePath& outputDir,
+                                   QObject* parent) noexcept
+  : QObject(parent),
+    mDb(db),
+    mOutputDir(outputDir),
+    mThreadPool(),
+    mAbort(false) {
+}
+
+LibraryConverter::~LibraryConverter() noexcept {
+  mAbort.store(true);
+  mThreadPool.waitForDone();
+}
+
+/*******************************************************************************
+ *  Setters
+ ******************************************************************************/
+
+void LibraryConverter::setMaxThreadCount(int count) noexcept {
+  mThreadPool.setMaxThreadCount(qMax(count, 1));
+}
+
+/*******************************************************************************
+ *  General Methods
+ ******************************************************************************/
+
+LibraryConverter::Result LibraryConverter::convert(
+    ElementType type, const QList<FilePath>& files) noexcept {
+  mAbort.store(false);
+  Result   result{0, 0, QStringList()};
+  QThread* thread = QThread::currentThread();
+
+  // Parse all files concurrently. The conversion jobs of a file are queued as
+  // soon as the file is parsed, so parsing and converting overlap.
+  QList<QFuture<ParsedFile>> parsedFiles;
+  foreach (const FilePath& fp, files) {
+    parsedFiles.append(
+        QtConcurrent::run(&mThreadPool, [fp]() { return parseFile(fp); }));
+  }
+  QStringList                             parseErrors;
+  QList<QList<QFuture<ConvertedElement>>> convertedElements;
+  for (int i = 0; i < files.count(); ++i) {
+    ParsedFile parsedFile = parsedFiles[i].result();
+    parseErrors.append(parsedFile.error);
+    convertedElements.append(QList<QFuture<ConvertedElement>>());
+    if (!parsedFile.library) {
+      continue;
+    }
+    // Note: The child database and the parsed library are captured by value,
+    // so they are kept alive until all jobs of this file are finished.
+    std::shared_ptr<ConverterDb> db =
+        std::make_shared<ConverterDb>(mDb, files[i]);
+    std::shared_ptr<parseagle::Library> library = parsedFile.library;
+    for (int k = 0; k < getElementCount(*library, type); ++k) {
+      convertedElements[i].append(QtConcurrent::run(
+          &mThreadPool, [this, type, db, library, k, thread]() {
+            return convertElement(type, *db, *library, k, thread);
+          }));
+    }
+  }
+
+  // Write the converted elements in deterministic order. The output file
+  // systems are opened once and saved at the end, which is much faster than
+  // opening and saving them for every single element.
+  QMap<QString, std::shared_ptr<TransactionalFileSystem>> fileSystems;
+  for (int i = 0; (i < files.count()) && (!mAbort.load()); ++i) {
+    emit fileStarted(i, convertedElements[i].count());
+    if (!parseErrors[i].isEmpty()) {
+      result.errors.append(
+          QString("%1: %2").arg(files[i].getFilename(), parseErrors[i]));
+      continue;
+    }
+    for (int k = 0; (k < convertedElements[i].count()) && (!mAbort.load());
+         ++k) {
+      ConvertedElement converted = convertedElements[i][k].result();
+      try {
+        foreach (const std::shared_ptr<LibraryBaseElement>& element,
+                 converted.elements) {
+          QString dirName = element->getShortElementName();
+          std::shared_ptr<TransactionalFileSystem>& fs = fileSystems[dirName];
+          if (!fs) {
+            fs = TransactionalFileSystem::openRW(
+                mOutputDir.getPathTo(dirName));  // can throw
+          }
+          TransactionalDirectory dir(fs);
+          element->moveIntoParentDirectory(dir);  // can throw
+        }
+      } catch (const Exception& e) {
+        converted.errors.append(e.getMsg());
+        converted.success = false;
+      }
+      foreach (const QString& error, converted.errors) {
+        result.errors.append(
+            QString("%1: %2").arg(files[i].getFilename(), error));
+      }
+      ++result.readElements;
+      if (converted.success) {
+        ++result.convertedElements;
+      }
+      emit elementProcessed(result.readElements, result.convertedElements);
+    }
+  }
+  mThreadPool.waitForDone();  // remaining jobs after an abort
+
+  // Save all output file systems
+  foreach (const std::shared_ptr<TransactionalFileSystem>& fs, fileSystems) {
+    try {
+      fs->save();  // can throw
+    } catch (const Exception& e) {
+      result.errors.append(e.getMsg());
+    }
+  }
+  return result;
+}
+
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+LibraryConverter::ParsedFile LibraryConverter::parseFile(
+    const FilePath& fp) noexcept {
+  ParsedFile parsedFile{nullptr, QString()};
+  if (!fp.isExistingFile()) {
+    parsedFile.error = tr("File not found: %1").arg(fp.toNative());
+    return parsedFile;
+  }
+  try {
+    parsedFile.library = std::make_shared<parseagle::Library>(fp.toStr());
+  } catch (const std::exception& e) {
+    parsedFile.error = e.what();
+  }
+  return parsedFile;
+}
+
+int LibraryConverter::getElementCount(const parseagle::Library& library,
+                                      ElementType type) noexcept {
+  switch (type) {
+    case ElementType::Symbols:
+      return library.getSymbols().count();
+    case ElementType::Packages:
+      return library.getPackages().count();
+    case ElementType::Devices:
+      return library.getDeviceSets().count();
+    default:
+      return 0;
+  }
+}
+
+LibraryConverter::ConvertedElement LibraryConverter::convertElement(
+    ElementType type, ConverterDb& db, const parseagle::Library& library,
+    int index, QThread* thread) const noexcept {
+  ConvertedElement converted{
+      QList<std::shared_ptr<LibraryBaseElement>>(), QStringList(), false};
+  if (mAbort.load()) {
+    return converted;
+  }
+
+  try {
+    switch (type) {
+      case ElementType::Symbols: {
+        SymbolConverter         converter(library.getSymbols().at(index), db);
+        std::shared_ptr<Symbol> symbol = converter.generate();  // can throw
+
+        // convert line rects to polygon rects
+        PolygonSimplifier<Symbol> polygonSimplifier(*symbol);
+        polygonSimplifier.convertLineRectsToPolygonRects(false, true);
+        converted.elements.append(symbol);
+        break;
+      }
+      case ElementType::Packages: {
+        PackageConverter converter(library.getPackages().at(index), db);
+        std::shared_ptr<Package> package = converter.generate();  // can throw
+
+        // convert line rects to polygon rects
+        Q_ASSERT(package->getFootprints().count() == 1);
+        PolygonSimplifier<Footprint> polygonSimplifier(
+            *package->getFootprints().first());
+        polygonSimplifier.convertLineRectsToPolygonRects(false, true);
+        converted.elements.append(package);
+        break;
+      }
+      case ElementType::Devices: {
+        const parseagle::DeviceSet& deviceSet =
+            library.getDeviceSets().at(index);
+
+        // skip device sets whose name ends with "-US" or "-US_"
+        if (deviceSet.getName().endsWith("-US") ||
+            deviceSet.getName().endsWith("-US_")) {
+          return converted;
+        }
+
+        // create component
+        DeviceSetConverter         converter(deviceSet, db);
+        std::shared_ptr<Component> component =
+            converter.generate();  // can throw
+
+        // create devices
+        foreach (const parseagle::Device& device, deviceSet.getDevices()) {
+          if (device.getPackage().isNull()) continue;
+          DeviceConverter devConverter(deviceSet, device, db);
+          converted.elements.append(
+              std::shared_ptr<Device>(devConverter.generate()));  // can throw
+        }
+        converted.elements.append(component);
+        break;
+      }
+      default:
+        throw LogicError(__FILE__, __LINE__);
+    }
+
+    // the elements are written and destroyed by the calling thread
+    foreach (const std::shared_ptr<LibraryBaseElement>& element,
+             converted.elements) {
+      element->moveToThread(thread);
+    }
+    converted.success = true;
+  } catch (const std::exception& e) {
+    converted.elements.clear();
+    converted.errors.append(e.what());
+  }
+  return converted;
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace eagleimport
+}  // namespace librepcb
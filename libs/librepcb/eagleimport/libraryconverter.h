@@ -0,0 +1,164 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_EAGLEIMPORT_LIBRARYCONVERTER_H
+#define LIBREPCB_EAGLEIMPORT_LIBRARYCONVERTER_H
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <librepcb/common/fileio/filepath.h>
+
+#include <QtCore>
+
+#include <atomic>
+#include <memory>
+
+/*******************************************************************************
+ *  Namespace / Forward Declarations
+ ******************************************************************************/
+namespace parseagle {
+class Library;
+}
+
+namespace librepcb {
+
+namespace library {
+class LibraryBaseElement;
+}
+
+namespace eagleimport {
+
+class ConverterDb;
+
+/*******************************************************************************
+ *  Class LibraryConverter
+ ******************************************************************************/
+
+/**
+ * @brief Converts Eagle libraries (*.lbr) to LibrePCB library elements
+ *
+ * This is the headless conversion pipeline used by the Eagle import tool and
+ * the command line interface. All input files are parsed concurrently, and
+ * every symbol, package or device set is converted as a separate job on a
+ * worker pool as soon as its file is parsed. The UUIDs are mapped by a
+ * thread-safe ::librepcb::eagleimport::ConverterDb.
+ *
+ * The converted elements are written to the output directory by the calling
+ * thread in the order of the input files and the elements within them, so
+ * the generated files, the reported errors and the emitted signals are the
+ * same for every run, independent of the number of threads.
+ */
+class LibraryConverter final : public QObject {
+  Q_OBJECT
+
+public:
+  // Types
+  enum class ElementType {
+    Symbols,   ///< Symbols to symbols
+    Packages,  ///< Packages to packages
+    Devices,   ///< Device sets to components and devices
+  };
+  struct Result {
+    int         readElements;       ///< Number of processed input elements
+    int         convertedElements;  ///< Number of successfully converted ones
+    QStringList errors;             ///< All errors in deterministic order
+  };
+
+  // Constructors / Destructor
+  LibraryConverter()                              = delete;
+  LibraryConverter(const LibraryConverter& other) = delete;
+  LibraryConverter(ConverterDb& db, const FilePath& outputDir,
+                   QObject* parent = nullptr) noexcept;
+  ~LibraryConverter() noexcept;
+
+  // Getters
+  int getMaxThreadCount() const noexcept {
+    return mThreadPool.maxThreadCount();
+  }
+
+  // Setters
+  void setMaxThreadCount(int count) noexcept;
+
+  // General Methods
+
+  /**
+   * @brief Convert all elements of the given type of the given files
+   *
+   * Blocks until all elements are converted and written to the output
+   * directory (into the subdirectories "sym", "pkg", "cmp" and "dev"). Can be
+   * called from any thread, the signals are emitted from the calling thread.
+   *
+   * @param type    The type of elements to convert.
+   * @param files   The Eagle library files to convert.
+   *
+   * @return The conversion result (errors are reported in the result instead
+   *         of throwing exceptions).
+   */
+  Result convert(ElementType type, const QList<FilePath>& files) noexcept;
+
+  /**
+   * @brief Abort a running #convert() as soon as possible
+   *
+   * Thread-safe. Elements which are already converted but not yet written
+   * are discarded.
+   */
+  void abort() noexcept { mAbort.store(true); }
+
+  // Operator Overloadings
+  LibraryConverter& operator=(const LibraryConverter& rhs) = delete;
+
+signals:
+  void fileStarted(int index, int elementCount);
+  void elementProcessed(int readElements, int convertedElements);
+
+private:  // Types
+  struct ParsedFile {
+    std::shared_ptr<parseagle::Library> library;  ///< nullptr on error
+    QString                             error;
+  };
+  struct ConvertedElement {
+    QList<std::shared_ptr<library::LibraryBaseElement>> elements;
+    QStringList                                         errors;
+    bool                                                success;
+  };
+
+private:  // Methods
+  static ParsedFile parseFile(const FilePath& fp) noexcept;
+  static int        getElementCount(const parseagle::Library& library,
+                                    ElementType               type) noexcept;
+  ConvertedElement  convertElement(ElementType type, ConverterDb& db,
+                                   const parseagle::Library& library,
+                                   int index, QThread* thread) const noexcept;
+
+private:  // Data
+  ConverterDb&      mDb;
+  FilePath          mOutputDir;
+  QThreadPool       mThreadPool;
+  std::atomic<bool> mAbort;
+};
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace eagleimport
+}  // namespace librepcb
+
+#endif  // LIBREPCB_EAGLEIMPORT_LIBRARYCONVERTER_H
@@ -85,6 +85,12 @@ void CmdComponentEdit::setAttributes(const AttributeList& attributes) noexcept {
  *  Inherited from UndoCommand
  ******************************************************************************/
 
+qint64 CmdComponentEdit::getMemoryUsage() const noexcept {
+  int attributes = mOldAttributes.count() + mNewAttributes.count();
+  return UndoCommand::getMemoryUsage() + sizeof(CmdComponentEdit) -
+         sizeof(UndoCommand) + attributes * sizeof(Attribute);
+}
+
 bool CmdComponentEdit::performExecute() {
   if (CmdLibraryElementEdit::performExecute()) return true;  // can throw
   if (mNewSchematicOnly != mOldSchematicOnly) return true;
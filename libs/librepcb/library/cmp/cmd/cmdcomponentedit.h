@@ -56,6 +56,9 @@ public:
   void setPrefixes(const NormDependentPrefixMap& prefixes) noexcept;
   void setAttributes(const AttributeList& attributes) noexcept;
 
+  // Inherited from UndoCommand
+  virtual qint64 getMemoryUsage() const noexcept override;
+
   // Operator Overloadings
   CmdComponentEdit& operator=(const CmdComponentEdit& rhs) = delete;
 
@@ -82,6 +82,20 @@ void CmdComponentSymbolVariantEdit::setSymbolItems(
  *  Inherited from UndoCommand
  ******************************************************************************/
 
+qint64 CmdComponentSymbolVariantEdit::getMemoryUsage() const noexcept {
+  int items = mOldSymbolItems.count() + mNewSymbolItems.count();
+  int pins  = 0;
+  for (const ComponentSymbolVariantItem& item : mOldSymbolItems) {
+    pins += item.getPinSignalMap().count();
+  }
+  for (const ComponentSymbolVariantItem& item : mNewSymbolItems) {
+    pins += item.getPinSignalMap().count();
+  }
+  return UndoCommand::getMemoryUsage() + sizeof(CmdComponentSymbolVariantEdit) -
+         sizeof(UndoCommand) + items * sizeof(ComponentSymbolVariantItem) +
+         pins * sizeof(ComponentPinSignalMapItem);
+}
+
 bool CmdComponentSymbolVariantEdit::performExecute() {
   performRedo();  // can throw
 
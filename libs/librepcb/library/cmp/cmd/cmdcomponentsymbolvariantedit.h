@@ -58,6 +58,9 @@ public:
   void setDescriptions(const LocalizedDescriptionMap& descriptions) noexcept;
   void setSymbolItems(const ComponentSymbolVariantItemList& items) noexcept;
 
+  // Inherited from UndoCommand
+  qint64 getMemoryUsage() const noexcept override;
+
   // Operator Overloadings
   CmdComponentSymbolVariantEdit& operator       =(
       const CmdComponentSymbolVariantEdit& rhs) = delete;
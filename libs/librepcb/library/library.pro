@@ -10,7 +10,7 @@ TARGET = librepcblibrary
 # Use common project definitions
 include(../../../common.pri)
 
-QT += core widgets xml sql printsupport
+QT += core widgets xml sql printsupport concurrent
 
 CONFIG += staticlib
 
@@ -51,6 +51,7 @@ SOURCES += \
     librarybaseelementcheck.cpp \
     libraryelement.cpp \
     libraryelementcheck.cpp \
+    libraryupgrader.cpp \
     msg/libraryelementcheckmessage.cpp \
     msg/msgmissingauthor.cpp \
     msg/msgmissingcategories.cpp \
@@ -123,6 +124,7 @@ HEADERS += \
     librarybaseelementcheck.h \
     libraryelement.h \
     libraryelementcheck.h \
+    libraryupgrader.h \
     msg/libraryelementcheckmessage.h \
     msg/msgmissingauthor.h \
     msg/msgmissingcategories.h \
@@ -0,0 +1,167 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "libraryupgrader.h"
+
+#include "elements.h"
+
+#include <librepcb/common/exceptions.h>
+#include <librepcb/common/fileio/transactionaldirectory.h>
+#include <librepcb/common/fileio/transactionalfilesystem.h>
+
+#include <QtConcurrent/QtConcurrent>
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace library {
+
+/*******************************************************************************
+ *  Constructors / Destructor
+ ******************************************************************************/
+
+LibraryUpgrader::LibraryUpgrader() noexcept : mElements(ALL), mThreadPool() {
+}
+
+LibraryUpgrader::~LibraryUpgrader() noexcept {
+  mThreadPool.waitForDone();
+}
+
+/*******************************************************************************
+ *  Setters
+ ******************************************************************************/
+
+void LibraryUpgrader::setMaxThreadCount(int count) noexcept {
+  mThreadPool.setMaxThreadCount(qMax(count, 1));
+}
+
+/*******************************************************************************
+ *  General Methods
+ ******************************************************************************/
+
+LibraryUpgrader::Result LibraryUpgrader::upgrade(
+    const QList<FilePath>& libDirs) noexcept {
+  QElapsedTimer timer;
+  timer.start();
+  Result result{QList<FilePath>(), 0, 0, QStringList(), 0};
+
+  // Search the elements of all libraries and start upgrading them. Every job
+  // opens its own file system, so the jobs are independent of each other.
+  QList<Job> jobs;
+  foreach (const FilePath& libDir, libDirs) {
+    try {
+      std::shared_ptr<TransactionalFileSystem> fs =
+          TransactionalFileSystem::openRO(libDir);  // can throw
+      Library lib(std::unique_ptr<TransactionalDirectory>(
+          new TransactionalDirectory(fs)));  // can throw
+      addJobs<ComponentCategory>(lib, libDir, COMPONENT_CATEGORIES, jobs,
+                                 result);
+      addJobs<PackageCategory>(lib, libDir, PACKAGE_CATEGORIES, jobs, result);
+      addJobs<Symbol>(lib, libDir, SYMBOLS, jobs, result);
+      addJobs<Package>(lib, libDir, PACKAGES, jobs, result);
+      addJobs<Component>(lib, libDir, COMPONENTS, jobs, result);
+      addJobs<Device>(lib, libDir, DEVICES, jobs, result);
+    } catch (const Exception& e) {
+      result.errors.append(
+          QString("%1: %2").arg(libDir.toNative(), e.getMsg()));
+      continue;
+    }
+    if (mElements.testFlag(LIBRARY)) {
+      addJob<Library>(libDir, jobs);
+    }
+  }
+
+  // Collect the results in the order the jobs were started
+  foreach (const Job& job, jobs) {
+    JobResult jobResult = job.result.result();
+    if (!jobResult.error.isEmpty()) {
+      result.errors.append(
+          QString("%1: %2").arg(job.dir.toNative(), jobResult.error));
+    } else if (jobResult.upgraded) {
+      result.upgraded.append(job.dir);
+    } else {
+      ++result.unchanged;
+    }
+  }
+
+  result.elapsedMs = timer.elapsed();
+  return result;
+}
+
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+template <typename ElementType>
+void LibraryUpgrader::addJob(const FilePath& dir, QList<Job>& jobs) noexcept {
+  auto job = [dir]() {
+    JobResult result{false, QString()};
+    try {
+      result.upgraded = upgradeElement<ElementType>(dir);  // can throw
+    } catch (const Exception& e) {
+      result.error = e.getMsg();
+    }
+    return result;
+  };
+  jobs.append(Job{dir, QtConcurrent::run(&mThreadPool, job)});
+}
+
+template <typename ElementType>
+void LibraryUpgrader::addJobs(const Library& lib, const FilePath& libDir,
+                              Element element, QList<Job>& jobs,
+                              Result& result) noexcept {
+  if (!mElements.testFlag(element)) {
+    return;
+  }
+  foreach (const QString& path, lib.searchForElements<ElementType>()) {
+    if (path.contains("00000000-0000-4001-8000-000000000000")) {
+      // ignore demo files as they contain documentation which would be removed
+      ++result.ignored;
+      continue;
+    }
+    addJob<ElementType>(libDir.getPathTo(path), jobs);
+  }
+}
+
+template <typename ElementType>
+bool LibraryUpgrader::upgradeElement(const FilePath& dir) {
+  std::shared_ptr<TransactionalFileSystem> fs =
+      TransactionalFileSystem::openRW(dir);  // can throw
+  ElementType element(std::unique_ptr<TransactionalDirectory>(
+      new TransactionalDirectory(fs)));  // can throw
+  element.save();                        // can throw
+  fs->discardUnmodifiedFiles();
+  if (!fs->isModified()) {
+    return false;  // files are already up to date, nothing to write
+  }
+  fs->save();  // can throw
+  return true;
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace library
+}  // namespace librepcb
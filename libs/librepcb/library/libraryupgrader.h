@@ -0,0 +1,150 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_LIBRARY_LIBRARYUPGRADER_H
+#define LIBREPCB_LIBRARY_LIBRARYUPGRADER_H
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <librepcb/common/fileio/filepath.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace / Forward Declarations
+ ******************************************************************************/
+namespace librepcb {
+namespace library {
+
+class Library;
+
+/*******************************************************************************
+ *  Class LibraryUpgrader
+ ******************************************************************************/
+
+/**
+ * @brief Upgrades the file format of whole libraries by re-saving all elements
+ *
+ * Every element is opened in its own file system, so the elements are
+ * processed concurrently on a worker pool. Elements whose serialized output
+ * is byte-identical to the files on disk are not written at all (see
+ * librepcb::TransactionalFileSystem::isModified()), so upgrading an already
+ * upgraded library is cheap.
+ *
+ * The reported paths and errors are in a deterministic order (libraries in
+ * the passed order, elements grouped by type), independent of the
+ * number of threads.
+ */
+class LibraryUpgrader final {
+  Q_DECLARE_TR_FUNCTIONS(LibraryUpgrader)
+
+public:
+  // Types
+  enum Element {
+    LIBRARY              = 1 << 0,  ///< The library itself ("library.lp")
+    COMPONENT_CATEGORIES = 1 << 1,
+    PACKAGE_CATEGORIES   = 1 << 2,
+    SYMBOLS              = 1 << 3,
+    PACKAGES             = 1 << 4,
+    COMPONENTS           = 1 << 5,
+    DEVICES              = 1 << 6,
+    ALL                  = (1 << 7) - 1,
+  };
+  Q_DECLARE_FLAGS(Elements, Element)
+
+  struct Result {
+    QList<FilePath> upgraded;   ///< Directories of the written elements
+    int             unchanged;  ///< Number of already up-to-date elements
+    int             ignored;    ///< Number of skipped (demo) elements
+    QStringList     errors;     ///< Errors of the failed elements
+    qint64          elapsedMs;  ///< Wall time of the whole upgrade
+
+    int getProcessedCount() const noexcept {
+      return upgraded.count() + unchanged + errors.count();
+    }
+  };
+
+  // Constructors / Destructor
+  LibraryUpgrader(const LibraryUpgrader& other) = delete;
+  LibraryUpgrader() noexcept;
+  ~LibraryUpgrader() noexcept;
+
+  // Getters
+  Elements getElements() const noexcept { return mElements; }
+  int      getMaxThreadCount() const noexcept {
+    return mThreadPool.maxThreadCount();
+  }
+
+  // Setters
+  void setElements(Elements elements) noexcept { mElements = elements; }
+  void setMaxThreadCount(int count) noexcept;
+
+  // General Methods
+
+  /**
+   * @brief Upgrade all selected elements of the given libraries
+   *
+   * Blocks until all elements are processed. Errors are reported in the
+   * result instead of throwing exceptions, and don't stop the upgrade of
+   * the other elements.
+   *
+   * @param libDirs   The library directories (*.lplib) to upgrade.
+   *
+   * @return The upgrade result.
+   */
+  Result upgrade(const QList<FilePath>& libDirs) noexcept;
+
+  // Operator Overloadings
+  LibraryUpgrader& operator=(const LibraryUpgrader& rhs) = delete;
+
+private:  // Types
+  struct JobResult {
+    bool    upgraded;  ///< Whether the element was written
+    QString error;     ///< Empty on success
+  };
+  struct Job {
+    FilePath           dir;
+    QFuture<JobResult> result;
+  };
+
+private:  // Methods
+  template <typename ElementType>
+  void addJob(const FilePath& dir, QList<Job>& jobs) noexcept;
+  template <typename ElementType>
+  void addJobs(const Library& lib, const FilePath& libDir, Element element,
+               QList<Job>& jobs, Result& result) noexcept;
+  template <typename ElementType>
+  static bool upgradeElement(const FilePath& dir);
+
+private:  // Data
+  Elements    mElements;
+  QThreadPool mThreadPool;
+};
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace library
+}  // namespace librepcb
+
+Q_DECLARE_OPERATORS_FOR_FLAGS(librepcb::library::LibraryUpgrader::Elements)
+
+#endif  // LIBREPCB_LIBRARY_LIBRARYUPGRADER_H
@@ -56,8 +56,10 @@ public:
   LibraryElementCheckMessage() = delete;
 
   // Getters
-  Severity       getSeverity() const noexcept { return mSeverity; }
-  const QPixmap& getSeverityPixmap() const noexcept { return mSeverityPixmap; }
+  Severity getSeverity() const noexcept { return mSeverity; }
+  QPixmap  getSeverityPixmap() const noexcept {
+    return getSeverityPixmap(mSeverity);
+  }
   const QString& getMessage() const noexcept { return mMessage; }
   const QString& getDescription() const noexcept { return mDescription; }
 
@@ -72,6 +74,18 @@ public:
   }
 
   // Static Methods
+
+  /**
+   * @brief Get the icon of a severity
+   *
+   * @warning Pixmaps must only be used in the GUI thread, thus this method
+   *          must not be called in other threads (messages are created in
+   *          worker threads, so they don't hold a pixmap).
+   *
+   * @param severity  The severity.
+   *
+   * @return The icon.
+   */
   static QPixmap getSeverityPixmap(Severity severity) noexcept;
 
   // Operator Overloads
@@ -87,7 +101,6 @@ protected:  // Methods
 
 protected:  // Data
   Severity mSeverity;
-  QPixmap  mSeverityPixmap;
   QString  mMessage;
   QString  mDescription;
 };
@@ -149,6 +149,28 @@ void CmdFootprintPadEdit::rotate(const Angle& angle, const Point& center,
  *  Inherited from UndoCommand
  ******************************************************************************/
 
+bool CmdFootprintPadEdit::canMergeWith(const UndoCommand& other) const
+    noexcept {
+  const CmdFootprintPadEdit* cmd =
+      dynamic_cast<const CmdFootprintPadEdit*>(&other);
+  return cmd && (&cmd->mPad == &mPad) && isCurrentlyExecuted() &&
+         cmd->isCurrentlyExecuted();
+}
+
+void CmdFootprintPadEdit::mergeWith(const UndoCommand& other) noexcept {
+  Q_ASSERT(canMergeWith(other));
+  const CmdFootprintPadEdit& cmd =
+      dynamic_cast<const CmdFootprintPadEdit&>(other);
+  mNewPackagePadUuid = cmd.mNewPackagePadUuid;
+  mNewBoardSide      = cmd.mNewBoardSide;
+  mNewShape          = cmd.mNewShape;
+  mNewWidth          = cmd.mNewWidth;
+  mNewHeight         = cmd.mNewHeight;
+  mNewPos            = cmd.mNewPos;
+  mNewRotation       = cmd.mNewRotation;
+  mNewDrillDiameter  = cmd.mNewDrillDiameter;
+}
+
 bool CmdFootprintPadEdit::performExecute() {
   performRedo();  // can throw
 
@@ -62,6 +62,10 @@ public:
   void setRotation(const Angle& angle, bool immediate) noexcept;
   void rotate(const Angle& angle, const Point& center, bool immediate) noexcept;
 
+  // Inherited from UndoCommand
+  bool canMergeWith(const UndoCommand& other) const noexcept override;
+  void mergeWith(const UndoCommand& other) noexcept override;
+
   // Operator Overloadings
   CmdFootprintPadEdit& operator=(const CmdFootprintPadEdit& rhs) = delete;
 
@@ -128,8 +128,11 @@ void PackageCheck::checkPadsOverlapWithPlacement(MsgList& msgs) const {
        itFtp != mPackage.getFootprints().end(); ++itFtp) {
     std::shared_ptr<const Footprint> footprint = itFtp.ptr();
 
-    QPainterPath topPlacement;
-    QPainterPath botPlacement;
+    // Keep the placement areas separate with their bounding rects, so the
+    // expensive exact intersection test is only done for areas which are
+    // close to a pad.
+    QVector<QPair<QRectF, QPainterPath>> topPlacement;
+    QVector<QPair<QRectF, QPainterPath>> botPlacement;
     for (const Polygon& polygon : footprint->getPolygons()) {
       QPen pen(Qt::NoPen);
       if (polygon.getLineWidth() > 0) {
@@ -143,9 +146,9 @@ void PackageCheck::checkPadsOverlapWithPlacement(MsgList& msgs) const {
       QPainterPath area = Toolbox::shapeFromPath(
           polygon.getPath().toQPainterPathPx(), pen, brush);
       if (polygon.getLayerName() == GraphicsLayer::sTopPlacement) {
-        topPlacement.addPath(area);
+        topPlacement.append(qMakePair(area.boundingRect(), area));
       } else if (polygon.getLayerName() == GraphicsLayer::sBotPlacement) {
-        botPlacement.addPath(area);
+        botPlacement.append(qMakePair(area.boundingRect(), area));
       }
     }
 
@@ -160,12 +163,12 @@ void PackageCheck::checkPadsOverlapWithPlacement(MsgList& msgs) const {
       stopMaskPath.rotate(pad->getRotation()).translate(pad->getPosition());
       QPainterPath stopMask = stopMaskPath.toQPainterPathPx();
       if (pad->isOnLayer(GraphicsLayer::sTopCopper) &&
-          stopMask.intersects(topPlacement)) {
+          intersects(stopMask, topPlacement)) {
         msgs.append(std::make_shared<MsgPadOverlapsWithPlacement>(
             footprint, pad, pkgPad ? *pkgPad->getName() : QString(),
             clearance));
       } else if (pad->isOnLayer(GraphicsLayer::sBotCopper) &&
-                 stopMask.intersects(botPlacement)) {
+                 intersects(stopMask, botPlacement)) {
         msgs.append(std::make_shared<MsgPadOverlapsWithPlacement>(
             footprint, pad, pkgPad ? *pkgPad->getName() : QString(),
             clearance));
@@ -174,6 +177,22 @@ void PackageCheck::checkPadsOverlapWithPlacement(MsgList& msgs) const {
   }
 }
 
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+bool PackageCheck::intersects(
+    const QPainterPath&                         path,
+    const QVector<QPair<QRectF, QPainterPath>>& areas) noexcept {
+  QRectF rect = path.boundingRect();
+  for (const auto& area : areas) {
+    if (rect.intersects(area.first) && path.intersects(area.second)) {
+      return true;
+    }
+  }
+  return false;
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
@@ -110,6 +110,21 @@ void CmdSymbolPinEdit::rotate(const Angle& angle, const Point& center,
  *  Inherited from UndoCommand
  ******************************************************************************/
 
+bool CmdSymbolPinEdit::canMergeWith(const UndoCommand& other) const noexcept {
+  const CmdSymbolPinEdit* cmd = dynamic_cast<const CmdSymbolPinEdit*>(&other);
+  return cmd && (&cmd->mPin == &mPin) && isCurrentlyExecuted() &&
+         cmd->isCurrentlyExecuted();
+}
+
+void CmdSymbolPinEdit::mergeWith(const UndoCommand& other) noexcept {
+  Q_ASSERT(canMergeWith(other));
+  const CmdSymbolPinEdit& cmd = dynamic_cast<const CmdSymbolPinEdit&>(other);
+  mNewName     = cmd.mNewName;
+  mNewLength   = cmd.mNewLength;
+  mNewPos      = cmd.mNewPos;
+  mNewRotation = cmd.mNewRotation;
+}
+
 bool CmdSymbolPinEdit::performExecute() {
   performRedo();  // can throw
 
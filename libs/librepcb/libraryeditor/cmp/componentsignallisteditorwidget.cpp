@@ -49,6 +49,7 @@ ComponentSignalListEditorWidget::ComponentSignalListEditorWidget(
     mSignalList(nullptr),
     mSignalListEditedSlot(*this,
                           &ComponentSignalListEditorWidget::signalListEdited) {
+  mSignalListEditedSlot.setCoalescing(true);
   mTable->setCornerButtonEnabled(false);
   mTable->setSelectionBehavior(QAbstractItemView::SelectRows);
   mTable->setSelectionMode(QAbstractItemView::SingleSelection);
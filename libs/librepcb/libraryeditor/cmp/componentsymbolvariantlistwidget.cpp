@@ -48,6 +48,7 @@ ComponentSymbolVariantListWidget::ComponentSymbolVariantListWidget(
     mEditorProvider(nullptr),
     mVariantListEditedSlot(
         *this, &ComponentSymbolVariantListWidget::variantListEdited) {
+  mVariantListEditedSlot.setCoalescing(true);
   mTable->setCornerButtonEnabled(false);
   mTable->setSelectionBehavior(QAbstractItemView::SelectRows);
   mTable->setSelectionMode(QAbstractItemView::SingleSelection);
@@ -26,9 +26,11 @@
 #include <librepcb/common/utils/exclusiveactiongroup.h>
 #include <librepcb/common/utils/toolbarproxy.h>
 #include <librepcb/common/utils/undostackactiongroup.h>
+#include <librepcb/library/librarybaseelement.h>
 #include <librepcb/workspace/settings/workspacesettings.h>
 #include <librepcb/workspace/workspace.h>
 
+#include <QtConcurrent/QtConcurrent>
 #include <QtCore>
 #include <QtWidgets>
 
@@ -53,7 +55,8 @@ EditorWidgetBase::EditorWidgetBase(const Context& context, const FilePath& fp,
         TransactionalFileSystem::RestoreMode::ASK)),  // can throw
     mUndoStackActionGroup(nullptr),
     mToolsActionGroup(nullptr),
-    mIsInterfaceBroken(false) {
+    mIsInterfaceBroken(false),
+    mChecksOutdated(false) {
   mUndoStack.reset(new UndoStack());
   connect(mUndoStack.data(), &UndoStack::cleanChanged, this,
           &EditorWidgetBase::undoStackCleanChanged);
@@ -62,11 +65,15 @@ EditorWidgetBase::EditorWidgetBase(const Context& context, const FilePath& fp,
 
   mCommandToolBarProxy.reset(new ToolBarProxy());
 
+  connect(&mChecksWatcher, &QFutureWatcher<CheckResult>::finished, this,
+          &EditorWidgetBase::libraryElementChecksFinished);
+
   // Run checks, but delay it because the subclass is not loaded yet!
   scheduleLibraryElementChecks();
 }
 
 EditorWidgetBase::~EditorWidgetBase() noexcept {
+  mChecksWatcher.waitForFinished();
 }
 
 /*******************************************************************************
@@ -221,16 +228,33 @@ void EditorWidgetBase::scheduleLibraryElementChecks() noexcept {
 }
 
 void EditorWidgetBase::updateCheckMessages() noexcept {
+  if (mChecksWatcher.isRunning()) {
+    // The element was modified while the checks are running on an older
+    // snapshot. Discard their result and run the checks again when they are
+    // finished.
+    mChecksOutdated = true;
+    return;
+  }
+
   try {
+    std::shared_ptr<const LibraryBaseElement> snapshot =
+        createCheckSnapshot();  // can throw
+    if (snapshot) {
+      mChecksOutdated = false;
+      mChecksWatcher.setFuture(QtConcurrent::run([snapshot]() {
+        try {
+          return std::make_shared<LibraryElementCheckMessageList>(
+              snapshot->runChecks());  // can throw
+        } catch (const Exception& e) {
+          qCritical() << "Failed to run checks:" << e.getMsg();
+          return CheckResult();
+        }
+      }));
+      return;
+    }
     LibraryElementCheckMessageList msgs;
     if (runChecks(msgs)) {  // can throw
-      int errors = 0;
-      foreach (const auto& msg, msgs) {
-        if (msg->getSeverity() == LibraryElementCheckMessage::Severity::Error) {
-          ++errors;
-        }
-      }
-      emit errorsAvailableChanged(errors > 0);
+      updateErrorsAvailable(msgs);
     } else {
       // Failed to run checks (for example because a command is active), try it
       // later again.
@@ -241,6 +265,29 @@ void EditorWidgetBase::updateCheckMessages() noexcept {
   }
 }
 
+void EditorWidgetBase::libraryElementChecksFinished() noexcept {
+  if (mChecksOutdated) {
+    scheduleLibraryElementChecks();
+    return;
+  }
+  CheckResult msgs = mChecksWatcher.result();
+  if (msgs) {
+    setCheckMessages(*msgs);
+    updateErrorsAvailable(*msgs);
+  }
+}
+
+void EditorWidgetBase::updateErrorsAvailable(
+    const LibraryElementCheckMessageList& msgs) noexcept {
+  int errors = 0;
+  foreach (const auto& msg, msgs) {
+    if (msg->getSeverity() == LibraryElementCheckMessage::Severity::Error) {
+      ++errors;
+    }
+  }
+  emit errorsAvailableChanged(errors > 0);
+}
+
 bool EditorWidgetBase::libraryElementCheckFixAvailable(
     std::shared_ptr<const LibraryElementCheckMessage> msg) noexcept {
   try {
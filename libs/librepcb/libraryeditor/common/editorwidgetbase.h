@@ -92,6 +92,9 @@ public:
     ADD_HOLES,
   };
 
+  /// Messages of checks which ran in a worker thread (`nullptr` on failure)
+  typedef std::shared_ptr<LibraryElementCheckMessageList> CheckResult;
+
   // Constructors / Destructor
   EditorWidgetBase()                              = delete;
   EditorWidgetBase(const EditorWidgetBase& other) = delete;
@@ -134,7 +137,25 @@ protected:  // Methods
     Q_UNUSED(newTool);
     return false;
   }
-  virtual bool       runChecks(LibraryElementCheckMessageList& msgs) const = 0;
+  virtual bool runChecks(LibraryElementCheckMessageList& msgs) const = 0;
+
+  /**
+   * @brief Create a copy of the edited element to run the checks on
+   *
+   * If a subclass returns a snapshot, the checks are run on it in a worker
+   * thread and the result is passed to #setCheckMessages() afterwards. The
+   * snapshot must not share any data with the edited element since it is
+   * accessed from the worker thread. If `nullptr` is returned (the default),
+   * the checks are run synchronously with #runChecks() instead.
+   */
+  virtual std::shared_ptr<const LibraryBaseElement> createCheckSnapshot()
+      const {
+    return nullptr;
+  }
+  virtual void setCheckMessages(
+      const LibraryElementCheckMessageList& msgs) noexcept {
+    Q_UNUSED(msgs);
+  }
   void               undoStackStateModified() noexcept;
   const QStringList& getLibLocaleOrder() const noexcept;
   QString            getWorkspaceSettingsUserName() noexcept;
@@ -146,6 +167,9 @@ private:  // Methods
   void         toolActionGroupChangeTriggered(const QVariant& newTool) noexcept;
   void         undoStackCleanChanged(bool clean) noexcept;
   void         scheduleLibraryElementChecks() noexcept;
+  void         libraryElementChecksFinished() noexcept;
+  void         updateErrorsAvailable(
+      const LibraryElementCheckMessageList& msgs) noexcept;
   virtual bool processCheckMessage(
       std::shared_ptr<const LibraryElementCheckMessage> msg, bool applyFix) = 0;
   bool libraryElementCheckFixAvailable(
@@ -171,6 +195,10 @@ protected:  // Data
   ExclusiveActionGroup*                    mToolsActionGroup;
   QScopedPointer<ToolBarProxy>             mCommandToolBarProxy;
   bool                                     mIsInterfaceBroken;
+
+private:  // Data
+  QFutureWatcher<CheckResult> mChecksWatcher;
+  bool                        mChecksOutdated;  ///< Element modified meanwhile
 };
 
 /*******************************************************************************
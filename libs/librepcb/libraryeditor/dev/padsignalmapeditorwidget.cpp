@@ -46,6 +46,7 @@ PadSignalMapEditorWidget::PadSignalMapEditorWidget(QWidget* parent) noexcept
     mUndoStack(nullptr),
     mPadSignalMap(nullptr),
     mMapEditedSlot(*this, &PadSignalMapEditorWidget::mapEdited) {
+  mMapEditedSlot.setCoalescing(true);
   mTable->setCornerButtonEnabled(false);
   mTable->setSelectionBehavior(QAbstractItemView::SelectRows);
   mTable->setSelectionMode(QAbstractItemView::SingleSelection);
@@ -46,6 +46,7 @@ FootprintListEditorWidget::FootprintListEditorWidget(QWidget* parent) noexcept
     mUndoStack(nullptr),
     mFootprintListEditedSlot(*this,
                              &FootprintListEditorWidget::footprintListEdited) {
+  mFootprintListEditedSlot.setCoalescing(true);
   mTable->setCornerButtonEnabled(false);
   mTable->setSelectionBehavior(QAbstractItemView::SelectRows);
   mTable->setSelectionMode(QAbstractItemView::SingleSelection);
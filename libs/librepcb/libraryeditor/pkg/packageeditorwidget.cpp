@@ -411,6 +411,33 @@ bool PackageEditorWidget::runChecks(
   return true;
 }
 
+std::shared_ptr<const LibraryBaseElement>
+    PackageEditorWidget::createCheckSnapshot() const {
+  if ((mFsm->getCurrentTool() != NONE) && (mFsm->getCurrentTool() != SELECT)) {
+    return nullptr;  // runChecks() will postpone the checks
+  }
+  // The package checks are expensive, so run them on a deep copy of the
+  // package in a worker thread to keep the editor responsive.
+  std::shared_ptr<Package> snapshot = std::make_shared<Package>(
+      mPackage->getUuid(), mPackage->getVersion(), mPackage->getAuthor(),
+      mPackage->getNames().getDefaultValue(),
+      mPackage->getDescriptions().getDefaultValue(),
+      mPackage->getKeywords().getDefaultValue());  // can throw
+  snapshot->setNames(mPackage->getNames());
+  snapshot->setDescriptions(mPackage->getDescriptions());
+  snapshot->setKeywords(mPackage->getKeywords());
+  snapshot->setDeprecated(mPackage->isDeprecated());
+  snapshot->setCategories(mPackage->getCategories());
+  snapshot->getPads()       = mPackage->getPads();
+  snapshot->getFootprints() = mPackage->getFootprints();
+  return snapshot;
+}
+
+void PackageEditorWidget::setCheckMessages(
+    const LibraryElementCheckMessageList& msgs) noexcept {
+  mUi->lstMessages->setMessages(msgs);
+}
+
 template <>
 void PackageEditorWidget::fixMsg(const MsgNameNotTitleCase& msg) {
   mUi->edtName->setText(*msg.getFixedName());
@@ -450,10 +477,12 @@ void PackageEditorWidget::fixMsg(const MsgMissingFootprintValue& msg) {
 
 template <>
 void PackageEditorWidget::fixMsg(const MsgWrongFootprintTextLayer& msg) {
+  // the message may refer to a snapshot of the package, so look up the
+  // objects by UUID
   std::shared_ptr<Footprint> footprint =
-      mPackage->getFootprints().get(msg.getFootprint().get());
+      mPackage->getFootprints().get(msg.getFootprint()->getUuid());
   std::shared_ptr<StrokeText> text =
-      footprint->getStrokeTexts().get(msg.getText().get());
+      footprint->getStrokeTexts().get(msg.getText()->getUuid());
   QScopedPointer<CmdStrokeTextEdit> cmd(new CmdStrokeTextEdit(*text));
   cmd->setLayerName(GraphicsLayerName(msg.getExpectedLayerName()), false);
   mUndoStack->execCmd(cmd.take());
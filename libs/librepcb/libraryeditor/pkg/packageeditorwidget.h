@@ -108,6 +108,10 @@ private:  // Methods
   void memorizePackageInterface() noexcept;
   bool isInterfaceBroken() const noexcept override;
   bool runChecks(LibraryElementCheckMessageList& msgs) const override;
+  std::shared_ptr<const LibraryBaseElement> createCheckSnapshot()
+      const override;
+  void setCheckMessages(
+      const LibraryElementCheckMessageList& msgs) noexcept override;
   template <typename MessageType>
   void fixMsg(const MessageType& msg);
   template <typename MessageType>
@@ -45,6 +45,7 @@ PackagePadListEditorWidget::PackagePadListEditorWidget(QWidget* parent) noexcept
     mPadList(nullptr),
     mUndoStack(nullptr),
     mPadListEditedSlot(*this, &PackagePadListEditorWidget::padListEdited) {
+  mPadListEditedSlot.setCoalescing(true);
   mTable->setCornerButtonEnabled(false);
   mTable->setSelectionBehavior(QAbstractItemView::SelectRows);
   mTable->setSelectionMode(QAbstractItemView::SingleSelection);
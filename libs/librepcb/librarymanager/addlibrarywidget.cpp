@@ -23,6 +23,7 @@
 #include "addlibrarywidget.h"
 
 #include "librarydownload.h"
+#include "librarydownloadscheduler.h"
 #include "repositorylibrarylistwidgetitem.h"
 #include "ui_addlibrarywidget.h"
 
@@ -31,6 +32,7 @@
 #include <librepcb/common/fileio/transactionalfilesystem.h>
 #include <librepcb/common/network/repository.h>
 #include <librepcb/library/library.h>
+#include <librepcb/workspace/library/workspacelibrarydb.h>
 #include <librepcb/workspace/settings/workspacesettings.h>
 #include <librepcb/workspace/workspace.h>
 
@@ -49,7 +51,10 @@ namespace manager {
  ******************************************************************************/
 
 AddLibraryWidget::AddLibraryWidget(workspace::Workspace& ws) noexcept
-  : QWidget(nullptr), mWorkspace(ws), mUi(new Ui::AddLibraryWidget) {
+  : QWidget(nullptr),
+    mWorkspace(ws),
+    mUi(new Ui::AddLibraryWidget),
+    mRepoLibraryDownloadScheduler(new LibraryDownloadScheduler()) {
   mUi->setupUi(this);
   connect(mUi->btnDownloadZip, &QPushButton::clicked, this,
           &AddLibraryWidget::downloadZippedLibraryButtonClicked);
@@ -62,6 +67,12 @@ AddLibraryWidget::AddLibraryWidget(workspace::Workspace& ws) noexcept
   connect(mUi->btnRepoLibsDownload, &QPushButton::clicked, this,
           &AddLibraryWidget::downloadLibrariesFromRepositoryButtonClicked);
 
+  // index all libraries downloaded from repositories at once, when the last
+  // download has finished
+  connect(mRepoLibraryDownloadScheduler.data(),
+          &LibraryDownloadScheduler::batchFinished, this,
+          [this]() { mWorkspace.getLibraryDb().startLibraryRescan(); });
+
   // tab "create local library": set placeholder texts
   mUi->edtLocalName->setPlaceholderText("My Library");
   mUi->edtLocalAuthor->setPlaceholderText(
@@ -444,7 +455,7 @@ void AddLibraryWidget::downloadLibrariesFromRepositoryButtonClicked() noexcept {
     auto* widget = dynamic_cast<RepositoryLibraryListWidgetItem*>(
         mUi->lstRepoLibs->itemWidget(item));
     if (widget) {
-      widget->startDownloadIfSelected();
+      widget->startDownloadIfSelected(*mRepoLibraryDownloadScheduler);
     } else {
       qWarning() << "Invalid item widget detected.";
     }
@@ -42,6 +42,7 @@ namespace library {
 namespace manager {
 
 class LibraryDownload;
+class LibraryDownloadScheduler;
 
 namespace Ui {
 class AddLibraryWidget;
@@ -92,10 +93,11 @@ private:  // Methods
                                                    bool isFilename) noexcept;
 
 private:  // Data
-  workspace::Workspace&                mWorkspace;
-  QScopedPointer<Ui::AddLibraryWidget> mUi;
-  QScopedPointer<LibraryDownload>      mManualLibraryDownload;
-  QList<QMetaObject::Connection>       mLibraryDownloadConnections;
+  workspace::Workspace&                    mWorkspace;
+  QScopedPointer<Ui::AddLibraryWidget>     mUi;
+  QScopedPointer<LibraryDownload>          mManualLibraryDownload;
+  QScopedPointer<LibraryDownloadScheduler> mRepoLibraryDownloadScheduler;
+  QList<QMetaObject::Connection>           mLibraryDownloadConnections;
 };
 
 /*******************************************************************************
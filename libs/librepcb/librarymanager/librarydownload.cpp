@@ -43,7 +43,8 @@ LibraryDownload::LibraryDownload(const QUrl&     urlToZip,
                                  const FilePath& destDir) noexcept
   : QObject(nullptr),
     mDestDir(destDir),
-    mTempDestDir(destDir.toStr() % ".tmp") {
+    mTempDestDir(destDir.toStr() % ".tmp"),
+    mExpectedZipFileSize(-1) {
   mFileDownload.reset(
       new FileDownload(urlToZip, FilePath(mDestDir.toStr() % ".zip")));
   mFileDownload->setZipExtractionDirectory(mTempDestDir);
@@ -72,6 +73,7 @@ LibraryDownload::~LibraryDownload() noexcept {
 void LibraryDownload::setExpectedZipFileSize(qint64 bytes) noexcept {
   if (mFileDownload) {
     mFileDownload->setExpectedReplyContentSize(bytes);
+    mExpectedZipFileSize = bytes;
   } else {
     qCritical() << "Calling this method after start() is not allowed!";
   }
@@ -87,6 +89,14 @@ void LibraryDownload::setExpectedChecksum(
   }
 }
 
+void LibraryDownload::setMaxRetries(int retries) noexcept {
+  if (mFileDownload) {
+    mFileDownload->setMaxRetries(retries);
+  } else {
+    qCritical() << "Calling this method after start() is not allowed!";
+  }
+}
+
 /*******************************************************************************
  *  Public Slots
  ******************************************************************************/
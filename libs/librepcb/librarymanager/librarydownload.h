@@ -59,6 +59,9 @@ public:
 
   // Getters
   const FilePath& getDestinationDir() const noexcept { return mDestDir; }
+  qint64          getExpectedZipFileSize() const noexcept {
+    return mExpectedZipFileSize;
+  }
 
   // Setters
 
@@ -73,6 +76,11 @@ public:
   void setExpectedChecksum(QCryptographicHash::Algorithm algorithm,
                            const QByteArray&             checksum) noexcept;
 
+  /**
+   * @copydoc librepcb::NetworkRequestBase::setMaxRetries()
+   */
+  void setMaxRetries(int retries) noexcept;
+
   // Operator Overloadings
   LibraryDownload& operator=(const LibraryDownload& rhs) = delete;
 
@@ -105,6 +113,7 @@ private:  // Data
   QScopedPointer<FileDownload> mFileDownload;
   FilePath                     mDestDir;
   FilePath                     mTempDestDir;
+  qint64                       mExpectedZipFileSize;  ///< -1 if unknown
 };
 
 /*******************************************************************************
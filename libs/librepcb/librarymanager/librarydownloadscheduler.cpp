@@ -0,0 +1,156 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "librarydownloadscheduler.h"
+
+#include "librarydownload.h"
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace library {
+namespace manager {
+
+/*******************************************************************************
+ *  Constructors / Destructor
+ ******************************************************************************/
+
+LibraryDownloadScheduler::LibraryDownloadScheduler(QObject* parent) noexcept
+  : QObject(parent),
+    mMaxParallel(sDefaultMaxParallelDownloads),
+    mMaxRetries(sDefaultMaxRetries),
+    mQueue(),
+    mRunning(),
+    mSucceededCount(0),
+    mFailedCount(0) {
+}
+
+LibraryDownloadScheduler::~LibraryDownloadScheduler() noexcept {
+}
+
+/*******************************************************************************
+ *  Setters
+ ******************************************************************************/
+
+void LibraryDownloadScheduler::setMaxParallelDownloads(int count) noexcept {
+  mMaxParallel = qMax(count, 1);
+  startNextDownloads();
+}
+
+void LibraryDownloadScheduler::setMaxRetries(int retries) noexcept {
+  mMaxRetries = qMax(retries, 0);
+}
+
+/*******************************************************************************
+ *  General Methods
+ ******************************************************************************/
+
+void LibraryDownloadScheduler::enqueue(LibraryDownload& download) noexcept {
+  Q_ASSERT((!mQueue.contains(&download)) && (!mRunning.contains(&download)));
+
+  // insert sorted by size, unknown sizes first since they might be large
+  auto isLarger = [](const LibraryDownload* a, const LibraryDownload* b) {
+    qint64 sizeA = a->getExpectedZipFileSize();
+    qint64 sizeB = b->getExpectedZipFileSize();
+    if ((sizeA < 0) || (sizeB < 0)) {
+      return (sizeA < 0) && (sizeB >= 0);
+    }
+    return sizeA > sizeB;
+  };
+  mQueue.insert(std::upper_bound(mQueue.begin(), mQueue.end(), &download,
+                                 isLarger),
+                &download);
+
+  LibraryDownload* ptr = &download;
+  connect(ptr, &LibraryDownload::finished, this,
+          [this, ptr](bool success) { downloadFinished(ptr, success); });
+  connect(ptr, &LibraryDownload::destroyed, this,
+          &LibraryDownloadScheduler::downloadDestroyed);
+
+  // Start downloads from the event loop, thus all downloads enqueued in a row
+  // are sorted before the first one is started.
+  QTimer::singleShot(0, this, &LibraryDownloadScheduler::startNextDownloads);
+}
+
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+void LibraryDownloadScheduler::startNextDownloads() noexcept {
+  while ((mRunning.count() < mMaxParallel) && (!mQueue.isEmpty())) {
+    LibraryDownload* download = mQueue.takeFirst();
+    mRunning.insert(download);
+    download->setMaxRetries(mMaxRetries);
+    download->start();  // might emit finished() immediately
+  }
+}
+
+void LibraryDownloadScheduler::downloadFinished(LibraryDownload* download,
+                                                bool success) noexcept {
+  if (!mRunning.remove(download)) {
+    return;  // not started by this scheduler
+  }
+  disconnect(download, nullptr, this, nullptr);
+  if (success) {
+    ++mSucceededCount;
+  } else {
+    ++mFailedCount;
+  }
+  startNextDownloads();
+  checkIfBatchFinished();
+}
+
+void LibraryDownloadScheduler::downloadDestroyed(QObject* obj) noexcept {
+  // Note: The object is already partially destroyed, so it must not be
+  // accessed anymore, only the pointer value is used.
+  LibraryDownload* download = static_cast<LibraryDownload*>(obj);
+  if (mQueue.removeAll(download) || mRunning.remove(download)) {
+    ++mFailedCount;
+    startNextDownloads();
+    checkIfBatchFinished();
+  }
+}
+
+void LibraryDownloadScheduler::checkIfBatchFinished() noexcept {
+  // Note: This may be called recursively if a download finishes immediately
+  // on start, thus reset the counters to emit the signal only once.
+  if (isIdle() && (mSucceededCount + mFailedCount > 0)) {
+    int succeeded   = mSucceededCount;
+    int failed      = mFailedCount;
+    mSucceededCount = 0;
+    mFailedCount    = 0;
+    qDebug() << "Library downloads finished:" << succeeded << "succeeded,"
+             << failed << "failed.";
+    emit batchFinished(succeeded, failed);
+  }
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace manager
+}  // namespace library
+}  // namespace librepcb
@@ -0,0 +1,130 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_WORKSPACE_LIBRARYDOWNLOADSCHEDULER_H
+#define LIBREPCB_WORKSPACE_LIBRARYDOWNLOADSCHEDULER_H
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace / Forward Declarations
+ ******************************************************************************/
+namespace librepcb {
+namespace library {
+namespace manager {
+
+class LibraryDownload;
+
+/*******************************************************************************
+ *  Class LibraryDownloadScheduler
+ ******************************************************************************/
+
+/**
+ * @brief Runs a batch of library downloads with limited parallelism
+ *
+ * Downloads added with #enqueue() are not started immediately, but queued and
+ * started as soon as less than #getMaxParallelDownloads() downloads are
+ * running. The queue is ordered by the expected ZIP file size, largest (or
+ * unknown) first, so the long running downloads overlap with the short ones
+ * and the whole batch finishes as early as possible.
+ *
+ * Every download is retried on transient network errors (see
+ * librepcb::NetworkRequestBase::setMaxRetries()). Once all queued downloads
+ * are finished, #batchFinished() is emitted, which allows to rescan the
+ * library only once for the whole batch.
+ *
+ * @note The scheduler does not take ownership of the downloads. Downloads
+ *       which are destroyed while queued or running are treated as failed.
+ */
+class LibraryDownloadScheduler final : public QObject {
+  Q_OBJECT
+
+public:
+  // Constructors / Destructor
+  LibraryDownloadScheduler(const LibraryDownloadScheduler& other) = delete;
+  explicit LibraryDownloadScheduler(QObject* parent = nullptr) noexcept;
+  ~LibraryDownloadScheduler() noexcept;
+
+  // Getters
+  int  getMaxParallelDownloads() const noexcept { return mMaxParallel; }
+  int  getMaxRetries() const noexcept { return mMaxRetries; }
+  int  getQueuedCount() const noexcept { return mQueue.count(); }
+  int  getRunningCount() const noexcept { return mRunning.count(); }
+  bool isIdle() const noexcept {
+    return mQueue.isEmpty() && mRunning.isEmpty();
+  }
+
+  // Setters
+  void setMaxParallelDownloads(int count) noexcept;
+  void setMaxRetries(int retries) noexcept;
+
+  // General Methods
+
+  /**
+   * @brief Add a download to the queue
+   *
+   * @param download  The download to start (must not be started yet and must
+   *                  not be enqueued multiple times)
+   */
+  void enqueue(LibraryDownload& download) noexcept;
+
+  // Operator Overloadings
+  LibraryDownloadScheduler& operator=(const LibraryDownloadScheduler& rhs) =
+      delete;
+
+  // Static Variables
+  static constexpr int sDefaultMaxParallelDownloads = 4;
+  static constexpr int sDefaultMaxRetries           = 3;
+
+signals:
+  /**
+   * @brief All enqueued downloads are finished
+   *
+   * @param succeeded   Count of successfully finished downloads
+   * @param failed      Count of failed or aborted downloads
+   */
+  void batchFinished(int succeeded, int failed);
+
+private:  // Methods
+  void startNextDownloads() noexcept;
+  void downloadFinished(LibraryDownload* download, bool success) noexcept;
+  void downloadDestroyed(QObject* obj) noexcept;
+  void checkIfBatchFinished() noexcept;
+
+private:  // Data
+  int                     mMaxParallel;
+  int                     mMaxRetries;
+  QList<LibraryDownload*> mQueue;    ///< Sorted by expected size, descending
+  QSet<LibraryDownload*>  mRunning;  ///< Started, but not finished yet
+  int                     mSucceededCount;
+  int                     mFailedCount;
+};
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace manager
+}  // namespace library
+}  // namespace librepcb
+
+#endif  // LIBREPCB_WORKSPACE_LIBRARYDOWNLOADSCHEDULER_H
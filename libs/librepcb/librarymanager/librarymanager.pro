@@ -22,6 +22,7 @@ INCLUDEPATH += \
 SOURCES += \
     addlibrarywidget.cpp \
     librarydownload.cpp \
+    librarydownloadscheduler.cpp \
     libraryinfowidget.cpp \
     librarylistwidgetitem.cpp \
     librarymanager.cpp \
@@ -30,6 +31,7 @@ SOURCES += \
 HEADERS += \
     addlibrarywidget.h \
     librarydownload.h \
+    librarydownloadscheduler.h \
     libraryinfowidget.h \
     librarylistwidgetitem.h \
     librarymanager.h \
@@ -23,6 +23,7 @@
 #include "repositorylibrarylistwidgetitem.h"
 
 #include "librarydownload.h"
+#include "librarydownloadscheduler.h"
 #include "ui_repositorylibrarylistwidgetitem.h"
 
 #include <librepcb/common/network/networkrequest.h>
@@ -115,7 +116,8 @@ void RepositoryLibraryListWidgetItem::setChecked(bool checked) noexcept {
  *  General Methods
  ******************************************************************************/
 
-void RepositoryLibraryListWidgetItem::startDownloadIfSelected() noexcept {
+void RepositoryLibraryListWidgetItem::startDownloadIfSelected(
+    LibraryDownloadScheduler& scheduler) noexcept {
   if (mUuid && mUi->cbxDownload->isVisible() && mUi->cbxDownload->isChecked() &&
       (!mLibraryDownload)) {
     mUi->cbxDownload->setVisible(false);
@@ -132,7 +134,7 @@ void RepositoryLibraryListWidgetItem::startDownloadIfSelected() noexcept {
     FilePath destDir =
         mWorkspace.getLibrariesPath().getPathTo("remote/" % libDirName);
 
-    // start download
+    // enqueue download
     mLibraryDownload.reset(new LibraryDownload(url, destDir));
     if (zipSize > 0) {
       mLibraryDownload->setExpectedZipFileSize(zipSize);
@@ -146,7 +148,7 @@ void RepositoryLibraryListWidgetItem::startDownloadIfSelected() noexcept {
     connect(mLibraryDownload.data(), &LibraryDownload::finished, this,
             &RepositoryLibraryListWidgetItem::downloadFinished,
             Qt::QueuedConnection);
-    mLibraryDownload->start();
+    scheduler.enqueue(*mLibraryDownload);
   }
 }
 
@@ -171,8 +173,8 @@ void RepositoryLibraryListWidgetItem::downloadFinished(
   // delete download helper
   mLibraryDownload.reset();
 
-  // start library scanner to index the new library
-  mWorkspace.getLibraryDb().startLibraryRescan();
+  // Note: The library rescan to index the new library is started by the
+  // download scheduler after all downloads of the batch have finished.
 }
 
 void RepositoryLibraryListWidgetItem::iconReceived(
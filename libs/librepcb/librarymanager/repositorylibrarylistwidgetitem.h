@@ -44,6 +44,7 @@ namespace library {
 namespace manager {
 
 class LibraryDownload;
+class LibraryDownloadScheduler;
 
 namespace Ui {
 class RepositoryLibraryListWidgetItem;
@@ -80,7 +81,7 @@ public:
   void setChecked(bool checked) noexcept;
 
   // General Methods
-  void startDownloadIfSelected() noexcept;
+  void startDownloadIfSelected(LibraryDownloadScheduler& scheduler) noexcept;
 
   // Operator Overloadings
   RepositoryLibraryListWidgetItem& operator       =(
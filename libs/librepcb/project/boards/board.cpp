@@ -52,6 +52,7 @@
 #include <librepcb/common/graphics/graphicsscene.h>
 #include <librepcb/common/graphics/graphicsview.h>
 #include <librepcb/common/gridproperties.h>
+#include <librepcb/common/profiler.h>
 #include <librepcb/common/scopeguardlist.h>
 #include <librepcb/library/cmp/component.h>
 #include <librepcb/library/pkg/footprint.h>
@@ -142,7 +143,7 @@ Board::Board(const Board&                            other,
 
     // rebuildAllPlanes(); --> fragments are copied too, so no need to rebuild
     // them
-    updateErcMessages();
+    scheduleErcMessagesUpdate(mProject);
     updateIcon();
 
     // emit the "attributesChanged" signal when the project has emited it
@@ -150,9 +151,9 @@ Board::Board(const Board&                            other,
             &Board::attributesChanged);
 
     connect(&mProject.getCircuit(), &Circuit::componentAdded, this,
-            &Board::updateErcMessages);
+            [this]() { scheduleErcMessagesUpdate(mProject); });
     connect(&mProject.getCircuit(), &Circuit::componentRemoved, this,
-            &Board::updateErcMessages);
+            [this]() { scheduleErcMessagesUpdate(mProject); });
   } catch (...) {
     // free the allocated memory in the reverse order of their allocation...
     qDeleteAll(mErcMsgListUnplacedComponentInstances);
@@ -190,6 +191,7 @@ Board::Board(Project&                                project,
     mIsAddedToProject(false),
     mUuid(Uuid::createRandom()),
     mName("New Board") {
+  LIBREPCB_PROFILE_SCOPE("Load board");
   try {
     mGraphicsScene.reset(new GraphicsScene());
 
@@ -322,7 +324,7 @@ Board::Board(Project&                                project,
     }
 
     rebuildAllPlanes();
-    updateErcMessages();
+    scheduleErcMessagesUpdate(mProject);
     updateIcon();
 
     // emit the "attributesChanged" signal when the project has emited it
@@ -330,9 +332,9 @@ Board::Board(Project&                                project,
             &Board::attributesChanged);
 
     connect(&mProject.getCircuit(), &Circuit::componentAdded, this,
-            &Board::updateErcMessages);
+            [this]() { scheduleErcMessagesUpdate(mProject); });
     connect(&mProject.getCircuit(), &Circuit::componentRemoved, this,
-            &Board::updateErcMessages);
+            [this]() { scheduleErcMessagesUpdate(mProject); });
   } catch (...) {
     // free the allocated memory in the reverse order of their allocation...
     qDeleteAll(mErcMsgListUnplacedComponentInstances);
@@ -589,7 +591,7 @@ void Board::addDeviceInstance(BI_Device& instance) {
   // add to board
   instance.addToBoard();  // can throw
   mDeviceInstances.insert(instance.getComponentInstanceUuid(), &instance);
-  updateErcMessages();
+  scheduleErcMessagesUpdate(mProject);
   emit deviceAdded(instance);
 }
 
@@ -601,7 +603,7 @@ void Board::removeDeviceInstance(BI_Device& instance) {
   // remove from board
   instance.removeFromBoard();  // can throw
   mDeviceInstances.remove(instance.getComponentInstanceUuid());
-  updateErcMessages();
+  scheduleErcMessagesUpdate(mProject);
   emit deviceRemoved(instance);
 }
 
@@ -744,6 +746,7 @@ void Board::triggerAirWiresRebuild() noexcept {
     return;
   }
 
+  LIBREPCB_PROFILE_SCOPE("Rebuild air wires");
   try {
     foreach (NetSignal* netsignal, mScheduledNetSignalsForAirWireRebuild) {
       // remove old airwires
@@ -797,7 +800,7 @@ void Board::addToProject() {
   }
   mIsAddedToProject = true;
   forceAirWiresRebuild();
-  updateErcMessages();
+  scheduleErcMessagesUpdate(mProject);
   sgl.dismiss();
 }
 
@@ -813,7 +816,7 @@ void Board::removeFromProject() {
     sgl.add([item]() { item->addToBoard(); });
   }
   mIsAddedToProject = false;
-  updateErcMessages();
+  scheduleErcMessagesUpdate(mProject);
   sgl.dismiss();
 }
 
@@ -923,6 +926,11 @@ QVector<const AttributeProvider*> Board::getAttributeProviderParents() const
  ******************************************************************************/
 
 void Board::updateIcon() noexcept {
+  // Pixmaps must only be created in the GUI thread. Boards loaded in other
+  // threads (e.g. by the CLI) are not shown in the GUI, so just skip it.
+  if (QThread::currentThread() != QCoreApplication::instance()->thread()) {
+    return;
+  }
   mIcon = QIcon(mGraphicsScene->toPixmap(QSize(297, 210), Qt::white));
 }
 
@@ -263,7 +263,7 @@ private:
   Board(Project& project, std::unique_ptr<TransactionalDirectory> directory,
         bool create, const QString& newName);
   void updateIcon() noexcept;
-  void updateErcMessages() noexcept;
+  void updateErcMessages() noexcept override;
 
   /// @copydoc librepcb::SerializableObject::serialize()
   void serialize(SExpression& root) const override;
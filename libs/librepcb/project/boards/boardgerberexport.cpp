@@ -45,6 +45,7 @@
 #include <librepcb/common/cam/gerbergenerator.h>
 #include <librepcb/common/geometry/hole.h>
 #include <librepcb/common/graphics/graphicslayer.h>
+#include <librepcb/common/profiler.h>
 #include <librepcb/library/pkg/footprint.h>
 #include <librepcb/library/pkg/footprintpad.h>
 
@@ -84,6 +85,7 @@ FilePath BoardGerberExport::getOutputDirectory() const noexcept {
  ******************************************************************************/
 
 void BoardGerberExport::exportAllLayers() const {
+  LIBREPCB_PROFILE_SCOPE("Export Gerber/Excellon");
   mWrittenFiles.clear();
 
   if (mSettings->getMergeDrillFiles()) {
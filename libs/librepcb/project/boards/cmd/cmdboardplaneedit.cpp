@@ -143,6 +143,13 @@ void CmdBoardPlaneEdit::setKeepOrphans(bool keepOrphans) noexcept {
  *  Inherited from UndoCommand
  ******************************************************************************/
 
+qint64 CmdBoardPlaneEdit::getMemoryUsage() const noexcept {
+  int vertices = mOldOutline.getVertices().capacity() +
+                 mNewOutline.getVertices().capacity();
+  return UndoCommand::getMemoryUsage() + sizeof(CmdBoardPlaneEdit) -
+         sizeof(UndoCommand) + vertices * sizeof(Vertex);
+}
+
 bool CmdBoardPlaneEdit::performExecute() {
   performRedo();  // can throw
 
@@ -66,6 +66,9 @@ public:
   void setPriority(int priority) noexcept;
   void setKeepOrphans(bool keepOrphans) noexcept;
 
+  // Inherited from UndoCommand
+  qint64 getMemoryUsage() const noexcept override;
+
 private:
   // Private Methods
 
@@ -0,0 +1,552 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "boarddesignrulecheck.h"
+
+#include "../../circuit/componentinstance.h"
+#include "../../circuit/netsignal.h"
+#include "../board.h"
+#include "../boardlayerstack.h"
+#include "../items/bi_device.h"
+#include "../items/bi_footprint.h"
+#include "../items/bi_footprintpad.h"
+#include "../items/bi_hole.h"
+#include "../items/bi_netline.h"
+#include "../items/bi_netsegment.h"
+#include "../items/bi_plane.h"
+#include "../items/bi_polygon.h"
+#include "../items/bi_via.h"
+
+#include <librepcb/common/graphics/graphicslayer.h>
+#include <librepcb/common/profiler.h>
+#include <librepcb/common/utils/clipperhelpers.h>
+#include <librepcb/common/utils/spatialindex.h>
+#include <librepcb/library/pkg/footprint.h>
+#include <librepcb/library/pkg/footprintpad.h>
+#include <librepcb/library/pkg/packagepad.h>
+
+#include <QtConcurrent/QtConcurrent>
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace project {
+
+/*******************************************************************************
+ *  Constructors / Destructor
+ ******************************************************************************/
+
+BoardDesignRuleCheck::BoardDesignRuleCheck(const Board&   board,
+                                           const Options& options,
+                                           QObject*       parent) noexcept
+  : QObject(parent), mBoard(board), mOptions(options) {
+}
+
+BoardDesignRuleCheck::~BoardDesignRuleCheck() noexcept {
+}
+
+/*******************************************************************************
+ *  General Methods
+ ******************************************************************************/
+
+void BoardDesignRuleCheck::execute() {
+  LIBREPCB_PROFILE_SCOPE("Execute DRC");
+  emit started();
+  emit progressPercent(0);
+  mMessages.clear();
+
+  // Collect the geometry in the thread of the board since the board items
+  // must not be accessed from other threads.
+  emit progressStatus(tr("Collect board geometry..."));
+  ClipperLib::Paths allowedArea     = collectBoardArea();  // can throw
+  bool              hasBoardOutline = !allowedArea.empty();
+  if (hasBoardOutline) {
+    Length offset = *maxArcTolerance() - *mOptions.minCopperBoardClearance;
+    ClipperHelpers::offset(allowedArea, offset,
+                           maxArcTolerance());  // can throw
+  }
+  QList<CopperLayer> layers;
+  layers.append(collectCopperLayer(GraphicsLayer::sTopCopper));
+  for (int i = 1; i <= mBoard.getLayerStack().getInnerLayerCount(); ++i) {
+    layers.append(collectCopperLayer(GraphicsLayer::getInnerLayerName(i)));
+  }
+  layers.append(collectCopperLayer(GraphicsLayer::sBotCopper));
+  QVector<Drill> drills = collectDrills();
+  emit progressPercent(10);
+
+  // Check the copper layers and the drills in parallel.
+  emit progressStatus(tr("Check clearances..."));
+  Options                  options = mOptions;
+  QList<QFuture<Messages>> futures;
+  for (int i = 0; i < layers.count(); ++i) {
+    const CopperLayer&       layer = layers.at(i);
+    const ClipperLib::Paths* area  = hasBoardOutline ? &allowedArea : nullptr;
+    futures.append(QtConcurrent::run([&layer, area, options, i]() {
+      return checkCopperLayer(layer, area, options, i == 0);  // can throw
+    }));
+  }
+  futures.append(QtConcurrent::run(
+      [&drills, options]() { return checkDrillClearances(drills, options); }));
+
+  // In the meantime, run the simple checks.
+  checkMinimumCopperWidth();
+  checkMinimumAnnularRing();
+
+  // Wait until all workers are finished (even if one failed) to be sure no
+  // worker is still accessing the collected geometry when we leave this
+  // method. The results are merged in a deterministic order.
+  QScopedPointer<Exception> error;
+  for (int i = 0; i < futures.count(); ++i) {
+    try {
+      mMessages.append(futures[i].result());  // can throw
+    } catch (const Exception& e) {
+      if (!error) error.reset(e.clone());
+    } catch (...) {
+      // e.g. QUnhandledException if a worker threw a non-Qt exception
+      if (!error) {
+        error.reset(new LogicError(
+            __FILE__, __LINE__, tr("Unknown error in the design rule check.")));
+      }
+    }
+    emit progressPercent(10 + (90 * (i + 1)) / futures.count());
+  }
+  if (error) {
+    error->raise();
+  }
+
+  emit progressStatus(
+      tr("Finished with %n message(s).", "", mMessages.count()));
+  emit progressPercent(100);
+  emit finished();
+}
+
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+ClipperLib::Paths BoardDesignRuleCheck::collectBoardArea() const {
+  ClipperLib::Paths outlines;
+  foreach (const BI_Polygon* polygon, mBoard.getPolygons()) {
+    if (polygon->getPolygon().getLayerName() == GraphicsLayer::sBoardOutlines) {
+      outlines.push_back(ClipperHelpers::convert(
+          polygon->getPolygon().getPath(), maxArcTolerance()));
+    }
+  }
+
+  // Outlines lying within an odd number of other outlines are cutouts, all
+  // others are outer outlines. Overlapping outer outlines are merged instead
+  // of cancelling each other out.
+  ClipperLib::Paths outerOutlines, cutouts;
+  for (std::size_t i = 0; i < outlines.size(); ++i) {
+    int depth = 0;
+    for (std::size_t k = 0; k < outlines.size(); ++k) {
+      if ((k != i) && isInside(outlines.at(i), outlines.at(k))) {
+        ++depth;
+      }
+    }
+    ClipperLib::Path path = outlines.at(i);
+    if (!ClipperLib::Orientation(path)) {
+      ClipperLib::ReversePath(path);  // NonZero fill needs same orientation
+    }
+    ((depth % 2) ? cutouts : outerOutlines).push_back(path);
+  }
+  return ClipperHelpers::clip(outerOutlines, cutouts,
+                              ClipperLib::ctDifference);  // can throw
+}
+
+BoardDesignRuleCheck::CopperLayer BoardDesignRuleCheck::collectCopperLayer(
+    const QString& name) const noexcept {
+  CopperLayer layer;
+  layer.name = name;
+
+  // clearance areas are slightly smaller to avoid false positives
+  Length expansion =
+      qMax(*mOptions.minCopperCopperClearance - *maxArcTolerance(), Length(0));
+
+  foreach (const BI_NetSegment* netsegment, mBoard.getNetSegments()) {
+    const NetSignal* netSignal = &netsegment->getNetSignal();
+    foreach (const BI_Via* via, netsegment->getVias()) {
+      if (!via->isOnLayer(name)) continue;
+      layer.items.append(createCopperItem(
+          true, netSignal,
+          tr("via of net \"%1\"").arg(*netSignal->getName()),
+          via->getSceneOutline(), via->getSceneOutline(expansion)));
+    }
+    foreach (const BI_NetLine* netline, netsegment->getNetLines()) {
+      if (netline->getLayer().getName() != name) continue;
+      layer.items.append(createCopperItem(
+          false, netSignal,
+          tr("trace of net \"%1\"").arg(*netSignal->getName()),
+          netline->getSceneOutline(), netline->getSceneOutline(expansion)));
+    }
+  }
+
+  foreach (const BI_Device* device, mBoard.getDeviceInstances()) {
+    QString component = *device->getComponentInstance().getName();
+    foreach (const BI_FootprintPad* pad, device->getFootprint().getPads()) {
+      if (!pad->isOnLayer(name)) continue;
+      bool tht = (pad->getLibPad().getBoardSide() ==
+                  library::FootprintPad::BoardSide::THT);
+      layer.items.append(createCopperItem(
+          tht, pad->getCompSigInstNetSignal(),
+          tr("pad \"%1\" of \"%2\"")
+              .arg(*pad->getLibPackagePad().getName(), component),
+          pad->getSceneOutline(), pad->getSceneOutline(expansion)));
+    }
+  }
+
+  foreach (const BI_Plane* plane, mBoard.getPlanes()) {
+    if (*plane->getLayerName() != name) continue;
+    CopperPlane copperPlane;
+    copperPlane.netSignal = &plane->getNetSignal();
+    copperPlane.description =
+        tr("plane of net \"%1\"").arg(*plane->getNetSignal().getName());
+    copperPlane.fragments =
+        ClipperHelpers::convert(plane->getFragments(), maxArcTolerance());
+    layer.planes.append(copperPlane);
+  }
+
+  return layer;
+}
+
+QVector<BoardDesignRuleCheck::Drill> BoardDesignRuleCheck::collectDrills() const
+    noexcept {
+  QVector<Drill> drills;
+  foreach (const BI_NetSegment* netsegment, mBoard.getNetSegments()) {
+    foreach (const BI_Via* via, netsegment->getVias()) {
+      drills.append(Drill{
+          via->getPosition(), via->getDrillDiameter(),
+          tr("via of net \"%1\"").arg(*netsegment->getNetSignal().getName())});
+    }
+  }
+  foreach (const BI_Device* device, mBoard.getDeviceInstances()) {
+    QString component = *device->getComponentInstance().getName();
+    foreach (const BI_FootprintPad* pad, device->getFootprint().getPads()) {
+      UnsignedLength drill = pad->getLibPad().getDrillDiameter();
+      if (*drill > 0) {
+        drills.append(Drill{
+            pad->getPosition(), PositiveLength(*drill),
+            tr("pad \"%1\" of \"%2\"")
+                .arg(*pad->getLibPackagePad().getName(), component)});
+      }
+    }
+    for (const Hole& hole :
+         device->getFootprint().getLibFootprint().getHoles()) {
+      drills.append(Drill{device->getFootprint().mapToScene(hole.getPosition()),
+                          hole.getDiameter(),
+                          tr("hole of \"%1\"").arg(component)});
+    }
+  }
+  foreach (const BI_Hole* hole, mBoard.getHoles()) {
+    drills.append(Drill{hole->getHole().getPosition(),
+                        hole->getHole().getDiameter(), tr("hole")});
+  }
+  return drills;
+}
+
+void BoardDesignRuleCheck::checkMinimumCopperWidth() noexcept {
+  foreach (const BI_NetSegment* netsegment, mBoard.getNetSegments()) {
+    foreach (const BI_NetLine* netline, netsegment->getNetLines()) {
+      if (*netline->getWidth() < *mOptions.minCopperWidth) {
+        mMessages.append(BoardDesignRuleCheckMessage(
+            tr("Minimum width violation of trace of net \"%1\": %2 < %3")
+                .arg(*netsegment->getNetSignal().getName(),
+                     formatLength(*netline->getWidth()),
+                     formatLength(*mOptions.minCopperWidth)),
+            {netline->getSceneOutline()}));
+      }
+    }
+  }
+}
+
+void BoardDesignRuleCheck::checkMinimumAnnularRing() noexcept {
+  foreach (const BI_NetSegment* netsegment, mBoard.getNetSegments()) {
+    foreach (const BI_Via* via, netsegment->getVias()) {
+      Length ring = (*via->getSize() - *via->getDrillDiameter()) / 2;
+      if (ring < *mOptions.minAnnularRing) {
+        mMessages.append(BoardDesignRuleCheckMessage(
+            tr("Minimum annular ring violation of via of net \"%1\": %2 < %3")
+                .arg(*netsegment->getNetSignal().getName(), formatLength(ring),
+                     formatLength(*mOptions.minAnnularRing)),
+            {via->getSceneOutline()}));
+      }
+    }
+  }
+  foreach (const BI_Device* device, mBoard.getDeviceInstances()) {
+    QString component = *device->getComponentInstance().getName();
+    foreach (const BI_FootprintPad* pad, device->getFootprint().getPads()) {
+      const library::FootprintPad& libPad = pad->getLibPad();
+      if (*libPad.getDrillDiameter() == 0) continue;
+      Length size = qMin(*libPad.getWidth(), *libPad.getHeight());
+      Length ring = (size - *libPad.getDrillDiameter()) / 2;
+      if (ring < *mOptions.minAnnularRing) {
+        mMessages.append(BoardDesignRuleCheckMessage(
+            tr("Minimum annular ring violation of pad \"%1\" of \"%2\": "
+               "%3 < %4")
+                .arg(*pad->getLibPackagePad().getName(), component,
+                     formatLength(ring),
+                     formatLength(*mOptions.minAnnularRing)),
+            {pad->getSceneOutline()}));
+      }
+    }
+  }
+}
+
+BoardDesignRuleCheck::Messages BoardDesignRuleCheck::checkCopperLayer(
+    const CopperLayer& layer, const ClipperLib::Paths* allowedArea,
+    const Options& options, bool isFirstLayer) {
+  LIBREPCB_PROFILE_SCOPE("Check copper layer");
+  Messages messages;
+
+  // Build a spatial index of the clearance areas. The cell size is the average
+  // item size, which is a good trade-off between the number of cells per item
+  // and the number of items per cell.
+  LengthBase_t totalSize = 0;
+  foreach (const CopperItem& item, layer.items) {
+    Point size = item.clearanceAreaMax - item.clearanceAreaMin;
+    totalSize += qMax(size.getX(), size.getY()).toNm();
+  }
+  Length       averageSize(totalSize / qMax(layer.items.count(), 1));
+  SpatialIndex index(PositiveLength(qMax(averageSize, Length(100000))));
+  foreach (const CopperItem& item, layer.items) {
+    index.insert(item.clearanceAreaMin, item.clearanceAreaMax);
+  }
+
+  // Items of different nets. Vias and THT pads look the same on every layer,
+  // so pairs of them are only checked on the first layer to avoid duplicate
+  // messages.
+  typedef QPair<int, int> IndexPair;
+  foreach (const IndexPair& pair, index.getOverlappingPairs()) {
+    const CopperItem& a = layer.items.at(pair.first);
+    const CopperItem& b = layer.items.at(pair.second);
+    if (a.netSignal && (a.netSignal == b.netSignal)) continue;
+    if (a.onAllLayers && b.onAllLayers && (!isFirstLayer)) continue;
+    if (!ClipperHelpers::clip({a.clearanceArea}, {b.outline},
+                              ClipperLib::ctIntersection)  // can throw
+             .empty()) {
+      messages.append(BoardDesignRuleCheckMessage(
+          tr("Clearance violation between %1 and %2")
+              .arg(a.description, b.description),
+          {ClipperHelpers::convert(a.outline),
+           ClipperHelpers::convert(b.outline)}));
+    }
+  }
+
+  // Planes against items of different nets. All items are clipped with a plane
+  // at once, then the items are determined from the overlapping areas.
+  foreach (const CopperPlane& plane, layer.planes) {
+    ClipperLib::Paths areas;
+    foreach (const CopperItem& item, layer.items) {
+      if (item.netSignal != plane.netSignal) {
+        areas.push_back(item.clearanceArea);
+      }
+    }
+    ClipperLib::Paths overlaps = ClipperHelpers::clip(
+        plane.fragments, areas, ClipperLib::ctIntersection);  // can throw
+    QSet<int> reportedItems;
+    for (const ClipperLib::Path& overlap : overlaps) {
+      Point min, max;
+      getBoundingBox(overlap, min, max);
+      foreach (int i, index.query(min, max)) {
+        const CopperItem& item = layer.items.at(i);
+        if (item.netSignal == plane.netSignal) continue;
+        if (reportedItems.contains(i)) continue;
+        if (ClipperHelpers::clip({item.clearanceArea}, {overlap},
+                                 ClipperLib::ctIntersection)  // can throw
+                .empty()) {
+          continue;
+        }
+        reportedItems.insert(i);
+        messages.append(BoardDesignRuleCheckMessage(
+            tr("Clearance violation between %1 and %2")
+                .arg(item.description, plane.description),
+            {ClipperHelpers::convert(item.outline),
+             ClipperHelpers::convert(overlap)}));
+      }
+    }
+  }
+
+  // Planes against planes of different nets.
+  Length planeExpansion =
+      qMax(*options.minCopperCopperClearance - *maxArcTolerance(), Length(0));
+  for (int i = 0; i < layer.planes.count(); ++i) {
+    const CopperPlane& a = layer.planes.at(i);
+    if (a.fragments.empty()) continue;
+    ClipperLib::Paths area = a.fragments;
+    ClipperHelpers::offset(area, planeExpansion,
+                           maxArcTolerance());  // can throw
+    for (int k = i + 1; k < layer.planes.count(); ++k) {
+      const CopperPlane& b = layer.planes.at(k);
+      if (a.netSignal == b.netSignal) continue;
+      ClipperLib::Paths overlaps = ClipperHelpers::clip(
+          area, b.fragments, ClipperLib::ctIntersection);  // can throw
+      if (!overlaps.empty()) {
+        messages.append(BoardDesignRuleCheckMessage(
+            tr("Clearance violation between %1 and %2")
+                .arg(a.description, b.description),
+            ClipperHelpers::convert(overlaps)));
+      }
+    }
+  }
+
+  // Copper against board outline. Again all items are clipped at once.
+  if (allowedArea) {
+    ClipperLib::Paths outlines;
+    foreach (const CopperItem& item, layer.items) {
+      outlines.push_back(item.outline);
+    }
+    ClipperLib::Paths violations = ClipperHelpers::clip(
+        outlines, *allowedArea, ClipperLib::ctDifference);  // can throw
+    QSet<int> reportedItems;
+    for (const ClipperLib::Path& violation : violations) {
+      Point min, max;
+      getBoundingBox(violation, min, max);
+      foreach (int i, index.query(min, max)) {
+        const CopperItem& item = layer.items.at(i);
+        if (reportedItems.contains(i)) continue;
+        if (item.onAllLayers && (!isFirstLayer)) continue;
+        if (ClipperHelpers::clip({item.outline}, {violation},
+                                 ClipperLib::ctIntersection)  // can throw
+                .empty()) {
+          continue;
+        }
+        reportedItems.insert(i);
+        messages.append(BoardDesignRuleCheckMessage(
+            tr("Clearance violation between %1 and board outline")
+                .arg(item.description),
+            {ClipperHelpers::convert(item.outline)}));
+      }
+    }
+    foreach (const CopperPlane& plane, layer.planes) {
+      ClipperLib::Paths planeViolations =
+          ClipperHelpers::clip(plane.fragments, *allowedArea,
+                               ClipperLib::ctDifference);  // can throw
+      if (!planeViolations.empty()) {
+        messages.append(BoardDesignRuleCheckMessage(
+            tr("Clearance violation between %1 and board outline")
+                .arg(plane.description),
+            ClipperHelpers::convert(planeViolations)));
+      }
+    }
+  }
+
+  return messages;
+}
+
+BoardDesignRuleCheck::Messages BoardDesignRuleCheck::checkDrillClearances(
+    const QVector<Drill>& drills, const Options& options) noexcept {
+  LIBREPCB_PROFILE_SCOPE("Check drill clearances");
+  Messages messages;
+
+  // Index the drills expanded by half of the clearance, so every violation
+  // leads to overlapping bounding boxes.
+  Length maxDiameter(0);
+  foreach (const Drill& drill, drills) {
+    maxDiameter = qMax(maxDiameter, *drill.diameter);
+  }
+  Length       clearance = *options.minDrillDrillClearance;
+  SpatialIndex index(PositiveLength(maxDiameter + clearance + Length(1)));
+  foreach (const Drill& drill, drills) {
+    Length radius = (*drill.diameter + clearance) / 2;
+    index.insert(drill.position - Point(radius, radius),
+                 drill.position + Point(radius, radius));
+  }
+
+  typedef QPair<int, int> IndexPair;
+  foreach (const IndexPair& pair, index.getOverlappingPairs()) {
+    const Drill& a        = drills.at(pair.first);
+    const Drill& b        = drills.at(pair.second);
+    Length       distance = (b.position - a.position).getLength();
+    Length       gap      = distance - (*a.diameter / 2) - (*b.diameter / 2);
+    if (gap < clearance) {
+      messages.append(BoardDesignRuleCheckMessage(
+          tr("Drill clearance violation between %1 and %2: %3 < %4")
+              .arg(a.description, b.description, formatLength(gap),
+                   formatLength(clearance)),
+          {Path::circle(a.diameter).translated(a.position),
+           Path::circle(b.diameter).translated(b.position)}));
+    }
+  }
+  return messages;
+}
+
+/*******************************************************************************
+ *  Helper Methods
+ ******************************************************************************/
+
+BoardDesignRuleCheck::CopperItem BoardDesignRuleCheck::createCopperItem(
+    bool onAllLayers, const NetSignal* netSignal, const QString& description,
+    const Path& outline, const Path& clearanceArea) noexcept {
+  CopperItem item;
+  item.onAllLayers   = onAllLayers;
+  item.netSignal     = netSignal;
+  item.description   = description;
+  item.outline       = ClipperHelpers::convert(outline, maxArcTolerance());
+  item.clearanceArea =
+      ClipperHelpers::convert(clearanceArea, maxArcTolerance());
+  getBoundingBox(item.clearanceArea, item.clearanceAreaMin,
+                 item.clearanceAreaMax);
+  return item;
+}
+
+bool BoardDesignRuleCheck::isInside(const ClipperLib::Path& inner,
+                                    const ClipperLib::Path& outer) noexcept {
+  // use the first vertex which is not on the outer path
+  for (const ClipperLib::IntPoint& point : inner) {
+    int result = ClipperLib::PointInPolygon(point, outer);
+    if (result >= 0) {
+      return result > 0;
+    }
+  }
+  return false;  // identical paths
+}
+
+void BoardDesignRuleCheck::getBoundingBox(const ClipperLib::Path& path,
+                                          Point& min, Point& max) noexcept {
+  if (path.empty()) {
+    min = max = Point();
+    return;
+  }
+  ClipperLib::cInt left = path.front().X, right = path.front().X;
+  ClipperLib::cInt bottom = path.front().Y, top = path.front().Y;
+  for (const ClipperLib::IntPoint& p : path) {
+    left   = qMin(left, p.X);
+    right  = qMax(right, p.X);
+    bottom = qMin(bottom, p.Y);
+    top    = qMax(top, p.Y);
+  }
+  min = Point(Length(left), Length(bottom));
+  max = Point(Length(right), Length(top));
+}
+
+QString BoardDesignRuleCheck::formatLength(const Length& length) noexcept {
+  return QString("%1mm").arg(length.toMmString());
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace project
+}  // namespace librepcb
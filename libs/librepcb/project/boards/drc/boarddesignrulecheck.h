@@ -0,0 +1,186 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_PROJECT_BOARDDESIGNRULECHECK_H
+#define LIBREPCB_PROJECT_BOARDDESIGNRULECHECK_H
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "boarddesignrulecheckmessage.h"
+
+#include <clipper/clipper.hpp>
+#include <librepcb/common/units/all_length_units.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace / Forward Declarations
+ ******************************************************************************/
+namespace librepcb {
+namespace project {
+
+class Board;
+class NetSignal;
+
+/*******************************************************************************
+ *  Class BoardDesignRuleCheck
+ ******************************************************************************/
+
+/**
+ * @brief Checks a board for violations of the design rules
+ *
+ * The following rules are checked:
+ *
+ *   - Clearance between copper objects of different nets (traces, vias, pads
+ *     and plane fragments) on the same layer
+ *   - Clearance between copper objects and the board outline
+ *   - Minimum width of traces
+ *   - Minimum annular ring of vias and THT pads
+ *   - Clearance between drills (vias, THT pads and holes)
+ *
+ * First, the geometry of all relevant board items is collected in the thread
+ * of the board. Then the layers are checked in parallel on the global thread
+ * pool, without accessing the board anymore. Candidates for clearance
+ * violations are determined with a ::librepcb::SpatialIndex, so only objects
+ * close to each other are compared with the (expensive) polygon clipping.
+ *
+ * To avoid false positives caused by the approximation of arcs with straight
+ * line segments, clearances are checked with a tolerance of
+ * #maxArcTolerance().
+ */
+class BoardDesignRuleCheck final : public QObject {
+  Q_OBJECT
+
+public:
+  // Types
+  struct Options {
+    UnsignedLength minCopperCopperClearance;
+    UnsignedLength minCopperBoardClearance;
+    UnsignedLength minCopperWidth;
+    UnsignedLength minAnnularRing;
+    UnsignedLength minDrillDrillClearance;
+
+    Options() noexcept
+      : minCopperCopperClearance(200000),  // 0.2mm
+        minCopperBoardClearance(300000),   // 0.3mm
+        minCopperWidth(200000),            // 0.2mm
+        minAnnularRing(200000),            // 0.2mm
+        minDrillDrillClearance(350000) {   // 0.35mm
+    }
+  };
+
+  // Constructors / Destructor
+  BoardDesignRuleCheck()                                  = delete;
+  BoardDesignRuleCheck(const BoardDesignRuleCheck& other) = delete;
+  BoardDesignRuleCheck(const Board& board, const Options& options,
+                       QObject* parent = nullptr) noexcept;
+  ~BoardDesignRuleCheck() noexcept;
+
+  // Getters
+  const Options& getOptions() const noexcept { return mOptions; }
+  const QList<BoardDesignRuleCheckMessage>& getMessages() const noexcept {
+    return mMessages;
+  }
+
+  // General Methods
+  void execute();
+
+  // Operator Overloadings
+  BoardDesignRuleCheck& operator=(const BoardDesignRuleCheck& rhs) = delete;
+
+signals:
+  void started();
+  void progressPercent(int percent);
+  void progressStatus(const QString& status);
+  void finished();
+
+private:  // Types
+  struct CopperItem {
+    bool             onAllLayers;  ///< Vias and THT pads
+    const NetSignal* netSignal;    ///< nullptr if not connected to any net
+    QString          description;
+    ClipperLib::Path outline;
+    ClipperLib::Path clearanceArea;  ///< Outline expanded by the clearance
+    Point            clearanceAreaMin;
+    Point            clearanceAreaMax;
+  };
+  struct CopperPlane {
+    const NetSignal*  netSignal;
+    QString           description;
+    ClipperLib::Paths fragments;
+  };
+  struct CopperLayer {
+    QString              name;
+    QVector<CopperItem>  items;
+    QVector<CopperPlane> planes;
+  };
+  struct Drill {
+    Point          position;
+    PositiveLength diameter;
+    QString        description;
+  };
+  typedef QList<BoardDesignRuleCheckMessage> Messages;
+
+private:  // Methods
+  ClipperLib::Paths collectBoardArea() const;
+  CopperLayer       collectCopperLayer(const QString& name) const noexcept;
+  QVector<Drill>    collectDrills() const noexcept;
+  void              checkMinimumCopperWidth() noexcept;
+  void              checkMinimumAnnularRing() noexcept;
+  static Messages   checkCopperLayer(const CopperLayer&       layer,
+                                     const ClipperLib::Paths* allowedArea,
+                                     const Options& options, bool isFirstLayer);
+  static Messages   checkDrillClearances(const QVector<Drill>& drills,
+                                         const Options& options) noexcept;
+
+  // Helper Methods
+  static CopperItem createCopperItem(bool             onAllLayers,
+                                     const NetSignal* netSignal,
+                                     const QString&   description,
+                                     const Path&      outline,
+                                     const Path&      clearanceArea) noexcept;
+  static bool    isInside(const ClipperLib::Path& inner,
+                          const ClipperLib::Path& outer) noexcept;
+  static void    getBoundingBox(const ClipperLib::Path& path, Point& min,
+                                Point& max) noexcept;
+  static QString formatLength(const Length& length) noexcept;
+
+  /**
+   * Returns the maximum allowed arc tolerance when flattening arcs. This is
+   * the same tolerance as used for board planes.
+   */
+  static PositiveLength maxArcTolerance() noexcept {
+    return PositiveLength(5000);
+  }
+
+private:  // Data
+  const Board& mBoard;
+  Options      mOptions;
+  Messages     mMessages;
+};
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace project
+}  // namespace librepcb
+
+#endif  // LIBREPCB_PROJECT_BOARDDESIGNRULECHECK_H
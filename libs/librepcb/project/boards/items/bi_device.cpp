@@ -228,7 +228,7 @@ void BI_Device::addToBoard() {
   mFootprint->addToBoard();  // can throw
   sg.dismiss();
   BI_Base::addToBoard(nullptr);
-  updateErcMessages();
+  scheduleErcMessagesUpdate(getProject());
 }
 
 void BI_Device::removeFromBoard() {
@@ -240,7 +240,7 @@ void BI_Device::removeFromBoard() {
   mCompInstance->unregisterDevice(*this);  // can throw
   sg.dismiss();
   BI_Base::removeFromBoard(nullptr);
-  updateErcMessages();
+  scheduleErcMessagesUpdate(getProject());
 }
 
 void BI_Device::serialize(SExpression& root) const {
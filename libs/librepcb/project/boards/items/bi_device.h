@@ -140,7 +140,7 @@ private:
                                                       const Uuid& footprintUuid);
   void               init();
   bool               checkAttributesValidity() const noexcept;
-  void               updateErcMessages() noexcept;
+  void               updateErcMessages() noexcept override;
   const QStringList& getLocaleOrder() const noexcept;
 
   // General
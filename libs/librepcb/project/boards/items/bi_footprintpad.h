@@ -38,6 +38,7 @@ namespace librepcb {
 
 namespace library {
 class FootprintPad;
+class PackagePad;
 class ComponentSignal;
 }  // namespace library
 
@@ -73,6 +74,9 @@ public:
   const library::FootprintPad& getLibPad() const noexcept {
     return *mFootprintPad;
   }
+  const library::PackagePad& getLibPackagePad() const noexcept {
+    return *mPackagePad;
+  }
   ComponentSignalInstance* getComponentSignalInstance() const noexcept {
     return mComponentSignalInstance;
   }
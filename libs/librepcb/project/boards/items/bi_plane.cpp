@@ -28,6 +28,7 @@
 #include "../boardplanefragmentsbuilder.h"
 #include "../graphicsitems/bgi_plane.h"
 
+#include <librepcb/common/profiler.h>
 #include <librepcb/common/scopeguard.h>
 
 #include <QtCore>
@@ -211,6 +212,7 @@ void BI_Plane::clear() noexcept {
 }
 
 void BI_Plane::rebuild() noexcept {
+  LIBREPCB_PROFILE_SCOPE("Rebuild planes");
   BoardPlaneFragmentsBuilder builder(*this);
   mFragments = builder.buildFragments();
   mGraphicsItem->updateCacheAndRepaint();
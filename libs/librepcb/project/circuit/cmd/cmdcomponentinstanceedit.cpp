@@ -77,6 +77,12 @@ void CmdComponentInstanceEdit::setAttributes(
  *  Inherited from UndoCommand
  ******************************************************************************/
 
+qint64 CmdComponentInstanceEdit::getMemoryUsage() const noexcept {
+  int attributes = mOldAttributes.count() + mNewAttributes.count();
+  return UndoCommand::getMemoryUsage() + sizeof(CmdComponentInstanceEdit) -
+         sizeof(UndoCommand) + attributes * sizeof(Attribute);
+}
+
 bool CmdComponentInstanceEdit::performExecute() {
   performRedo();  // can throw
 
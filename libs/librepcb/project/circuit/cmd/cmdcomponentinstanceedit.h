@@ -62,6 +62,9 @@ public:
   void setValue(const QString& value) noexcept;
   void setAttributes(const AttributeList& attributes) noexcept;
 
+  // Inherited from UndoCommand
+  qint64 getMemoryUsage() const noexcept override;
+
 private:
   // Private Methods
 
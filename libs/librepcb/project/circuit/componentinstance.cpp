@@ -141,7 +141,7 @@ void ComponentInstance::init() {
   mErcMsgUnplacedOptionalSymbols.reset(new ErcMsg(
       mCircuit.getProject(), *this, mUuid.toStr(), "UnplacedOptionalSymbols",
       ErcMsg::ErcMsgType_t::SchematicWarning));
-  updateErcMessages();
+  scheduleErcMessagesUpdate(mCircuit.getProject());
 
   // emit the "attributesChanged" signal when the project has emited it
   connect(&mCircuit.getProject(), &Project::attributesChanged, this,
@@ -223,7 +223,7 @@ bool ComponentInstance::isUsed() const noexcept {
 void ComponentInstance::setName(const CircuitIdentifier& name) noexcept {
   if (name != mName) {
     mName = name;
-    updateErcMessages();
+    scheduleErcMessagesUpdate(mCircuit.getProject());
     emit attributesChanged();
   }
 }
@@ -257,7 +257,7 @@ void ComponentInstance::addToCircuit() {
     sgl.add([signal]() { signal->removeFromCircuit(); });
   }
   mIsAddedToCircuit = true;
-  updateErcMessages();
+  scheduleErcMessagesUpdate(mCircuit.getProject());
   sgl.dismiss();
 }
 
@@ -277,7 +277,7 @@ void ComponentInstance::removeFromCircuit() {
     sgl.add([signal]() { signal->addToCircuit(); });
   }
   mIsAddedToCircuit = false;
-  updateErcMessages();
+  scheduleErcMessagesUpdate(mCircuit.getProject());
   sgl.dismiss();
 }
 
@@ -311,7 +311,7 @@ void ComponentInstance::registerSymbol(SI_Symbol& symbol) {
     }
   }
   mRegisteredSymbols.insert(itemUuid, &symbol);
-  updateErcMessages();
+  scheduleErcMessagesUpdate(mCircuit.getProject());
 }
 
 void ComponentInstance::unregisterSymbol(SI_Symbol& symbol) {
@@ -321,7 +321,7 @@ void ComponentInstance::unregisterSymbol(SI_Symbol& symbol) {
     throw LogicError(__FILE__, __LINE__);
   }
   mRegisteredSymbols.remove(itemUuid);
-  updateErcMessages();
+  scheduleErcMessagesUpdate(mCircuit.getProject());
 }
 
 void ComponentInstance::registerDevice(BI_Device& device) {
@@ -331,7 +331,7 @@ void ComponentInstance::registerDevice(BI_Device& device) {
     throw LogicError(__FILE__, __LINE__);
   }
   mRegisteredDevices.append(&device);
-  updateErcMessages();
+  scheduleErcMessagesUpdate(mCircuit.getProject());
   emit attributesChanged();  // parent attribute provider may have changed!
 }
 
@@ -340,7 +340,7 @@ void ComponentInstance::unregisterDevice(BI_Device& device) {
     throw LogicError(__FILE__, __LINE__);
   }
   mRegisteredDevices.removeOne(&device);
-  updateErcMessages();
+  scheduleErcMessagesUpdate(mCircuit.getProject());
   emit attributesChanged();  // parent attribute provider may have changed!
 }
 
@@ -168,7 +168,7 @@ signals:
 private:
   void               init();
   bool               checkAttributesValidity() const noexcept;
-  void               updateErcMessages() noexcept;
+  void               updateErcMessages() noexcept override;
   const QStringList& getLocaleOrder() const noexcept;
 
   // General
@@ -104,11 +104,11 @@ void ComponentSignalInstance::init() {
                      .arg(mComponentSignal->getUuid().toStr()),
                  "ForcedNetSignalNameConflict",
                  ErcMsg::ErcMsgType_t::SchematicError, QString()));
-  updateErcMessages();
+  scheduleErcMessagesUpdate(mCircuit.getProject());
 
   // register to component attributes changed
   connect(&mComponentInstance, &ComponentInstance::attributesChanged, this,
-          &ComponentSignalInstance::updateErcMessages);
+          [this]() { scheduleErcMessagesUpdate(mCircuit.getProject()); });
 
   // register to net signal name changed
   if (mNetSignal) {
@@ -201,7 +201,7 @@ void ComponentSignalInstance::setNetSignal(NetSignal* netsignal) {
   }
   NetSignal* old = mNetSignal;
   mNetSignal     = netsignal;
-  updateErcMessages();
+  scheduleErcMessagesUpdate(mCircuit.getProject());
   sgl.dismiss();
   emit netSignalChanged(old, mNetSignal);
 }
@@ -218,7 +218,7 @@ void ComponentSignalInstance::addToCircuit() {
     mNetSignal->registerComponentSignal(*this);  // can throw
   }
   mIsAddedToCircuit = true;
-  updateErcMessages();
+  scheduleErcMessagesUpdate(mCircuit.getProject());
 }
 
 void ComponentSignalInstance::removeFromCircuit() {
@@ -235,7 +235,7 @@ void ComponentSignalInstance::removeFromCircuit() {
     mNetSignal->unregisterComponentSignal(*this);  // can throw
   }
   mIsAddedToCircuit = false;
-  updateErcMessages();
+  scheduleErcMessagesUpdate(mCircuit.getProject());
 }
 
 void ComponentSignalInstance::registerSymbolPin(SI_SymbolPin& pin) {
@@ -294,7 +294,7 @@ bool ComponentSignalInstance::checkAttributesValidity() const noexcept {
 void ComponentSignalInstance::netSignalNameChanged(
     const CircuitIdentifier& newName) noexcept {
   Q_UNUSED(newName);
-  updateErcMessages();
+  scheduleErcMessagesUpdate(mCircuit.getProject());
 }
 
 void ComponentSignalInstance::updateErcMessages() noexcept {
@@ -131,7 +131,7 @@ signals:
 private slots:
 
   void netSignalNameChanged(const CircuitIdentifier& newName) noexcept;
-  void updateErcMessages() noexcept;
+  void updateErcMessages() noexcept override;
 
 private:
   void init();
@@ -70,7 +70,7 @@ void NetClass::setName(const ElementName& name) noexcept {
     return;
   }
   mName = name;
-  updateErcMessages();
+  scheduleErcMessagesUpdate(mCircuit.getProject());
 }
 
 /*******************************************************************************
@@ -82,7 +82,7 @@ void NetClass::addToCircuit() {
     throw LogicError(__FILE__, __LINE__);
   }
   mIsAddedToCircuit = true;
-  updateErcMessages();
+  scheduleErcMessagesUpdate(mCircuit.getProject());
 }
 
 void NetClass::removeFromCircuit() {
@@ -96,7 +96,7 @@ void NetClass::removeFromCircuit() {
                            .arg(*mName));
   }
   mIsAddedToCircuit = false;
-  updateErcMessages();
+  scheduleErcMessagesUpdate(mCircuit.getProject());
 }
 
 void NetClass::registerNetSignal(NetSignal& signal) {
@@ -106,7 +106,7 @@ void NetClass::registerNetSignal(NetSignal& signal) {
     throw LogicError(__FILE__, __LINE__);
   }
   mRegisteredNetSignals.insert(signal.getUuid(), &signal);
-  updateErcMessages();
+  scheduleErcMessagesUpdate(mCircuit.getProject());
 }
 
 void NetClass::unregisterNetSignal(NetSignal& signal) {
@@ -115,7 +115,7 @@ void NetClass::unregisterNetSignal(NetSignal& signal) {
     throw LogicError(__FILE__, __LINE__);
   }
   mRegisteredNetSignals.remove(signal.getUuid());
-  updateErcMessages();
+  scheduleErcMessagesUpdate(mCircuit.getProject());
 }
 
 void NetClass::serialize(SExpression& root) const {
@@ -119,7 +119,7 @@ void NetSignal::setName(const CircuitIdentifier& name,
   }
   mName        = name;
   mHasAutoName = isAutoName;
-  updateErcMessages();
+  scheduleErcMessagesUpdate(mCircuit.getProject());
   emit nameChanged(mName);
 }
 
@@ -140,7 +140,7 @@ void NetSignal::addToCircuit() {
   }
   mNetClass->registerNetSignal(*this);  // can throw
   mIsAddedToCircuit = true;
-  updateErcMessages();
+  scheduleErcMessagesUpdate(mCircuit.getProject());
 }
 
 void NetSignal::removeFromCircuit() {
@@ -155,7 +155,7 @@ void NetSignal::removeFromCircuit() {
   }
   mNetClass->unregisterNetSignal(*this);  // can throw
   mIsAddedToCircuit = false;
-  updateErcMessages();
+  scheduleErcMessagesUpdate(mCircuit.getProject());
 }
 
 void NetSignal::registerComponentSignal(ComponentSignalInstance& signal) {
@@ -164,7 +164,7 @@ void NetSignal::registerComponentSignal(ComponentSignalInstance& signal) {
     throw LogicError(__FILE__, __LINE__);
   }
   mRegisteredComponentSignals.append(&signal);
-  updateErcMessages();
+  scheduleErcMessagesUpdate(mCircuit.getProject());
 }
 
 void NetSignal::unregisterComponentSignal(ComponentSignalInstance& signal) {
@@ -173,7 +173,7 @@ void NetSignal::unregisterComponentSignal(ComponentSignalInstance& signal) {
     throw LogicError(__FILE__, __LINE__);
   }
   mRegisteredComponentSignals.removeOne(&signal);
-  updateErcMessages();
+  scheduleErcMessagesUpdate(mCircuit.getProject());
 }
 
 void NetSignal::registerSchematicNetSegment(SI_NetSegment& netsegment) {
@@ -183,7 +183,7 @@ void NetSignal::registerSchematicNetSegment(SI_NetSegment& netsegment) {
     throw LogicError(__FILE__, __LINE__);
   }
   mRegisteredSchematicNetSegments.append(&netsegment);
-  updateErcMessages();
+  scheduleErcMessagesUpdate(mCircuit.getProject());
 }
 
 void NetSignal::unregisterSchematicNetSegment(SI_NetSegment& netsegment) {
@@ -192,7 +192,7 @@ void NetSignal::unregisterSchematicNetSegment(SI_NetSegment& netsegment) {
     throw LogicError(__FILE__, __LINE__);
   }
   mRegisteredSchematicNetSegments.removeOne(&netsegment);
-  updateErcMessages();
+  scheduleErcMessagesUpdate(mCircuit.getProject());
 }
 
 void NetSignal::registerBoardNetSegment(BI_NetSegment& netsegment) {
@@ -202,7 +202,7 @@ void NetSignal::registerBoardNetSegment(BI_NetSegment& netsegment) {
     throw LogicError(__FILE__, __LINE__);
   }
   mRegisteredBoardNetSegments.append(&netsegment);
-  updateErcMessages();
+  scheduleErcMessagesUpdate(mCircuit.getProject());
 }
 
 void NetSignal::unregisterBoardNetSegment(BI_NetSegment& netsegment) {
@@ -211,7 +211,7 @@ void NetSignal::unregisterBoardNetSegment(BI_NetSegment& netsegment) {
     throw LogicError(__FILE__, __LINE__);
   }
   mRegisteredBoardNetSegments.removeOne(&netsegment);
-  updateErcMessages();
+  scheduleErcMessagesUpdate(mCircuit.getProject());
 }
 
 void NetSignal::registerBoardPlane(BI_Plane& plane) {
@@ -220,7 +220,7 @@ void NetSignal::registerBoardPlane(BI_Plane& plane) {
     throw LogicError(__FILE__, __LINE__);
   }
   mRegisteredBoardPlanes.append(&plane);
-  updateErcMessages();
+  scheduleErcMessagesUpdate(mCircuit.getProject());
 }
 
 void NetSignal::unregisterBoardPlane(BI_Plane& plane) {
@@ -228,7 +228,7 @@ void NetSignal::unregisterBoardPlane(BI_Plane& plane) {
     throw LogicError(__FILE__, __LINE__);
   }
   mRegisteredBoardPlanes.removeOne(&plane);
-  updateErcMessages();
+  scheduleErcMessagesUpdate(mCircuit.getProject());
 }
 
 void NetSignal::serialize(SExpression& root) const {
@@ -125,7 +125,7 @@ signals:
 
 private:
   bool checkAttributesValidity() const noexcept;
-  void updateErcMessages() noexcept;
+  void updateErcMessages() noexcept override;
 
   // General
   Circuit& mCircuit;
@@ -30,6 +30,8 @@
 
 #include <QtCore>
 
+#include <algorithm>
+
 /*******************************************************************************
  *  Namespace
  ******************************************************************************/
@@ -41,11 +43,25 @@ namespace project {
  ******************************************************************************/
 
 ErcMsgList::ErcMsgList(Project& project)
-  : QObject(&project), mProject(project) {
+  : QObject(&project),
+    mProject(project),
+    mNextSequenceNumber(0),
+    mUpdateTimerPending(false) {
 }
 
 ErcMsgList::~ErcMsgList() noexcept {
   Q_ASSERT(mItems.isEmpty());
+  Q_ASSERT(mScheduledUpdates.isEmpty());
+}
+
+/*******************************************************************************
+ *  Getters
+ ******************************************************************************/
+
+QList<ErcMsg*> ErcMsgList::getItems() noexcept {
+  executeScheduledUpdates();
+
+  return getItemsInInsertionOrder();
 }
 
 /*******************************************************************************
@@ -56,7 +72,7 @@ void ErcMsgList::add(ErcMsg* ercMsg) noexcept {
   Q_ASSERT(ercMsg);
   Q_ASSERT(!mItems.contains(ercMsg));
   Q_ASSERT(!ercMsg->isIgnored());
-  mItems.append(ercMsg);
+  mItems.insert(ercMsg, mNextSequenceNumber++);
   emit ercMsgAdded(ercMsg);
 }
 
@@ -64,7 +80,7 @@ void ErcMsgList::remove(ErcMsg* ercMsg) noexcept {
   Q_ASSERT(ercMsg);
   Q_ASSERT(mItems.contains(ercMsg));
   Q_ASSERT(!ercMsg->isIgnored());
-  mItems.removeOne(ercMsg);
+  mItems.remove(ercMsg);
   emit ercMsgRemoved(ercMsg);
 }
 
@@ -75,33 +91,75 @@ void ErcMsgList::update(ErcMsg* ercMsg) noexcept {
   emit ercMsgChanged(ercMsg);
 }
 
+void ErcMsgList::scheduleUpdate(IF_ErcMsgProvider& provider) noexcept {
+  Q_ASSERT((!provider.mErcMsgListOfScheduledUpdate) ||
+           (provider.mErcMsgListOfScheduledUpdate == this));
+  provider.mErcMsgListOfScheduledUpdate = this;
+  if (!mScheduledUpdates.contains(&provider)) {
+    mScheduledUpdates.insert(&provider);
+    mScheduledUpdatesQueue.append(&provider);
+  }
+  // Without an event loop (e.g. if the project was opened in a worker thread
+  // of the CLI), the scheduled updates are only executed on demand, e.g. by
+  // getItems() or save().
+  if ((!mUpdateTimerPending) && thread()->eventDispatcher()) {
+    mUpdateTimerPending = true;
+#if (QT_VERSION >= QT_VERSION_CHECK(5, 4, 0))
+    QTimer::singleShot(0, this, &ErcMsgList::executeScheduledUpdates);
+#else
+    QTimer::singleShot(0, this, SLOT(executeScheduledUpdates()));
+#endif
+  }
+}
+
+void ErcMsgList::cancelScheduledUpdate(IF_ErcMsgProvider& provider) noexcept {
+  Q_ASSERT(provider.mErcMsgListOfScheduledUpdate == this);
+  provider.mErcMsgListOfScheduledUpdate = nullptr;
+  if (mScheduledUpdates.remove(&provider)) {
+    mScheduledUpdatesQueue.removeOne(&provider);
+  }
+}
+
+void ErcMsgList::executeScheduledUpdates() noexcept {
+  mUpdateTimerPending = false;
+  // updating a provider might schedule updates of other providers
+  while (!mScheduledUpdatesQueue.isEmpty()) {
+    IF_ErcMsgProvider* provider = mScheduledUpdatesQueue.first();
+    cancelScheduledUpdate(*provider);  // removes it from the queue
+    provider->updateErcMessages();
+  }
+  Q_ASSERT(mScheduledUpdates.isEmpty());
+}
+
 void ErcMsgList::restoreIgnoreState() {
+  executeScheduledUpdates();
+
   QString fp = "circuit/erc.lp";
   if (mProject.getDirectory().fileExists(fp)) {
     SExpression root =
         SExpression::parse(mProject.getDirectory().read(fp),
                            mProject.getDirectory().getAbsPath(fp));
 
-    // reset all ignore attributes
-    foreach (ErcMsg* ercMsg, mItems)
-      ercMsg->setIgnored(false);
-
-    // scan approved items and set ignore attributes
+    // collect all approved messages
+    QSet<QString> approved;
     foreach (const SExpression& node, root.getChildren("approved")) {
-      foreach (ErcMsg* ercMsg, mItems) {
-        if ((ercMsg->getOwner().getErcMsgOwnerClassName() ==
-             node.getValueByPath<QString>("class")) &&
-            (ercMsg->getOwnerKey() ==
-             node.getValueByPath<QString>("instance")) &&
-            (ercMsg->getMsgKey() == node.getValueByPath<QString>("message"))) {
-          ercMsg->setIgnored(true);
-        }
-      }
+      approved.insert(getApprovalKey(node.getValueByPath<QString>("class"),
+                                     node.getValueByPath<QString>("instance"),
+                                     node.getValueByPath<QString>("message")));
+    }
+
+    // set ignore attributes
+    foreach (ErcMsg* ercMsg, mItems.keys()) {
+      QString key = getApprovalKey(ercMsg->getOwner().getErcMsgOwnerClassName(),
+                                   ercMsg->getOwnerKey(), ercMsg->getMsgKey());
+      ercMsg->setIgnored(approved.contains(key));
     }
   }
 }
 
 void ErcMsgList::save() {
+  executeScheduledUpdates();
+
   SExpression doc(serializeToDomElement("librepcb_erc"));  // can throw
   mProject.getDirectory().write("circuit/erc.lp",
                                 doc.toByteArray());  // can throw
@@ -111,8 +169,22 @@ void ErcMsgList::save() {
  *  Private Methods
  ******************************************************************************/
 
+QList<ErcMsg*> ErcMsgList::getItemsInInsertionOrder() const noexcept {
+  QList<ErcMsg*> items = mItems.keys();
+  std::sort(items.begin(), items.end(), [this](ErcMsg* a, ErcMsg* b) {
+    return mItems.value(a) < mItems.value(b);
+  });
+  return items;
+}
+
+QString ErcMsgList::getApprovalKey(const QString& ownerClass,
+                                   const QString& ownerKey,
+                                   const QString& msgKey) noexcept {
+  return ownerClass % QChar('\n') % ownerKey % QChar('\n') % msgKey;
+}
+
 void ErcMsgList::serialize(SExpression& root) const {
-  foreach (ErcMsg* ercMsg, mItems) {
+  foreach (ErcMsg* ercMsg, getItemsInInsertionOrder()) {
     if (ercMsg->isIgnored()) {
       SExpression& itemNode = root.appendList("approved", true);
       itemNode.appendChild<QString>(
@@ -37,6 +37,7 @@ namespace project {
 
 class Project;
 class ErcMsg;
+class IF_ErcMsgProvider;
 
 /*******************************************************************************
  *  Class ErcMsgList
@@ -45,6 +46,13 @@ class ErcMsg;
 /**
  * @brief The ErcMsgList class contains a list of ERC messages which are visible
  * for the user
+ *
+ * To avoid recalculating the ERC messages of an object several times when it
+ * is modified many times in a row (e.g. while loading a project or executing
+ * a big undo command), ERC message providers only schedule an update with
+ * #scheduleUpdate(). All scheduled updates are executed once in the next event
+ * loop iteration, or latest when the messages are accessed with #getItems(),
+ * #restoreIgnoreState() or #save().
  */
 class ErcMsgList final : public QObject, public SerializableObject {
   Q_OBJECT
@@ -57,18 +65,24 @@ public:
   ~ErcMsgList() noexcept;
 
   // Getters
-  const QList<ErcMsg*>& getItems() const noexcept { return mItems; }
+  QList<ErcMsg*> getItems() noexcept;
 
   // General Methods
   void add(ErcMsg* ercMsg) noexcept;
   void remove(ErcMsg* ercMsg) noexcept;
   void update(ErcMsg* ercMsg) noexcept;
+  void scheduleUpdate(IF_ErcMsgProvider& provider) noexcept;
+  void cancelScheduledUpdate(IF_ErcMsgProvider& provider) noexcept;
   void restoreIgnoreState();
   void save();
 
   // Operator Overloadings
   ErcMsgList& operator=(const ErcMsgList& rhs) = delete;
 
+public slots:
+
+  void executeScheduledUpdates() noexcept;
+
 signals:
 
   void ercMsgAdded(ErcMsg* ercMsg);
@@ -76,6 +90,11 @@ signals:
   void ercMsgChanged(ErcMsg* ercMsg);
 
 private:  // Methods
+  QList<ErcMsg*> getItemsInInsertionOrder() const noexcept;
+  static QString getApprovalKey(const QString& ownerClass,
+                                const QString& ownerKey,
+                                const QString& msgKey) noexcept;
+
   /// @copydoc librepcb::SerializableObject::serialize()
   void serialize(SExpression& root) const override;
 
@@ -83,7 +102,15 @@ private:  // Methods
   Project& mProject;
 
   // Misc
-  QList<ErcMsg*> mItems;  ///< contains all visible ERC messages
+  QHash<ErcMsg*, quint64>  mItems;  ///< All visible ERC messages, with the
+                                    ///< sequence number of their insertion
+  quint64                  mNextSequenceNumber;
+  QSet<IF_ErcMsgProvider*> mScheduledUpdates;    ///< Providers to update
+  bool                     mUpdateTimerPending;  ///< Next update is queued
+
+  /// #mScheduledUpdates in the order they were scheduled, to get the same
+  /// message order (and thus the same "erc.lp" file) every time
+  QList<IF_ErcMsgProvider*> mScheduledUpdatesQueue;
 };
 
 /*******************************************************************************
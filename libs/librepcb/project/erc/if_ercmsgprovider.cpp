@@ -0,0 +1,59 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "if_ercmsgprovider.h"
+
+#include "../project.h"
+#include "ercmsglist.h"
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace project {
+
+/*******************************************************************************
+ *  Constructors / Destructor
+ ******************************************************************************/
+
+IF_ErcMsgProvider::~IF_ErcMsgProvider() noexcept {
+  if (mErcMsgListOfScheduledUpdate) {
+    mErcMsgListOfScheduledUpdate->cancelScheduledUpdate(*this);
+  }
+}
+
+/*******************************************************************************
+ *  Protected Methods
+ ******************************************************************************/
+
+void IF_ErcMsgProvider::scheduleErcMessagesUpdate(Project& project) noexcept {
+  project.getErcMsgList().scheduleUpdate(*this);
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace project
+}  // namespace librepcb
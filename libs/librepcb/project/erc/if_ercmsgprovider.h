@@ -28,6 +28,8 @@ namespace project {
 
 class ErcMsg;  // all classes which implement IF_ErcMsgProvider will need this
                // declaration
+class ErcMsgList;
+class Project;
 
 /*******************************************************************************
  *  Macros
@@ -56,17 +58,33 @@ private:
 /**
  * @brief The IF_ErcMsgProvider class
  *
+ * Classes which provide ERC messages don't update them immediately when they
+ * are modified, but call #scheduleErcMessagesUpdate() instead. The
+ * ::librepcb::project::ErcMsgList then calls #updateErcMessages() once for
+ * all modifications (see ::librepcb::project::ErcMsgList::scheduleUpdate()).
+ *
  * @author ubruhin
  * @date 2015-02-02
  */
 class IF_ErcMsgProvider {
 public:
   // Constructors / Destructor
-  IF_ErcMsgProvider() {}
-  virtual ~IF_ErcMsgProvider() {}
+  IF_ErcMsgProvider() noexcept : mErcMsgListOfScheduledUpdate(nullptr) {}
+  virtual ~IF_ErcMsgProvider() noexcept;
 
   // Getters
   virtual const char* getErcMsgOwnerClassName() const noexcept = 0;
+
+protected:
+  void scheduleErcMessagesUpdate(Project& project) noexcept;
+
+private:
+  virtual void updateErcMessages() noexcept {}
+
+  /// The list which will update the messages, or nullptr if not scheduled
+  ErcMsgList* mErcMsgListOfScheduledUpdate;
+
+  friend class ErcMsgList;
 };
 
 /*******************************************************************************
@@ -28,11 +28,13 @@
 #include <librepcb/common/exceptions.h>
 #include <librepcb/common/fileio/filepath.h>
 #include <librepcb/common/fileio/transactionalfilesystem.h>
+#include <librepcb/common/toolbox.h>
 #include <librepcb/library/cmp/component.h>
 #include <librepcb/library/dev/device.h>
 #include <librepcb/library/pkg/package.h>
 #include <librepcb/library/sym/symbol.h>
 
+#include <QtConcurrent/QtConcurrent>
 #include <QtCore>
 
 /*******************************************************************************
@@ -145,8 +147,10 @@ void ProjectLibrary::save() {
 template <typename ElementType>
 void ProjectLibrary::loadElements(const QString& dirname, const QString& type,
                                   QHash<Uuid, ElementType*>& elementList) {
-  // search all subdirectories which have a valid UUID as directory name
-  foreach (const QString& sub, mDirectory->getDirs(dirname)) {
+  // search all subdirectories which have a valid UUID as directory name, sorted
+  // to get a deterministic loading order
+  QList<TransactionalDirectory*> dirs;
+  foreach (const QString& sub, Toolbox::sorted(mDirectory->getDirs(dirname))) {
     std::unique_ptr<TransactionalDirectory> dir(
         new TransactionalDirectory(*mDirectory, dirname % "/" % sub));
 
@@ -156,19 +160,62 @@ void ProjectLibrary::loadElements(const QString& dirname, const QString& type,
                  << dir->getAbsPath().toNative();
       continue;
     }
+    dirs.append(dir.release());
+  }
+
+  // load the library elements in parallel since parsing the files and building
+  // the geometry takes some time, especially for large project libraries
+  QThread*                     thread = this->thread();
+  QList<QFuture<ElementType*>> futures;
+  foreach (TransactionalDirectory* dir, dirs) {
+    futures.append(QtConcurrent::run([dir, thread]() {
+      // Note: The directory is owned by the element as soon as it is passed
+      // to the constructor.
+      ElementType* element = new ElementType(
+          std::unique_ptr<TransactionalDirectory>(dir));  // can throw
+      element->moveToThread(thread);
+      return element;
+    }));
+  }
+
+  // wait until all elements are loaded (or failed to load) to be sure no
+  // worker is still running when we leave this method
+  QList<ElementType*>       elements;
+  QScopedPointer<Exception> error;
+  for (int i = 0; i < futures.count(); ++i) {
+    try {
+      elements.append(futures[i].result());  // can throw
+    } catch (const Exception& e) {
+      if (!error) error.reset(e.clone());
+    } catch (...) {
+      // e.g. QUnhandledException if a worker threw a non-Qt exception
+      if (!error) {
+        error.reset(new RuntimeError(
+            __FILE__, __LINE__,
+            QString(tr("Unknown error while loading the %1 of the project "
+                       "library."))
+                .arg(type)));
+      }
+    }
+  }
+  if (error) {
+    qDeleteAll(elements);
+    error->raise();
+  }
 
-    // load the library element
-    QScopedPointer<ElementType> element(
-        new ElementType(std::move(dir)));  // can throw
+  // everything is ok -> update members in deterministic order
+  for (int i = 0; i < elements.count(); ++i) {
+    QScopedPointer<ElementType> element(elements[i]);
     if (elementList.contains(element->getUuid())) {
+      for (int k = i + 1; k < elements.count(); ++k) {
+        delete elements[k];
+      }
       throw RuntimeError(
           __FILE__, __LINE__,
           QString(tr("There are multiple library elements with the same "
                      "UUID in the directory \"%1\""))
-              .arg(dir->getAbsPath().toNative()));
+              .arg(element->getDirectory().getAbsPath().toNative()));
     }
-
-    // everything is ok -> update members
     elementList.insert(element->getUuid(), element.data());
     mElementsToUpgrade.insert(element.data());
     mAllElements.insert(element.take());  // Take object from smart pointer!
@@ -38,6 +38,7 @@
 #include <librepcb/common/fileio/sexpression.h>
 #include <librepcb/common/fileio/versionfile.h>
 #include <librepcb/common/font/strokefontpool.h>
+#include <librepcb/common/profiler.h>
 
 #include <QPrinter>
 #include <QtCore>
@@ -159,6 +160,7 @@ Project::Project(std::unique_ptr<TransactionalDirectory> directory,
 
     // Load all schematics
     if (!create) {
+      LIBREPCB_PROFILE_SCOPE("Load schematics");
       QString     fp = "schematics/schematics.lp";
       SExpression schRoot =
           SExpression::parse(mDirectory->read(fp), mDirectory->getAbsPath(fp));
@@ -175,6 +177,7 @@ Project::Project(std::unique_ptr<TransactionalDirectory> directory,
 
     // Load all boards
     if (!create) {
+      LIBREPCB_PROFILE_SCOPE("Load boards");
       QString     fp = "boards/boards.lp";
       SExpression brdRoot =
           SExpression::parse(mDirectory->read(fp), mDirectory->getAbsPath(fp));
@@ -342,6 +345,8 @@ void Project::removeSchematic(Schematic& schematic, bool deleteSchematic) {
 }
 
 void Project::exportSchematicsAsPdf(const FilePath& filepath) {
+  LIBREPCB_PROFILE_SCOPE("Export schematics PDF");
+
   // Create output directory first because QPrinter silently fails if it doesn't
   // exist.
   FileUtils::makePath(filepath.getParentDir());  // can throw
@@ -499,6 +504,7 @@ void Project::removeBoard(Board& board, bool deleteBoard) {
  ******************************************************************************/
 
 void Project::save() {
+  LIBREPCB_PROFILE_SCOPE("Serialize project");
   qDebug() << "Save project files to transactional file system...";
 
   // Save version file
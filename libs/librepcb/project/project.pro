@@ -56,6 +56,8 @@ SOURCES += \
     boards/cmd/cmdfootprintstroketextadd.cpp \
     boards/cmd/cmdfootprintstroketextremove.cpp \
     boards/cmd/cmdfootprintstroketextsreset.cpp \
+    boards/drc/boarddesignrulecheck.cpp \
+    boards/drc/boarddesignrulecheckmessage.cpp \
     boards/graphicsitems/bgi_airwire.cpp \
     boards/graphicsitems/bgi_base.cpp \
     boards/graphicsitems/bgi_footprint.cpp \
@@ -94,6 +96,7 @@ SOURCES += \
     circuit/netsignal.cpp \
     erc/ercmsg.cpp \
     erc/ercmsglist.cpp \
+    erc/if_ercmsgprovider.cpp \
     library/cmd/cmdprojectlibraryaddelement.cpp \
     library/cmd/cmdprojectlibraryremoveelement.cpp \
     library/projectlibrary.cpp \
@@ -171,6 +174,8 @@ HEADERS += \
     boards/cmd/cmdfootprintstroketextadd.h \
     boards/cmd/cmdfootprintstroketextremove.h \
     boards/cmd/cmdfootprintstroketextsreset.h \
+    boards/drc/boarddesignrulecheck.h \
+    boards/drc/boarddesignrulecheckmessage.h \
     boards/graphicsitems/bgi_airwire.h \
     boards/graphicsitems/bgi_base.h \
     boards/graphicsitems/bgi_footprint.h \
@@ -72,7 +72,7 @@ SI_SymbolPin::SI_SymbolPin(SI_Symbol& symbol, const Uuid& pinUuid)
           .arg(mSymbol.getUuid().toStr())
           .arg(mSymbolPin->getUuid().toStr()),
       "UnconnectedRequiredPin", ErcMsg::ErcMsgType_t::SchematicError));
-  updateErcMessages();
+  scheduleErcMessagesUpdate(getProject());
 }
 
 SI_SymbolPin::~SI_SymbolPin() {
@@ -157,7 +157,7 @@ void SI_SymbolPin::addToSchematic() {
                 [this]() { mGraphicsItem->update(); });
   }
   SI_Base::addToSchematic(mGraphicsItem.data());
-  updateErcMessages();
+  scheduleErcMessagesUpdate(getProject());
   mGraphicsItem->updateCacheAndRepaint();
 }
 
@@ -172,7 +172,7 @@ void SI_SymbolPin::removeFromSchematic() {
     disconnect(mHighlightChangedConnection);
   }
   SI_Base::removeFromSchematic(mGraphicsItem.data());
-  updateErcMessages();
+  scheduleErcMessagesUpdate(getProject());
 }
 
 void SI_SymbolPin::registerNetLine(SI_NetLine& netline) {
@@ -188,7 +188,7 @@ void SI_SymbolPin::registerNetLine(SI_NetLine& netline) {
   }
   mRegisteredNetLines.insert(&netline);
   netline.updateLine();
-  updateErcMessages();
+  scheduleErcMessagesUpdate(getProject());
   mGraphicsItem
       ->updateCacheAndRepaint();  // re-check whether to fill the circle or not
 }
@@ -199,7 +199,7 @@ void SI_SymbolPin::unregisterNetLine(SI_NetLine& netline) {
   }
   mRegisteredNetLines.remove(&netline);
   netline.updateLine();
-  updateErcMessages();
+  scheduleErcMessagesUpdate(getProject());
   mGraphicsItem
       ->updateCacheAndRepaint();  // re-check whether to fill the circle or not
 }
@@ -108,7 +108,7 @@ public:
 
 private slots:
 
-  void updateErcMessages() noexcept;
+  void updateErcMessages() noexcept override;
 
 private:
   void updateGraphicsItemTransform() noexcept;
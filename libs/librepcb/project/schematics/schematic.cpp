@@ -431,6 +431,11 @@ QVector<const AttributeProvider*> Schematic::getAttributeProviderParents() const
  ******************************************************************************/
 
 void Schematic::updateIcon() noexcept {
+  // Pixmaps must only be created in the GUI thread. Schematics loaded in other
+  // threads (e.g. by the CLI) are not shown in the GUI, so just skip it.
+  if (QThread::currentThread() != QCoreApplication::instance()->thread()) {
+    return;
+  }
   mIcon = QIcon(mGraphicsScene->toPixmap(QSize(297, 210), Qt::white));
 }
 
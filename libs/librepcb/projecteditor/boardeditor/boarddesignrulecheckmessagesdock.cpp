@@ -0,0 +1,97 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "boarddesignrulecheckmessagesdock.h"
+
+#include "ui_boarddesignrulecheckmessagesdock.h"
+
+#include <QtCore>
+#include <QtWidgets>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace project {
+namespace editor {
+
+/*******************************************************************************
+ *  Constructors / Destructor
+ ******************************************************************************/
+
+BoardDesignRuleCheckMessagesDock::BoardDesignRuleCheckMessagesDock(
+    QWidget* parent) noexcept
+  : QDockWidget(parent), mUi(new Ui::BoardDesignRuleCheckMessagesDock) {
+  mUi->setupUi(this);
+  connect(mUi->btnRunDrc, &QPushButton::clicked, this,
+          &BoardDesignRuleCheckMessagesDock::runDrcRequested);
+  connect(mUi->lstMessages, &QListWidget::currentRowChanged, this,
+          &BoardDesignRuleCheckMessagesDock::currentRowChanged);
+}
+
+BoardDesignRuleCheckMessagesDock::~BoardDesignRuleCheckMessagesDock() noexcept {
+}
+
+/*******************************************************************************
+ *  Setters
+ ******************************************************************************/
+
+void BoardDesignRuleCheckMessagesDock::setMessages(
+    const QList<BoardDesignRuleCheckMessage>& messages) noexcept {
+  mMessages = messages;
+  mUi->lstMessages->clear();
+  foreach (const BoardDesignRuleCheckMessage& msg, mMessages) {
+    mUi->lstMessages->addItem(msg.getMessage());
+  }
+}
+
+void BoardDesignRuleCheckMessagesDock::setStatus(
+    const QString& status) noexcept {
+  mUi->lblStatus->setText(status);
+}
+
+/*******************************************************************************
+ *  General Methods
+ ******************************************************************************/
+
+void BoardDesignRuleCheckMessagesDock::clear() noexcept {
+  setMessages(QList<BoardDesignRuleCheckMessage>());
+  setStatus(QString());
+}
+
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+void BoardDesignRuleCheckMessagesDock::currentRowChanged(int row) noexcept {
+  if ((row >= 0) && (row < mMessages.count())) {
+    emit messageSelected(mMessages.at(row));
+  }
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace editor
+}  // namespace project
+}  // namespace librepcb
@@ -25,6 +25,7 @@
 #include "../dialogs/projectpropertieseditordialog.h"
 #include "../docks/ercmsgdock.h"
 #include "../projecteditor.h"
+#include "boarddesignrulecheckmessagesdock.h"
 #include "boardlayersdock.h"
 #include "boardlayerstacksetupdialog.h"
 #include "fabricationoutputdialog.h"
@@ -46,6 +47,7 @@
 #include <librepcb/project/boards/cmd/cmdboardadd.h>
 #include <librepcb/project/boards/cmd/cmdboarddesignrulesmodify.h>
 #include <librepcb/project/boards/cmd/cmdboardremove.h>
+#include <librepcb/project/boards/drc/boarddesignrulecheck.h>
 #include <librepcb/project/boards/items/bi_plane.h>
 #include <librepcb/project/circuit/circuit.h>
 #include <librepcb/project/project.h>
@@ -79,6 +81,7 @@ BoardEditor::BoardEditor(ProjectEditor& projectEditor, Project& project)
     mErcMsgDock(nullptr),
     mUnplacedComponentsDock(nullptr),
     mBoardLayersDock(nullptr),
+    mDrcMessagesDock(nullptr),
     mFsm(nullptr) {
   mUi->setupUi(this);
   mUi->lblUnplacedComponentsNote->hide();
@@ -107,6 +110,15 @@ BoardEditor::BoardEditor(ProjectEditor& projectEditor, Project& project)
   mErcMsgDock = new ErcMsgDock(mProject);
   addDockWidget(Qt::RightDockWidgetArea, mErcMsgDock, Qt::Vertical);
   tabifyDockWidget(mBoardLayersDock, mErcMsgDock);
+  mDrcMessagesDock = new BoardDesignRuleCheckMessagesDock(this);
+  connect(mDrcMessagesDock,
+          &BoardDesignRuleCheckMessagesDock::runDrcRequested, this,
+          &BoardEditor::on_actionRunDesignRuleCheck_triggered);
+  connect(mDrcMessagesDock,
+          &BoardDesignRuleCheckMessagesDock::messageSelected, this,
+          &BoardEditor::showDesignRuleCheckMessage);
+  addDockWidget(Qt::RightDockWidgetArea, mDrcMessagesDock, Qt::Vertical);
+  tabifyDockWidget(mErcMsgDock, mDrcMessagesDock);
   mUnplacedComponentsDock->raise();
 
   // add graphics view as central widget
@@ -262,6 +274,8 @@ BoardEditor::~BoardEditor() {
   mBoardLayersDock = nullptr;
   delete mUnplacedComponentsDock;
   mUnplacedComponentsDock = nullptr;
+  delete mDrcMessagesDock;
+  mDrcMessagesDock = nullptr;
   delete mErcMsgDock;
   mErcMsgDock = nullptr;
   delete mGraphicsView;
@@ -303,6 +317,7 @@ void BoardEditor::setActiveBoardIndex(int index) noexcept {
     // update dock widgets
     mUnplacedComponentsDock->setBoard(mActiveBoard);
     mBoardLayersDock->setActiveBoard(mActiveBoard);
+    mDrcMessagesDock->clear();  // messages belong to the previous board
   }
 
   // update GUI
@@ -519,6 +534,32 @@ void BoardEditor::on_actionRebuildPlanes_triggered() {
   }
 }
 
+void BoardEditor::on_actionRunDesignRuleCheck_triggered() {
+  Board* board = getActiveBoard();
+  if (!board) return;
+
+  try {
+    QProgressDialog progress(tr("Run design rule check..."), QString(), 0, 100,
+                             this);
+    progress.setWindowModality(Qt::WindowModal);
+    progress.setMinimumDuration(500);
+    BoardDesignRuleCheck drc(*board, BoardDesignRuleCheck::Options());
+    connect(&drc, &BoardDesignRuleCheck::progressPercent, &progress,
+            &QProgressDialog::setValue);
+    connect(&drc, &BoardDesignRuleCheck::progressStatus, &progress,
+            &QProgressDialog::setLabelText);
+    drc.execute();  // can throw
+    mDrcMessagesDock->setMessages(drc.getMessages());
+    mDrcMessagesDock->setStatus(
+        tr("%n violation(s) found.", "", drc.getMessages().count()));
+  } catch (const Exception& e) {
+    mDrcMessagesDock->clear();
+    QMessageBox::critical(this, tr("Error"), e.getMsg());
+  }
+  mDrcMessagesDock->show();
+  mDrcMessagesDock->raise();
+}
+
 void BoardEditor::on_tabBar_currentChanged(int index) {
   setActiveBoardIndex(index);
 }
@@ -573,6 +614,18 @@ void BoardEditor::toolActionGroupChangeTriggered(
   }
 }
 
+void BoardEditor::showDesignRuleCheckMessage(
+    const BoardDesignRuleCheckMessage& msg) noexcept {
+  QRectF rect;
+  foreach (const Path& location, msg.getLocations()) {
+    rect |= location.toQPainterPathPx().boundingRect();
+  }
+  if (rect.isNull()) return;
+  qreal margin = 1.5 * qMax(rect.width(), rect.height());
+  mGraphicsView->setVisibleSceneRect(
+      rect.adjusted(-margin, -margin, margin, margin));
+}
+
 void BoardEditor::unplacedComponentsCountChanged(int count) noexcept {
   mUi->lblUnplacedComponentsNote->setVisible(count > 0);
 }
@@ -44,11 +44,13 @@ namespace project {
 
 class Project;
 class ComponentInstance;
+class BoardDesignRuleCheckMessage;
 
 namespace editor {
 
 class ProjectEditor;
 class ErcMsgDock;
+class BoardDesignRuleCheckMessagesDock;
 class UnplacedComponentsDock;
 class BoardLayersDock;
 class BES_FSM;
@@ -107,6 +109,7 @@ private slots:
   void on_actionLayerStackSetup_triggered();
   void on_actionModifyDesignRules_triggered();
   void on_actionRebuildPlanes_triggered();
+  void on_actionRunDesignRuleCheck_triggered();
   void on_tabBar_currentChanged(int index);
   void on_lblUnplacedComponentsNote_linkActivated();
   void boardListActionGroupTriggered(QAction* action);
@@ -121,6 +124,8 @@ private:
   bool graphicsViewEventHandler(QEvent* event);
   void toolActionGroupChangeTriggered(const QVariant& newTool) noexcept;
   void unplacedComponentsCountChanged(int count) noexcept;
+  void showDesignRuleCheckMessage(
+      const BoardDesignRuleCheckMessage& msg) noexcept;
 
   // General Attributes
   ProjectEditor&                       mProjectEditor;
@@ -136,9 +141,10 @@ private:
   QActionGroup    mBoardListActionGroup;
 
   // Docks
-  ErcMsgDock*             mErcMsgDock;
-  UnplacedComponentsDock* mUnplacedComponentsDock;
-  BoardLayersDock*        mBoardLayersDock;
+  ErcMsgDock*                       mErcMsgDock;
+  UnplacedComponentsDock*           mUnplacedComponentsDock;
+  BoardLayersDock*                  mBoardLayersDock;
+  BoardDesignRuleCheckMessagesDock* mDrcMessagesDock;
 
   // Finite State Machine
   BES_FSM* mFsm;
@@ -78,6 +78,12 @@ ProjectEditor::ProjectEditor(workspace::Workspace& workspace, Project& project)
     // autosaving is enabled --> start the timer
     connect(&mAutoSaveTimer, &QTimer::timeout, this,
             &ProjectEditor::autosaveProject);
+    connect(project.getDirectory().getFileSystem().get(),
+            &TransactionalFileSystem::autosaveFinished, this, [](bool success) {
+              if (success) {
+                qDebug() << "Project successfully autosaved";
+              }
+            });
     mAutoSaveTimer.start(1000 * intervalSecs);
   }
 }
@@ -218,10 +224,15 @@ bool ProjectEditor::autosaveProject() noexcept {
   }
 
   try {
+    // Serialize the project on this thread since the project objects are
+    // not thread-safe, but write the autosave backup in a worker thread to
+    // not block the editor while accessing the disk.
     qDebug() << "Autosave project...";
-    mProject.save();                                      // can throw
-    mProject.getDirectory().getFileSystem()->autosave();  // can throw
-    qDebug() << "Project successfully autosaved";
+    mProject.save();  // can throw
+    mProject.getDirectory()
+        .getFileSystem()
+        ->autosaveInBackground();  // can throw
+    qDebug() << "Project autosave started";
     return true;
   } catch (Exception& exc) {
     return false;
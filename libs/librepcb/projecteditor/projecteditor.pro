@@ -20,6 +20,7 @@ INCLUDEPATH += \
     ../../type_safe/external/debug_assert \
 
 SOURCES += \
+    boardeditor/boarddesignrulecheckmessagesdock.cpp \
     boardeditor/boardeditor.cpp \
     boardeditor/boardlayersdock.cpp \
     boardeditor/boardlayerstacksetupdialog.cpp \
@@ -81,6 +82,7 @@ SOURCES += \
     schematiceditor/symbolinstancepropertiesdialog.cpp \
 
 HEADERS += \
+    boardeditor/boarddesignrulecheckmessagesdock.h \
     boardeditor/boardeditor.h \
     boardeditor/boardlayersdock.h \
     boardeditor/boardlayerstacksetupdialog.h \
@@ -142,6 +144,7 @@ HEADERS += \
     schematiceditor/symbolinstancepropertiesdialog.h \
 
 FORMS += \
+    boardeditor/boarddesignrulecheckmessagesdock.ui \
     boardeditor/boardeditor.ui \
     boardeditor/boardlayersdock.ui \
     boardeditor/boardlayerstacksetupdialog.ui \
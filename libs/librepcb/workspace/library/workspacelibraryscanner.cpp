@@ -25,6 +25,7 @@
 #include "../workspace.h"
 
 #include <librepcb/common/fileio/transactionalfilesystem.h>
+#include <librepcb/common/profiler.h>
 #include <librepcb/common/sqlitedatabase.h>
 #include <librepcb/library/elements.h>
 
@@ -104,6 +105,7 @@ void WorkspaceLibraryScanner::run() noexcept {
 }
 
 void WorkspaceLibraryScanner::scan() noexcept {
+  LIBREPCB_PROFILE_SCOPE("Scan workspace libraries");
   try {
     QElapsedTimer timer;
     timer.start();
@@ -140,6 +142,7 @@ void WorkspaceLibraryScanner::scan() noexcept {
       int                             libId = libIds[fp];
       const std::shared_ptr<Library>& lib   = libraries[fp];
       Q_ASSERT(lib);
+      LIBREPCB_PROFILE_SCOPE("Scan library");
       if (mAbort || (mSemaphore.available() > 0)) break;
       count += addCategoriesToDb<ComponentCategory>(
           db, fs, fp, lib->searchForElements<ComponentCategory>(),
@@ -22,6 +22,8 @@
  ******************************************************************************/
 #include "wsi_debugtools.h"
 
+#include <librepcb/common/tracer.h>
+
 #include <QtCore>
 #include <QtWidgets>
 
@@ -36,7 +38,9 @@ namespace workspace {
  ******************************************************************************/
 
 WSI_DebugTools::WSI_DebugTools(const SExpression& node) : WSI_Base() {
-  Q_UNUSED(node);
+  if (const SExpression* child = node.tryGetChildByPath("trace_file")) {
+    mTraceFile = child->getValueOfFirstChild<QString>();
+  }
 
   // create a QWidget
   mWidget.reset(new QWidget());
@@ -47,9 +51,20 @@ WSI_DebugTools::WSI_DebugTools(const SExpression& node) : WSI_Base() {
           tr("Warning: Some of these settings may only work in DEBUG mode!")),
       0, 0);
 #endif
+  int row = layout->rowCount();
+  layout->addWidget(new QLabel(tr("Trace events file:")), row, 0);
+  mTraceFileEdit.reset(new QLineEdit(mTraceFile));
+  mTraceFileEdit->setPlaceholderText(tr("Absolute path to a *.json file"));
+  mTraceFileEdit->setToolTip(
+      tr("If set, timing events of time-critical operations are recorded and "
+         "written to this file when the application exits. The file can be "
+         "opened with chrome://tracing or https://ui.perfetto.dev/."));
+  layout->addWidget(mTraceFileEdit.data(), row, 1);
 
   // stretch the last row
   layout->setRowStretch(layout->rowCount(), 1);
+
+  updateTracer();
 }
 
 WSI_DebugTools::~WSI_DebugTools() noexcept {
@@ -60,20 +75,38 @@ WSI_DebugTools::~WSI_DebugTools() noexcept {
  ******************************************************************************/
 
 void WSI_DebugTools::restoreDefault() noexcept {
+  mTraceFileEdit->clear();
 }
 
 void WSI_DebugTools::apply() noexcept {
+  mTraceFile = mTraceFileEdit->text().trimmed();
+  updateTracer();
 }
 
 void WSI_DebugTools::revert() noexcept {
+  mTraceFileEdit->setText(mTraceFile);
 }
 
 /*******************************************************************************
  *  Private Methods
  ******************************************************************************/
 
+void WSI_DebugTools::updateTracer() const noexcept {
+  if (!qgetenv("LIBREPCB_TRACE_FILE").isEmpty()) {
+    return;  // the environment variable has precedence over this setting
+  }
+  FilePath fp(mTraceFile);
+  if (fp.isValid()) {
+    if ((!Tracer::isActive()) || (Tracer::getFilePath() != fp)) {
+      Tracer::start(fp);
+    }
+  } else {
+    Tracer::stop();
+  }
+}
+
 void WSI_DebugTools::serialize(SExpression& root) const {
-  Q_UNUSED(root);
+  root.appendChild("trace_file", mTraceFile, true);
 }
 
 /*******************************************************************************
@@ -49,6 +49,9 @@ public:
   explicit WSI_DebugTools(const SExpression& node);
   ~WSI_DebugTools() noexcept;
 
+  // Getters
+  const QString& getTraceFile() const noexcept { return mTraceFile; }
+
   // Getters: Widgets
   QWidget* getWidget() const noexcept { return mWidget.data(); }
 
@@ -63,9 +66,15 @@ public:
   // Operator Overloadings
   WSI_DebugTools& operator=(const WSI_DebugTools& rhs) = delete;
 
+private:  // Methods
+  void updateTracer() const noexcept;
+
 private:  // Data
+  QString mTraceFile;  ///< Empty if no trace events should be recorded
+
   // Widgets
-  QScopedPointer<QWidget> mWidget;
+  QScopedPointer<QWidget>   mWidget;
+  QScopedPointer<QLineEdit> mTraceFileEdit;
 };
 
 /*******************************************************************************
@@ -0,0 +1,116 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "benchmark.h"
+
+#include <librepcb/common/application.h>
+
+#include <QtCore>
+
+#include <algorithm>
+#include <iostream>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*******************************************************************************
+ *  Static Variables
+ ******************************************************************************/
+
+QList<Benchmark::Result> Benchmark::sResults;
+
+/*******************************************************************************
+ *  Static Methods
+ ******************************************************************************/
+
+QByteArray Benchmark::resultsToJson() noexcept {
+  QJsonArray results;
+  foreach (const Result& result, sResults) {
+    QJsonObject obj;
+    obj["name"]       = result.name;
+    obj["iterations"] = result.iterations;
+    obj["items"]      = result.items;
+    obj["min_ns"]     = static_cast<double>(result.minNs);
+    obj["median_ns"]  = static_cast<double>(result.medianNs);
+    obj["mean_ns"]    = static_cast<double>(result.meanNs);
+    obj["max_ns"]     = static_cast<double>(result.maxNs);
+    obj["items_per_second"] =
+        (result.medianNs > 0) ? (result.items * 1e9 / result.medianNs) : 0.0;
+    results.append(obj);
+  }
+  QJsonObject root;
+  root["version"]      = qApp->applicationVersion();
+  root["git_revision"] = qApp->getGitRevision();
+  root["qt_version"]   = QString(qVersion());
+  root["date"] = QDateTime::currentDateTimeUtc().toString(Qt::ISODate);
+  root["results"] = results;
+  return QJsonDocument(root).toJson(QJsonDocument::Indented);
+}
+
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+void Benchmark::addResult(const QString& name, int items,
+                          QVector<qint64> samples) noexcept {
+  const ::testing::TestInfo* info =
+      ::testing::UnitTest::GetInstance()->current_test_info();
+  Result result;
+  result.name = QString("%1.%2/%3")
+                    .arg(info ? info->test_case_name() : "")
+                    .arg(info ? info->name() : "")
+                    .arg(name);
+  result.iterations = samples.count();
+  result.items      = items;
+  result.minNs      = 0;
+  result.medianNs   = 0;
+  result.meanNs     = 0;
+  result.maxNs      = 0;
+  if (!samples.isEmpty()) {
+    std::sort(samples.begin(), samples.end());
+    qint64 sum = 0;
+    foreach (qint64 sample, samples) { sum += sample; }
+    result.minNs    = samples.first();
+    result.medianNs = samples.at(samples.count() / 2);
+    result.meanNs   = sum / samples.count();
+    result.maxNs    = samples.last();
+  }
+  sResults.append(result);
+
+  std::cout << "[ BENCH    ] " << qPrintable(result.name) << ": median "
+            << qPrintable(QString::number(result.medianNs / 1e6, 'f', 3))
+            << " ms, min "
+            << qPrintable(QString::number(result.minNs / 1e6, 'f', 3))
+            << " ms, max "
+            << qPrintable(QString::number(result.maxNs / 1e6, 'f', 3))
+            << " ms (" << result.iterations << " iterations)" << std::endl;
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace librepcb
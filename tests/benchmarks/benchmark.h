@@ -0,0 +1,107 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_TESTS_BENCHMARK_H
+#define LIBREPCB_TESTS_BENCHMARK_H
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <gtest/gtest.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace / Forward Declarations
+ ******************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*******************************************************************************
+ *  Class Benchmark
+ ******************************************************************************/
+
+/**
+ * @brief Base class for all benchmarks
+ *
+ * Benchmarks are Google Test test cases which use #measure() to execute a
+ * piece of code repeatedly. The measured durations are printed to stdout and
+ * collected, so the benchmark runner is able to write them to a JSON file
+ * (see main.cpp).
+ */
+class Benchmark : public ::testing::Test {
+public:
+  // Types
+  struct Result {
+    QString name;        ///< "<test case>.<test>/<measurement>"
+    int     iterations;  ///< Number of measured iterations
+    int     items;       ///< Number of processed items per iteration
+    qint64  minNs;       ///< Fastest iteration [ns]
+    qint64  medianNs;    ///< Median of all iterations [ns]
+    qint64  meanNs;      ///< Mean of all iterations [ns]
+    qint64  maxNs;       ///< Slowest iteration [ns]
+  };
+
+  // Static Methods
+  static QList<Result> getResults() noexcept { return sResults; }
+  static QByteArray    resultsToJson() noexcept;
+
+protected:
+  /**
+   * @brief Measure the execution time of a function
+   *
+   * The function is executed once without measuring (to warm up caches), then
+   * the given number of iterations are measured.
+   *
+   * @param name        Name of the measurement (unique within a test).
+   * @param iterations  Number of measured iterations.
+   * @param items       Number of items the function processes (e.g. parsed
+   *                    elements). Used to calculate the throughput.
+   * @param func        The function to measure.
+   */
+  template <typename F>
+  void measure(const QString& name, int iterations, int items, F func) {
+    func();  // warm up
+    QVector<qint64> samples;
+    samples.reserve(iterations);
+    for (int i = 0; i < iterations; ++i) {
+      QElapsedTimer timer;
+      timer.start();
+      func();
+      samples.append(timer.nsecsElapsed());
+    }
+    addResult(name, items, samples);
+  }
+
+private:  // Methods
+  static void addResult(const QString& name, int items,
+                        QVector<qint64> samples) noexcept;
+
+private:  // Data
+  static QList<Result> sResults;
+};
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace librepcb
+
+#endif  // LIBREPCB_TESTS_BENCHMARK_H
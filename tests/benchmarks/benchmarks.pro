@@ -0,0 +1,81 @@
+#-------------------------------------------------
+#
+# Project created 2026-10-19
+#
+#-------------------------------------------------
+
+TEMPLATE = app
+TARGET = librepcb-benchmarks
+
+# Use common project definitions
+include(../../common.pri)
+
+# Set preprocessor defines
+DEFINES += TEST_DATA_DIR=\\\"$${PWD}/../data\\\"
+
+QT += core widgets network printsupport xml opengl sql concurrent
+
+CONFIG += console
+CONFIG -= app_bundle
+
+LIBS += \
+    -L$${DESTDIR} \
+    -lgoogletest \
+    -llibrepcbeagleimport \
+    -llibrepcbworkspace \
+    -llibrepcbproject \
+    -llibrepcblibrary \    # Note: The order of the libraries is very important for the linker!
+    -llibrepcbcommon \     # Another order could end up in "undefined reference" errors!
+    -lsexpresso \
+    -lclipper \
+    -lparseagle -lquazip -lz
+
+INCLUDEPATH += \
+    ../../libs \
+    ../../libs/googletest/googletest/include \
+    ../../libs/googletest/googlemock/include \
+    ../../libs/parseagle \
+    ../../libs/quazip \
+    ../../libs/type_safe/include \
+    ../../libs/type_safe/external/debug_assert \
+
+DEPENDPATH += \
+    ../../libs/librepcb/eagleimport \
+    ../../libs/librepcb/workspace \
+    ../../libs/librepcb/project \
+    ../../libs/librepcb/library \
+    ../../libs/librepcb/common \
+    ../../libs/parseagle \
+    ../../libs/quazip \
+    ../../libs/sexpresso \
+    ../../libs/clipper \
+
+PRE_TARGETDEPS += \
+    $${DESTDIR}/libgoogletest.a \
+    $${DESTDIR}/liblibrepcbeagleimport.a \
+    $${DESTDIR}/liblibrepcbworkspace.a \
+    $${DESTDIR}/liblibrepcbproject.a \
+    $${DESTDIR}/liblibrepcblibrary.a \
+    $${DESTDIR}/liblibrepcbcommon.a \
+    $${DESTDIR}/libquazip.a \
+    $${DESTDIR}/libsexpresso.a \
+    $${DESTDIR}/libclipper.a \
+
+SOURCES += \
+    benchmark.cpp \
+    common/cam/excellongeneratorbenchmark.cpp \
+    common/cam/gerbergeneratorbenchmark.cpp \
+    common/fileio/serializableobjectlistbenchmark.cpp \
+    common/fileio/sexpressionbenchmark.cpp \
+    common/geometry/pathbenchmark.cpp \
+    common/utils/clipperhelpersbenchmark.cpp \
+    library/libraryscanbenchmark.cpp \
+    main.cpp \
+    project/boards/boardairwiresbuilderbenchmark.cpp \
+    project/boards/boarddesignrulecheckbenchmark.cpp \
+    project/boards/boardplanefragmentsbuilderbenchmark.cpp \
+    project/projectbenchmark.cpp \
+
+HEADERS += \
+    benchmark.h \
+
@@ -0,0 +1,79 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "../../benchmark.h"
+
+#include <librepcb/common/cam/excellongenerator.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+/**
+ * @brief Measures the generation of a drill file with many vias and holes
+ */
+class ExcellonGeneratorBenchmark : public Benchmark {
+protected:
+  static void drill(ExcellonGenerator& gen) noexcept {
+    for (int i = 0; i < 20000; ++i) {
+      gen.drill(Point(Length((i % 200) * 500000), Length((i / 200) * 500000)),
+                PositiveLength(300000 + (i % 10) * 100000));
+    }
+  }
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(ExcellonGeneratorBenchmark, testDrillAndGenerate) {
+  measure("drillAndGenerate", 10, 20000, []() {
+    ExcellonGenerator gen;
+    drill(gen);
+    gen.generate();
+    EXPECT_FALSE(gen.toStr().isEmpty());
+  });
+}
+
+TEST_F(ExcellonGeneratorBenchmark, testGenerate) {
+  ExcellonGenerator gen;
+  drill(gen);
+  measure("generate", 10, 20000, [&gen]() {
+    gen.generate();
+    EXPECT_FALSE(gen.toStr().isEmpty());
+  });
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace librepcb
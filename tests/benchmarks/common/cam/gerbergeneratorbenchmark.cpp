@@ -0,0 +1,91 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "../../benchmark.h"
+
+#include <librepcb/common/cam/gerbergenerator.h>
+#include <librepcb/common/geometry/path.h>
+#include <librepcb/common/uuid.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+/**
+ * @brief Measures the generation of a copper layer with many pads and traces
+ */
+class GerberGeneratorBenchmark : public Benchmark {
+protected:
+  static void plot(GerberGenerator& gen) noexcept {
+    for (int i = 0; i < 10000; ++i) {
+      Point pos(Length((i % 100) * 1000000), Length((i / 100) * 1000000));
+      gen.flashCircle(pos, UnsignedLength(600000 + (i % 5) * 100000),
+                      UnsignedLength(0));
+      gen.flashRect(pos + Point(Length(500000), Length(0)),
+                    UnsignedLength(400000), UnsignedLength(300000),
+                    Angle::deg90(), UnsignedLength(0));
+      gen.drawLine(pos, pos + Point(Length(1000000), Length(1000000)),
+                   UnsignedLength(200000 + (i % 3) * 50000));
+    }
+    for (int i = 0; i < 100; ++i) {
+      gen.drawPathArea(Path::obround(PositiveLength(2000000 + i * 1000),
+                                     PositiveLength(1000000)));
+    }
+  }
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(GerberGeneratorBenchmark, testPlotAndGenerate) {
+  measure("plotAndGenerate", 10, 20100, []() {
+    GerberGenerator gen("Benchmark", Uuid::createRandom(), "v1");
+    plot(gen);
+    gen.generate();
+    EXPECT_FALSE(gen.toStr().isEmpty());
+  });
+}
+
+TEST_F(GerberGeneratorBenchmark, testGenerate) {
+  GerberGenerator gen("Benchmark", Uuid::createRandom(), "v1");
+  plot(gen);
+  measure("generate", 10, 20100, [&gen]() {
+    gen.generate();
+    EXPECT_FALSE(gen.toStr().isEmpty());
+  });
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace librepcb
@@ -0,0 +1,99 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "../../benchmark.h"
+
+#include <librepcb/library/pkg/footprintpad.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace tests {
+
+using namespace library;
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+/**
+ * @brief Measures lookups in the pad list of a BGA package with 2500 pads
+ */
+class SerializableObjectListBenchmark : public Benchmark {
+protected:
+  SerializableObjectListBenchmark() {
+    for (int x = 0; x < 50; ++x) {
+      for (int y = 0; y < 50; ++y) {
+        mUuids.append(Uuid::createRandom());
+        mPads.append(std::make_shared<FootprintPad>(
+            mUuids.last(), Point(Length(x * 800000), Length(y * 800000)),
+            Angle::deg0(), FootprintPad::Shape::ROUND, PositiveLength(400000),
+            PositiveLength(400000), UnsignedLength(0),
+            FootprintPad::BoardSide::TOP));
+      }
+    }
+  }
+
+  QList<Uuid>      mUuids;
+  FootprintPadList mPads;
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(SerializableObjectListBenchmark, testFindByUuid) {
+  measure("find", 20, mUuids.count(), [this]() {
+    foreach (const Uuid& uuid, mUuids) {
+      ASSERT_NE(nullptr, mPads.find(uuid));
+    }
+  });
+}
+
+TEST_F(SerializableObjectListBenchmark, testIndexOfPointer) {
+  measure("indexOf", 20, mPads.count(), [this]() {
+    for (int i = 0; i < mPads.count(); ++i) {
+      ASSERT_EQ(i, mPads.indexOf(mPads.at(i).get()));
+    }
+  });
+}
+
+TEST_F(SerializableObjectListBenchmark, testFindAfterModification) {
+  // removing and re-inserting invalidates (parts of) the lookup indices
+  measure("removeInsertFind", 20, mUuids.count(), [this]() {
+    std::shared_ptr<FootprintPad> pad = mPads.take(0);
+    mPads.insert(mPads.count(), pad);
+    foreach (const Uuid& uuid, mUuids) {
+      ASSERT_NE(nullptr, mPads.find(uuid));
+    }
+  });
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace librepcb
@@ -0,0 +1,96 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "../../benchmark.h"
+
+#include <librepcb/common/fileio/sexpression.h>
+#include <librepcb/library/pkg/footprint.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace tests {
+
+using namespace library;
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+/**
+ * @brief Parses and serializes a footprint of a BGA package with 2500 pads
+ */
+class SExpressionBenchmark : public Benchmark {
+protected:
+  SExpressionBenchmark() {
+    Footprint footprint(Uuid::createRandom(), ElementName("default"), "");
+    for (int x = 0; x < 50; ++x) {
+      for (int y = 0; y < 50; ++y) {
+        footprint.getPads().append(std::make_shared<FootprintPad>(
+            Uuid::createRandom(), Point(Length(x * 800000), Length(y * 800000)),
+            Angle::deg0(), FootprintPad::Shape::ROUND, PositiveLength(400000),
+            PositiveLength(400000), UnsignedLength(0),
+            FootprintPad::BoardSide::TOP));
+      }
+    }
+    mContent = footprint.serializeToDomElement("footprint").toByteArray();
+  }
+
+  QByteArray mContent;
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(SExpressionBenchmark, testParse) {
+  measure("parse", 20, 2500, [this]() {
+    SExpression root = SExpression::parse(mContent, FilePath());
+    EXPECT_EQ(2500, root.getChildren("pad").count());
+  });
+}
+
+TEST_F(SExpressionBenchmark, testSerialize) {
+  SExpression root = SExpression::parse(mContent, FilePath());
+  measure("serialize", 20, 2500, [&root]() {
+    QByteArray content = root.toByteArray();
+    EXPECT_FALSE(content.isEmpty());
+  });
+}
+
+TEST_F(SExpressionBenchmark, testLoadFootprint) {
+  SExpression root = SExpression::parse(mContent, FilePath());
+  measure("load", 20, 2500, [&root]() {
+    Footprint footprint(root);
+    EXPECT_EQ(2500, footprint.getPads().count());
+  });
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace librepcb
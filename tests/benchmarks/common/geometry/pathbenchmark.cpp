@@ -0,0 +1,114 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "../../benchmark.h"
+
+#include <librepcb/common/geometry/path.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class PathBenchmark : public Benchmark {
+protected:
+  PathBenchmark() {
+    // a polygon with many straight and curved segments, like a plane outline
+    for (int i = 0; i < 10000; ++i) {
+      Point pos = Point(Length(10000000), Length(0))
+                      .rotated(Angle::fromDeg(360.0 * i / 10000));
+      mPath.addVertex(pos, (i % 2) ? Angle::deg45() : Angle::deg0());
+    }
+    mPath.close();
+  }
+
+  Path mPath;
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(PathBenchmark, testPointRotate) {
+  Point center(Length(1000000), Length(2000000));
+  measure("rotate", 20, 100000, [&center]() {
+    Point p(Length(5000000), Length(3000000));
+    for (int i = 0; i < 100000; ++i) {
+      p.rotate(Angle::fromDeg(1.234), center);
+    }
+    EXPECT_NE(Point(), p);
+  });
+}
+
+TEST_F(PathBenchmark, testPathTranslate) {
+  int count = mPath.getVertices().count();
+  measure("translate", 50, count, [this]() {
+    mPath.translate(Point(Length(100), Length(-100)));
+  });
+}
+
+TEST_F(PathBenchmark, testPathRotate) {
+  int count = mPath.getVertices().count();
+  measure("rotate", 50, count, [this]() {
+    mPath.rotate(Angle::fromDeg(12.345), Point(Length(100), Length(200)));
+  });
+}
+
+TEST_F(PathBenchmark, testPathMirror) {
+  int count = mPath.getVertices().count();
+  measure("mirror", 50, count, [this]() {
+    mPath.mirror(Qt::Horizontal, Point(Length(100), Length(200)));
+  });
+}
+
+TEST_F(PathBenchmark, testFlatArc) {
+  measure("flatArc", 50, 1000, []() {
+    for (int i = 0; i < 1000; ++i) {
+      Path arc = Path::flatArc(Point(Length(0), Length(0)),
+                               Point(Length(10000000), Length(0)),
+                               Angle::deg180(), PositiveLength(5000));
+      EXPECT_GT(arc.getVertices().count(), 2);
+    }
+  });
+}
+
+TEST_F(PathBenchmark, testToQPainterPath) {
+  int count = mPath.getVertices().count();
+  measure("toQPainterPathPx", 50, count, [this]() {
+    mPath.getVertices();  // invalidates the cached painter path
+    EXPECT_FALSE(mPath.toQPainterPathPx().isEmpty());
+  });
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace librepcb
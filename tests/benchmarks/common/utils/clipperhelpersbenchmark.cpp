@@ -0,0 +1,139 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "../../benchmark.h"
+
+#include <librepcb/common/utils/clipperhelpers.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+/**
+ * @brief Measures the conversions needed for plane calculations
+ *
+ * The input is a rectangular area with 40x40 round holes, similar to a plane
+ * on a board with many vias.
+ */
+class ClipperHelpersBenchmark : public Benchmark {
+protected:
+  ClipperHelpersBenchmark() : mTolerance(5000) {
+    mOutline = Path::rect(Point(Length(0), Length(0)),
+                          Point(Length(82000000), Length(82000000)));
+    for (int x = 0; x < 40; ++x) {
+      for (int y = 0; y < 40; ++y) {
+        mHoles.append(Path::circle(PositiveLength(800000))
+                          .translate(Point(Length(1500000 + x * 2000000),
+                                           Length(1500000 + y * 2000000))));
+      }
+    }
+  }
+
+  PositiveLength mTolerance;
+  Path           mOutline;
+  QVector<Path>  mHoles;
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(ClipperHelpersBenchmark, testConvertToClipper) {
+  measure("convert", 20, mHoles.count(), [this]() {
+    ClipperLib::Paths paths = ClipperHelpers::convert(mHoles, mTolerance);
+    EXPECT_EQ(static_cast<std::size_t>(mHoles.count()), paths.size());
+  });
+}
+
+TEST_F(ClipperHelpersBenchmark, testConvertFromClipper) {
+  ClipperLib::Paths paths = ClipperHelpers::convert(mHoles, mTolerance);
+  measure("convert", 20, mHoles.count(), [&paths]() {
+    QVector<Path> result = ClipperHelpers::convert(paths);
+    EXPECT_EQ(static_cast<int>(paths.size()), result.count());
+  });
+}
+
+TEST_F(ClipperHelpersBenchmark, testOffset) {
+  ClipperLib::Paths input = ClipperHelpers::convert(mHoles, mTolerance);
+  measure("offset", 20, mHoles.count(), [this, &input]() {
+    ClipperLib::Paths paths = input;
+    ClipperHelpers::offset(paths, Length(200000), mTolerance);
+    EXPECT_EQ(input.size(), paths.size());
+  });
+}
+
+TEST_F(ClipperHelpersBenchmark, testFlattenTree) {
+  ClipperLib::PolyTree tree;
+  ClipperLib::Clipper  c;
+  c.AddPath(ClipperHelpers::convert(mOutline, mTolerance),
+            ClipperLib::ptSubject, true);
+  c.AddPaths(ClipperHelpers::convert(mHoles, mTolerance), ClipperLib::ptClip,
+             true);
+  c.Execute(ClipperLib::ctDifference, tree, ClipperLib::pftEvenOdd,
+            ClipperLib::pftEvenOdd);
+  measure("flattenTree", 10, mHoles.count(), [&tree]() {
+    ClipperLib::Paths paths = ClipperHelpers::flattenTree(tree);
+    EXPECT_EQ(1U, paths.size());
+  });
+}
+
+TEST_F(ClipperHelpersBenchmark, testFlattenTreeWith10kHoles) {
+  // like a large GND plane with many anti-pads of vias and pads
+  ClipperLib::Path outline = ClipperHelpers::convert(
+      Path::rect(Point(Length(0), Length(0)),
+                 Point(Length(200000000), Length(200000000))),
+      mTolerance);
+  ClipperLib::Paths holes;
+  for (int x = 0; x < 100; ++x) {
+    for (int y = 0; y < 100; ++y) {
+      Path hole = Path::circle(PositiveLength(800000))
+                      .translate(Point(Length(1000000 + x * 1980000),
+                                       Length(1000000 + y * 1990000)));
+      holes.push_back(ClipperHelpers::convert(hole, mTolerance));
+    }
+  }
+  ClipperLib::PolyTree tree;
+  ClipperLib::Clipper  c;
+  c.AddPath(outline, ClipperLib::ptSubject, true);
+  c.AddPaths(holes, ClipperLib::ptClip, true);
+  c.Execute(ClipperLib::ctDifference, tree, ClipperLib::pftEvenOdd,
+            ClipperLib::pftEvenOdd);
+  measure("flattenTree", 5, static_cast<int>(holes.size()), [&tree]() {
+    ClipperLib::Paths paths = ClipperHelpers::flattenTree(tree);
+    EXPECT_EQ(1U, paths.size());
+  });
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace librepcb
@@ -0,0 +1,107 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "../benchmark.h"
+
+#include <librepcb/common/fileio/transactionalfilesystem.h>
+#include <librepcb/library/library.h>
+#include <librepcb/library/sym/symbol.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace tests {
+
+using namespace library;
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+/**
+ * @brief Measures searching and loading all elements of a library
+ *
+ * This is what the workspace library scanner does for every library, but
+ * without the database overhead. A synthetic library with 500 symbols is used.
+ */
+class LibraryScanBenchmark : public Benchmark {
+protected:
+  LibraryScanBenchmark() : mTempDir(FilePath::getRandomTempPath()) {
+    std::shared_ptr<TransactionalFileSystem> fs =
+        TransactionalFileSystem::openRW(mTempDir);
+    TransactionalDirectory root(fs);
+    Library lib(Uuid::createRandom(), Version::fromString("0.1"), "LibrePCB",
+                ElementName("Benchmark"), "", "");
+    lib.moveTo(root);
+    TransactionalDirectory symDir(root, "sym");
+    for (int i = 0; i < 500; ++i) {
+      Symbol sym(Uuid::createRandom(), Version::fromString("0.1"), "LibrePCB",
+                 ElementName(QString("Symbol %1").arg(i)), "", "");
+      sym.moveIntoParentDirectory(symDir);
+    }
+    fs->save();
+  }
+
+  virtual ~LibraryScanBenchmark() {
+    QDir(mTempDir.toStr()).removeRecursively();
+  }
+
+  FilePath mTempDir;
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(LibraryScanBenchmark, testSearchForElements) {
+  std::shared_ptr<TransactionalFileSystem> fs =
+      TransactionalFileSystem::openRO(mTempDir);
+  Library lib(std::unique_ptr<TransactionalDirectory>(
+      new TransactionalDirectory(fs)));
+  measure("searchForElements", 20, 500, [&lib]() {
+    EXPECT_EQ(500, lib.searchForElements<Symbol>().count());
+  });
+}
+
+TEST_F(LibraryScanBenchmark, testScan) {
+  measure("scan", 5, 500, [this]() {
+    std::shared_ptr<TransactionalFileSystem> fs =
+        TransactionalFileSystem::openRO(mTempDir);
+    Library lib(std::unique_ptr<TransactionalDirectory>(
+        new TransactionalDirectory(fs)));
+    foreach (const QString& dir, lib.searchForElements<Symbol>()) {
+      Symbol sym(std::unique_ptr<TransactionalDirectory>(
+          new TransactionalDirectory(fs, dir)));
+      EXPECT_FALSE(sym.getNames().getDefaultValue()->isEmpty());
+    }
+  });
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace librepcb
@@ -0,0 +1,88 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "benchmark.h"
+
+#include <gtest/gtest.h>
+#include <librepcb/common/application.h>
+#include <librepcb/common/debug.h>
+#include <librepcb/common/exceptions.h>
+#include <librepcb/common/fileio/fileutils.h>
+
+#include <QtCore>
+
+#include <iostream>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+using namespace librepcb;
+
+/*******************************************************************************
+ *  The Benchmark Program
+ ******************************************************************************/
+
+int main(int argc, char* argv[]) {
+  // extract our own arguments before passing the rest to Qt and gtest
+  const QString outputArg = "--benchmark-output=";
+  QString       outputFile;
+  for (int i = 1; i < argc; ++i) {
+    QString arg = QString::fromLocal8Bit(argv[i]);
+    if (arg.startsWith(outputArg)) {
+      outputFile = arg.mid(outputArg.length());
+      for (int k = i; k < argc - 1; ++k) {
+        argv[k] = argv[k + 1];
+      }
+      --argc;
+      --i;
+    }
+  }
+
+  // many classes rely on a QApplication instance, so we create it here
+  Application app(argc, argv);
+  Application::setOrganizationName("LibrePCB");
+  Application::setOrganizationDomain("librepcb.org");
+  Application::setApplicationName("LibrePCB-Benchmarks");
+
+  // disable the whole debug output (we want only the output from gtest)
+  Debug::instance()->setDebugLevelLogFile(Debug::DebugLevel_t::Nothing);
+  Debug::instance()->setDebugLevelStderr(Debug::DebugLevel_t::Nothing);
+
+  // init gtest and run all benchmarks
+  ::testing::InitGoogleTest(&argc, argv);
+  int result = RUN_ALL_TESTS();
+
+  // write results to file
+  if (!outputFile.isEmpty()) {
+    try {
+      FilePath fp(QFileInfo(outputFile).absoluteFilePath());
+      FileUtils::writeFile(fp, tests::Benchmark::resultsToJson());  // can throw
+      std::cout << "Benchmark results written to "
+                << qPrintable(fp.toNative()) << std::endl;
+    } catch (const Exception& e) {
+      std::cerr << "Failed to write benchmark results: "
+                << qPrintable(e.getMsg()) << std::endl;
+      result = 1;
+    }
+  }
+  return result;
+}
@@ -0,0 +1,90 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "../../benchmark.h"
+
+#include <librepcb/common/fileio/transactionalfilesystem.h>
+#include <librepcb/project/boards/board.h>
+#include <librepcb/project/boards/boardairwiresbuilder.h>
+#include <librepcb/project/circuit/circuit.h>
+#include <librepcb/project/circuit/netsignal.h>
+#include <librepcb/project/project.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace tests {
+
+using namespace project;
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+/**
+ * @brief Measures the calculation of air wires of all nets of a board
+ */
+class BoardAirWiresBuilderBenchmark : public Benchmark {
+protected:
+  BoardAirWiresBuilderBenchmark() {
+    FilePath projectFp(TEST_DATA_DIR
+                       "/unittests/librepcbproject/"
+                       "BoardPlaneFragmentsBuilderTest/test_project/"
+                       "test_project.lpp");
+    std::shared_ptr<TransactionalFileSystem> projectFs =
+        TransactionalFileSystem::openRO(projectFp.getParentDir());
+    mProject.reset(new Project(std::unique_ptr<TransactionalDirectory>(
+                                   new TransactionalDirectory(projectFs)),
+                               projectFp.getFilename()));
+  }
+
+  QScopedPointer<Project> mProject;
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(BoardAirWiresBuilderBenchmark, testBuildAirWires) {
+  const Board*            board = mProject->getBoards().first();
+  QList<const NetSignal*> netSignals;
+  foreach (const NetSignal* netsignal,
+           mProject->getCircuit().getNetSignals()) {
+    netSignals.append(netsignal);
+  }
+  measure("buildAirWires", 20, netSignals.count(), [board, &netSignals]() {
+    foreach (const NetSignal* netsignal, netSignals) {
+      BoardAirWiresBuilder builder(*board, *netsignal);
+      builder.buildAirWires();
+    }
+  });
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace librepcb
@@ -0,0 +1,92 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "../../benchmark.h"
+
+#include <librepcb/common/fileio/transactionalfilesystem.h>
+#include <librepcb/project/boards/board.h>
+#include <librepcb/project/boards/boardplanefragmentsbuilder.h>
+#include <librepcb/project/boards/items/bi_plane.h>
+#include <librepcb/project/project.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace tests {
+
+using namespace project;
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+/**
+ * @brief Measures the calculation of plane fragments
+ *
+ * Uses the same project as the BoardPlaneFragmentsBuilderTest unit test.
+ */
+class BoardPlaneFragmentsBuilderBenchmark : public Benchmark {
+protected:
+  BoardPlaneFragmentsBuilderBenchmark() {
+    FilePath projectFp(TEST_DATA_DIR
+                       "/unittests/librepcbproject/"
+                       "BoardPlaneFragmentsBuilderTest/test_project/"
+                       "test_project.lpp");
+    std::shared_ptr<TransactionalFileSystem> projectFs =
+        TransactionalFileSystem::openRO(projectFp.getParentDir());
+    mProject.reset(new Project(std::unique_ptr<TransactionalDirectory>(
+                                   new TransactionalDirectory(projectFs)),
+                               projectFp.getFilename()));
+  }
+
+  QScopedPointer<Project> mProject;
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(BoardPlaneFragmentsBuilderBenchmark, testBuildFragments) {
+  Board* board = mProject->getBoards().first();
+  measure("buildFragments", 10, board->getPlanes().count(), [board]() {
+    foreach (BI_Plane* plane, board->getPlanes()) {
+      BoardPlaneFragmentsBuilder builder(*plane);
+      builder.buildFragments();
+    }
+  });
+}
+
+TEST_F(BoardPlaneFragmentsBuilderBenchmark, testRebuildAllPlanes) {
+  Board* board = mProject->getBoards().first();
+  measure("rebuildAllPlanes", 10, board->getPlanes().count(),
+          [board]() { board->rebuildAllPlanes(); });
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace librepcb
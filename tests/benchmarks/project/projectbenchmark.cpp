@@ -0,0 +1,131 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "../benchmark.h"
+
+#include <librepcb/common/fileio/fileutils.h>
+#include <librepcb/common/fileio/transactionalfilesystem.h>
+#include <librepcb/common/gridproperties.h>
+#include <librepcb/project/boards/board.h>
+#include <librepcb/project/project.h>
+#include <librepcb/project/schematics/schematic.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace tests {
+
+using namespace project;
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+/**
+ * @brief Measures opening and saving a project
+ */
+class ProjectBenchmark : public Benchmark {
+protected:
+  ProjectBenchmark()
+    : mProjectFp(TEST_DATA_DIR
+                 "/unittests/librepcbproject/BoardPlaneFragmentsBuilderTest/"
+                 "test_project/test_project.lpp") {
+    mTempDir = FilePath::getRandomTempPath();
+  }
+
+  virtual ~ProjectBenchmark() {
+    QDir(mTempDir.toStr()).removeRecursively();
+  }
+
+  std::unique_ptr<Project> openProject(
+      const std::shared_ptr<TransactionalFileSystem>& fs) const {
+    return std::unique_ptr<Project>(
+        new Project(std::unique_ptr<TransactionalDirectory>(
+                        new TransactionalDirectory(fs)),
+                    mProjectFp.getFilename()));  // can throw
+  }
+
+  static GridProperties changeGridInterval(GridProperties grid) {
+    grid.setInterval(PositiveLength(*grid.getInterval() + 1));
+    return grid;
+  }
+
+  FilePath mProjectFp;
+  FilePath mTempDir;
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(ProjectBenchmark, testOpen) {
+  measure("open", 10, 1, [this]() {
+    std::unique_ptr<Project> project =
+        openProject(TransactionalFileSystem::openRO(mProjectFp.getParentDir()));
+    EXPECT_FALSE(project->getBoards().isEmpty());
+  });
+}
+
+TEST_F(ProjectBenchmark, testSerialize) {
+  std::shared_ptr<TransactionalFileSystem> fs =
+      TransactionalFileSystem::openRO(mProjectFp.getParentDir());
+  std::unique_ptr<Project> project = openProject(fs);
+  measure("serialize", 10, 1, [&project]() { project->save(); });
+}
+
+TEST_F(ProjectBenchmark, testSaveToDisk) {
+  FilePath dir = mTempDir.getPathTo("project");
+  FileUtils::copyDirRecursively(mProjectFp.getParentDir(), dir);
+  std::shared_ptr<TransactionalFileSystem> fs =
+      TransactionalFileSystem::openRW(dir);
+  std::unique_ptr<Project> project = openProject(fs);
+  measure("save", 10, 1, [&project, &fs]() {
+    // Modify all boards and schematics, otherwise nothing would be written
+    // since unmodified files are skipped when saving.
+    foreach (Board* board, project->getBoards()) {
+      board->setGridProperties(changeGridInterval(board->getGridProperties()));
+    }
+    foreach (Schematic* schematic, project->getSchematics()) {
+      schematic->setGridProperties(
+          changeGridInterval(schematic->getGridProperties()));
+    }
+    project->save();
+    fs->save();
+  });
+}
+
+TEST_F(ProjectBenchmark, testExportToZip) {
+  std::shared_ptr<TransactionalFileSystem> fs =
+      TransactionalFileSystem::openRO(mProjectFp.getParentDir());
+  FilePath zipFp = mTempDir.getPathTo("project.lppz");
+  measure("exportToZip", 10, 1, [&fs, &zipFp]() { fs->exportToZip(zipFp); });
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace librepcb
@@ -65,6 +65,8 @@ class CliExecutor(object):
         env['LC_ALL'] = 'C'
         # Override configuration location to make tests independent of existing configs
         env['LIBREPCB_CONFIG_DIR'] = os.path.join(self.tmpdir, 'config')
+        # Override cache location to avoid writing into the user's cache
+        env['LIBREPCB_CACHE_DIR'] = os.path.join(self.tmpdir, 'cache')
         # Use a neutral username
         env['USERNAME'] = 'testuser'
         return env
@@ -0,0 +1,39 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+
+import os
+
+"""
+Test command "import-eagle-library"
+"""
+
+EAGLE_LIBRARY = os.path.join(os.path.dirname(os.path.dirname(os.path.dirname(
+    os.path.abspath(__file__)))), 'data', 'unittests', 'eagleimport',
+    'resistor.lbr')
+
+
+def test_missing_output_option(cli):
+    code, stdout, stderr = cli.run('import-eagle-library', EAGLE_LIBRARY)
+    assert code == 1
+    assert len(stderr) > 0
+    assert stderr[0] == 'Wrong argument count.'
+
+
+def test_nonexistent_file(cli):
+    code, stdout, stderr = cli.run('import-eagle-library', '--output', 'out',
+                                   'nonexistent.lbr')
+    assert code == 1
+    assert len(stderr) > 0
+    assert 'File not found' in stderr[0]
+    assert stdout[-1] == 'Finished with errors!'
+
+
+def test_import(cli):
+    code, stdout, stderr = cli.run('import-eagle-library', '--output', 'out',
+                                   '--jobs', '2', EAGLE_LIBRARY)
+    assert code == 0
+    assert len(stderr) == 0
+    assert stdout[-1] == 'SUCCESS'
+    for subdir in ['sym', 'pkg']:
+        assert len(os.listdir(cli.abspath(os.path.join('out', subdir)))) > 0
+    assert os.path.isfile(cli.abspath('out/eagle-import-uuids.ini'))
@@ -0,0 +1,23 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+
+"""
+Test command "open-library"
+"""
+
+
+def test_invalid_jobs(cli):
+    code, stdout, stderr = cli.run('open-library', '--all', '--jobs', 'x',
+                                   'Empty.lplib')
+    assert code == 1
+    assert len(stderr) > 0
+    assert stderr[0] == "Invalid value for '--jobs'."
+
+
+def test_nonexistent_library(cli):
+    code, stdout, stderr = cli.run('open-library', '--all', '--check',
+                                   '--jobs', '2', 'nonexistent.lplib')
+    assert code == 1
+    assert len(stderr) > 0
+    assert stderr[0].startswith('ERROR: ')
+    assert stdout[-1] == 'Finished with errors!'
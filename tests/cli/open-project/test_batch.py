@@ -0,0 +1,59 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+
+import pytest
+
+"""
+Test command "open-project" with multiple projects
+"""
+
+PROJECT_LPP = 'data/Empty Project/Empty Project.lpp'
+PROJECT_LPPZ = 'data/Empty Project.lppz'
+
+
+@pytest.mark.parametrize("jobs", ['1', '2', '0'])
+def test_open_multiple_projects(cli, jobs):
+    code, stdout, stderr = cli.run('open-project', '--jobs', jobs,
+                                   PROJECT_LPP, PROJECT_LPPZ)
+    assert code == 0
+    assert len(stderr) == 0
+    # output is printed in the order of the given projects
+    opened = [l for l in stdout if l.startswith('Open project ')]
+    assert opened == [
+        "Open project '{}'...".format(PROJECT_LPP),
+        "Open project '{}'...".format(PROJECT_LPPZ),
+    ]
+    assert stdout[-2] == 'Processed 2 files, 0 failed.'
+    assert stdout[-1] == 'SUCCESS'
+
+
+def test_open_projects_from_file(cli):
+    with open(cli.abspath('projects.txt'), 'w') as f:
+        f.write('# comment\n')
+        f.write('\n')
+        f.write(PROJECT_LPP + '\n')
+        f.write(cli.abspath(PROJECT_LPPZ) + '\n')
+    code, stdout, stderr = cli.run('open-project', '--jobs', '2',
+                                   '--projects-file', 'projects.txt')
+    assert code == 0
+    assert len(stderr) == 0
+    assert len([l for l in stdout if l.startswith('Open project ')]) == 2
+    assert stdout[-2] == 'Processed 2 files, 0 failed.'
+    assert stdout[-1] == 'SUCCESS'
+
+
+@pytest.mark.parametrize("jobs", ['1', '2'])
+def test_open_multiple_projects_with_failure(cli, jobs):
+    code, stdout, stderr = cli.run('open-project', '--jobs', jobs,
+                                   'nonexistent.lpp', PROJECT_LPP)
+    assert code == 1
+    assert stderr[-1] == '  FAILED: nonexistent.lpp'
+    assert stdout[-2] == 'Processed 2 files, 1 failed.'
+    assert stdout[-1] == 'Finished with errors!'
+
+
+def test_invalid_jobs(cli):
+    code, stdout, stderr = cli.run('open-project', '--jobs', 'x',
+                                   PROJECT_LPP, PROJECT_LPPZ)
+    assert code == 1
+    assert stderr[0] == "Invalid value for '--jobs'."
@@ -0,0 +1,48 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+
+import json
+import pytest
+
+"""
+Test command "open-project --profile"
+"""
+
+PROJECT_LPP = 'data/Empty Project/Empty Project.lpp'
+PROJECT_LPPZ = 'data/Empty Project.lppz'
+
+
+@pytest.mark.parametrize("project", [
+    PROJECT_LPP,
+    PROJECT_LPPZ,
+], ids=[
+    'lpp',
+    'lppz'
+])
+def test_profile(cli, project):
+    code, stdout, stderr = cli.run('open-project', '--profile', project)
+    assert code == 0
+    assert len(stderr) == 0
+    assert 'Profile:' in stdout
+    assert len([l for l in stdout if 'new Calls' in l]) == 1
+    assert len([l for l in stdout if l.startswith('Open project ')]) == 1
+    assert stdout[-1] == 'SUCCESS'
+
+
+def test_profile_json(cli):
+    path = cli.abspath('profile.json')
+    code, stdout, stderr = cli.run('open-project', '--save',
+                                   '--profile-json=' + path, PROJECT_LPP)
+    assert code == 0
+    assert len(stderr) == 0
+    assert 'Profile:' not in stdout
+    assert stdout[-1] == 'SUCCESS'
+    with open(path, 'r') as f:
+        report = json.load(f)
+    names = [phase['name'] for phase in report['phases']]
+    assert 'Open project' in names
+    assert 'Save project' in names
+    for phase in report['phases']:
+        assert phase['count'] >= 1
+        assert phase['wall_time_ns'] >= 0
+        assert phase['operator_new_calls'] >= 0
@@ -24,10 +24,12 @@
 
 #include <gtest/gtest.h>
 #include <librepcb/common/fileio/fileutils.h>
+#include <librepcb/common/fileio/transactionalfilesystem.h>
 #include <librepcb/common/network/filedownload.h>
 #include <librepcb/common/network/networkaccessmanager.h>
 
 #include <QtCore>
+#include <QtNetwork>
 
 /*******************************************************************************
  *  Namespace
@@ -178,6 +180,167 @@ TEST_P(FileDownloadTest, testDownload) {
   }
 }
 
+/*******************************************************************************
+ *  Test Class with local HTTP server
+ ******************************************************************************/
+
+class FileDownloadHttpTest : public ::testing::Test {
+public:
+  static void SetUpTestCase() { sDownloadManager = new NetworkAccessManager(); }
+
+  static void TearDownTestCase() { delete sDownloadManager; }
+
+protected:
+  FileDownloadHttpTest()
+    : mTmpDir(FilePath::getRandomTempPath()),
+      mInterruptFirstReply(false),
+      mRangeRequestCount(0) {
+    // serve a ZIP file on a local HTTP server, in small chunks to let the
+    // client receive the data in several parts
+    EXPECT_TRUE(mServer.listen(QHostAddress::LocalHost));
+    QObject::connect(&mServer, &QTcpServer::newConnection, [this]() {
+      QTcpSocket* socket  = mServer.nextPendingConnection();
+      auto        request = std::make_shared<QByteArray>();
+      QObject::connect(socket, &QTcpSocket::readyRead, [=]() {
+        request->append(socket->readAll());
+        if (!request->endsWith("\r\n\r\n")) return;  // header incomplete
+        QRegularExpressionMatch match =
+            QRegularExpression("Range: bytes=(\\d+)-")
+                .match(QString::fromUtf8(*request));
+        int start = match.hasMatch() ? match.captured(1).toInt() : 0;
+        int end   = mZipContent.size();
+        if (mInterruptFirstReply) {
+          mInterruptFirstReply = false;
+          end                  = mZipContent.size() / 2;
+        }
+        if (match.hasMatch()) {
+          ++mRangeRequestCount;
+          socket->write(QString("HTTP/1.1 206 Partial Content\r\n"
+                                "Content-Range: bytes %1-%2/%3\r\n")
+                            .arg(start)
+                            .arg(mZipContent.size() - 1)
+                            .arg(mZipContent.size())
+                            .toUtf8());
+        } else {
+          socket->write("HTTP/1.1 200 OK\r\n");
+        }
+        socket->write(QString("Content-Type: application/zip\r\n"
+                              "Content-Length: %1\r\n"
+                              "Connection: close\r\n\r\n")
+                          .arg(mZipContent.size() - start)
+                          .toUtf8());
+        for (int i = start; i < end; i += 1000) {
+          socket->write(mZipContent.mid(i, qMin(1000, end - i)));
+          socket->flush();
+        }
+        socket->disconnectFromHost();
+      });
+    });
+  }
+
+  virtual ~FileDownloadHttpTest() {
+    QDir(mTmpDir.toStr()).removeRecursively();
+  }
+
+  QUrl getUrl() const {
+    return QUrl(QString("http://127.0.0.1:%1/library.zip")
+                    .arg(mServer.serverPort()));
+  }
+
+  void download(const FilePath& dest, const FilePath& extractDir,
+                const QByteArray& sha256, int maxRetries = 0) {
+    FileDownload* dl = new FileDownload(getUrl(), dest);
+    dl->setMaxRetries(maxRetries);
+    dl->setZipExtractionDirectory(extractDir);
+    dl->setExpectedChecksum(QCryptographicHash::Sha256, sha256);
+    QObject::connect(dl, &FileDownload::succeeded, &mSignalReceiver,
+                     &NetworkRequestBaseSignalReceiver::succeeded);
+    QObject::connect(dl, &FileDownload::errored, &mSignalReceiver,
+                     &NetworkRequestBaseSignalReceiver::errored);
+    QObject::connect(dl, &FileDownload::destroyed, &mSignalReceiver,
+                     &NetworkRequestBaseSignalReceiver::destroyed);
+    dl->start();
+
+    // wait until download finished (with timeout)
+    QElapsedTimer timer;
+    timer.start();
+    while ((!mSignalReceiver.mDestroyed) && (timer.elapsed() < 30000)) {
+      QThread::msleep(10);
+      qApp->processEvents();
+    }
+    EXPECT_TRUE(mSignalReceiver.mDestroyed) << "Download timed out!";
+  }
+
+  FilePath                         mTmpDir;
+  QTcpServer                       mServer;
+  QByteArray                       mZipContent;
+  bool                             mInterruptFirstReply;
+  int                              mRangeRequestCount;
+  NetworkRequestBaseSignalReceiver mSignalReceiver;
+  static NetworkAccessManager*     sDownloadManager;
+};
+
+NetworkAccessManager* FileDownloadHttpTest::sDownloadManager = nullptr;
+
+TEST_F(FileDownloadHttpTest, testDownloadAndExtractZip) {
+  FilePath srcDir = mTmpDir.getPathTo("source");
+  FileUtils::writeFile(srcDir.getPathTo("lib/pkg/package.lp"),
+                       QByteArray(100000, 'x'));
+  FileUtils::writeFile(srcDir.getPathTo("lib/library.lp"), "library");
+  FilePath zipFp = mTmpDir.getPathTo("source.zip");
+  TransactionalFileSystem(srcDir).exportToZip(zipFp);
+  mZipContent = FileUtils::readFile(zipFp);
+
+  FilePath dest       = mTmpDir.getPathTo("downloaded.zip");
+  FilePath extractDir = mTmpDir.getPathTo("extracted");
+  download(dest, extractDir,
+           QCryptographicHash::hash(mZipContent, QCryptographicHash::Sha256));
+  EXPECT_EQ(1, mSignalReceiver.mSucceededCallCount);
+  EXPECT_EQ(0, mSignalReceiver.mErroredCallCount);
+  EXPECT_FALSE(dest.isExistingFile());
+  EXPECT_EQ(QByteArray(100000, 'x'),
+            FileUtils::readFile(extractDir.getPathTo("lib/pkg/package.lp")));
+  EXPECT_EQ("library",
+            FileUtils::readFile(extractDir.getPathTo("lib/library.lp")));
+}
+
+TEST_F(FileDownloadHttpTest, testResumeInterruptedDownload) {
+  FilePath srcDir = mTmpDir.getPathTo("source");
+  FileUtils::writeFile(srcDir.getPathTo("lib/pkg/package.lp"),
+                       QByteArray(100000, 'x'));
+  FilePath zipFp = mTmpDir.getPathTo("source.zip");
+  TransactionalFileSystem(srcDir).exportToZip(zipFp, 0);  // not compressed
+  mZipContent          = FileUtils::readFile(zipFp);
+  mInterruptFirstReply = true;
+
+  FilePath dest       = mTmpDir.getPathTo("downloaded.zip");
+  FilePath extractDir = mTmpDir.getPathTo("extracted");
+  download(dest, extractDir,
+           QCryptographicHash::hash(mZipContent, QCryptographicHash::Sha256),
+           1);
+  EXPECT_EQ(1, mSignalReceiver.mSucceededCallCount);
+  EXPECT_EQ(0, mSignalReceiver.mErroredCallCount);
+  EXPECT_EQ(1, mRangeRequestCount);
+  EXPECT_EQ(QByteArray(100000, 'x'),
+            FileUtils::readFile(extractDir.getPathTo("lib/pkg/package.lp")));
+}
+
+TEST_F(FileDownloadHttpTest, testWrongChecksumRemovesExtractedFiles) {
+  FilePath srcDir = mTmpDir.getPathTo("source");
+  FileUtils::writeFile(srcDir.getPathTo("lib/library.lp"), "library");
+  FilePath zipFp = mTmpDir.getPathTo("source.zip");
+  TransactionalFileSystem(srcDir).exportToZip(zipFp);
+  mZipContent = FileUtils::readFile(zipFp);
+
+  FilePath dest       = mTmpDir.getPathTo("downloaded.zip");
+  FilePath extractDir = mTmpDir.getPathTo("extracted");
+  download(dest, extractDir, QByteArray(32, '\0'));
+  EXPECT_EQ(0, mSignalReceiver.mSucceededCallCount);
+  EXPECT_EQ(1, mSignalReceiver.mErroredCallCount);
+  EXPECT_FALSE(dest.isExistingFile());
+  EXPECT_FALSE(extractDir.isExistingDir());
+}
+
 /*******************************************************************************
  *  Test Data
  ******************************************************************************/
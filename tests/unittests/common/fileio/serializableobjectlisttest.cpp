@@ -161,6 +161,53 @@ TEST_F(SerializableObjectListTest, testIndexOfName) {
   EXPECT_EQ(2, l.indexOf(mMocks[2]->mName));
 }
 
+TEST_F(SerializableObjectListTest, testIndexOfDuplicates) {
+  List l{mMocks[0], mMocks[1], mMocks[0], mMocks[1]};
+  EXPECT_EQ(0, l.indexOf(mMocks[0].get()));
+  EXPECT_EQ(1, l.indexOf(mMocks[1]->mUuid));
+  l.remove(0);
+  EXPECT_EQ(1, l.indexOf(mMocks[0].get()));
+  EXPECT_EQ(0, l.indexOf(mMocks[1]->mUuid));
+}
+
+TEST_F(SerializableObjectListTest, testIndexOfAfterModifications) {
+  List l{mMocks[0], mMocks[1]};
+  EXPECT_EQ(1, l.indexOf(mMocks[1]->mUuid));  // builds the index
+  l.insert(0, mMocks[2]);
+  EXPECT_EQ(0, l.indexOf(mMocks[2]->mUuid));
+  EXPECT_EQ(2, l.indexOf(mMocks[1]->mUuid));
+  EXPECT_EQ(2, l.indexOf(mMocks[1].get()));
+  l.swap(0, 2);
+  EXPECT_EQ(2, l.indexOf(mMocks[2]->mUuid));
+  EXPECT_EQ(0, l.indexOf(mMocks[1].get()));
+  l.remove(mMocks[0]->mUuid);
+  EXPECT_EQ(-1, l.indexOf(mMocks[0]->mUuid));
+  EXPECT_EQ(-1, l.indexOf(mMocks[0].get()));
+  EXPECT_EQ(1, l.indexOf(mMocks[2]->mUuid));
+  l.clear();
+  EXPECT_EQ(-1, l.indexOf(mMocks[1]->mUuid));
+  EXPECT_EQ(-1, l.indexOf(mMocks[2].get()));
+}
+
+TEST_F(SerializableObjectListTest, testIndexOfWithManyElements) {
+  // e.g. a BGA package with many pads
+  List              l;
+  std::vector<Uuid> uuids;
+  for (int i = 0; i < 2500; ++i) {
+    uuids.push_back(Uuid::createRandom());
+    l.append(std::make_shared<Mock>(uuids.back(), QString::number(i)));
+  }
+  for (int i = 0; i < 2500; ++i) {
+    EXPECT_EQ(i, l.indexOf(uuids.at(i)));
+    EXPECT_EQ(i, l.indexOf(l.at(i).get()));
+  }
+  l.remove(1000);
+  EXPECT_EQ(-1, l.indexOf(uuids.at(1000)));
+  EXPECT_EQ(999, l.indexOf(uuids.at(999)));
+  EXPECT_EQ(1000, l.indexOf(uuids.at(1001)));
+  EXPECT_EQ(2498, l.indexOf(uuids.at(2499)));
+}
+
 TEST_F(SerializableObjectListTest, testContainsPointer) {
   List l{mMocks[0], mMocks[1], mMocks[2]};
   EXPECT_TRUE(l.contains(mMocks[0].get()));
@@ -24,6 +24,9 @@
 #include <gtest/gtest.h>
 #include <librepcb/common/fileio/fileutils.h>
 #include <librepcb/common/fileio/transactionalfilesystem.h>
+#include <librepcb/common/toolbox.h>
+#include <quazip/quazip.h>
+#include <quazip/quazipfile.h>
 
 /*******************************************************************************
  *  Namespace
@@ -155,6 +158,76 @@ TEST_F(TransactionalFileSystemTest, testWriteIsDelayedUntilSave) {
   EXPECT_EQ("content", FileUtils::readFile(fp));
 }
 
+#if (QT_VERSION >= QT_VERSION_CHECK(5, 10, 0))
+TEST_F(TransactionalFileSystemTest, testSaveSkipsUnmodifiedContent) {
+  FilePath  fp1 = mPopulatedDir.getPathTo("1.txt");
+  FilePath  fp2 = mPopulatedDir.getPathTo("2.txt");
+  QDateTime past(QDate(2000, 1, 1), QTime(0, 0));
+  foreach (const FilePath& fp, QList<FilePath>{fp1, fp2}) {
+    QFile file(fp.toStr());
+    ASSERT_TRUE(file.open(QIODevice::ReadWrite));
+    ASSERT_TRUE(file.setFileTime(past, QFileDevice::FileModificationTime));
+  }
+  TransactionalFileSystem fs(mPopulatedDir, true);
+  fs.write("1.txt", "1");         // same content as on disk
+  fs.write("2.txt", "modified");  // different content
+  fs.save();
+  EXPECT_EQ(past, QFileInfo(fp1.toStr()).lastModified());
+  EXPECT_NE(past, QFileInfo(fp2.toStr()).lastModified());
+  EXPECT_EQ("modified", FileUtils::readFile(fp2));
+}
+#endif
+
+TEST_F(TransactionalFileSystemTest, testWriteAfterExternalModification) {
+  FilePath                fp = mPopulatedDir.getPathTo("1.txt");
+  TransactionalFileSystem fs(mPopulatedDir, true);
+  fs.write("1.txt", "1");  // same content as on disk -> hash is cached
+  fs.save();
+  FileUtils::writeFile(fp, "modified by another application");
+  fs.write("1.txt", "1");  // now differs from the disk
+  fs.save();
+  EXPECT_EQ("1", FileUtils::readFile(fp));
+}
+
+TEST_F(TransactionalFileSystemTest, testWriteAfterExternalModificationOfSaved) {
+  FilePath                fp = mPopulatedDir.getPathTo("1.txt");
+  TransactionalFileSystem fs(mPopulatedDir, true);
+  fs.write("1.txt", "saved");
+  fs.save();  // hash of the written content is cached
+  FileUtils::writeFile(fp, "modified by another application");
+  fs.write("1.txt", "saved");
+  EXPECT_TRUE(fs.isModified());
+  fs.save();
+  EXPECT_EQ("saved", FileUtils::readFile(fp));
+}
+
+TEST_F(TransactionalFileSystemTest, testIsModified) {
+  TransactionalFileSystem fs(mPopulatedDir, true);
+  EXPECT_FALSE(fs.isModified());
+  fs.write("1.txt", "1");  // same content as on disk, compared when saving
+  EXPECT_TRUE(fs.isModified());
+  fs.discardUnmodifiedFiles();
+  EXPECT_FALSE(fs.isModified());
+  fs.write("1.txt", "modified");
+  EXPECT_TRUE(fs.isModified());
+  fs.save();
+  EXPECT_FALSE(fs.isModified());
+  fs.removeFile("1.txt");
+  EXPECT_TRUE(fs.isModified());
+}
+
+TEST_F(TransactionalFileSystemTest, testWriteUnmodifiedContentAfterRemove) {
+  FilePath                fp = mPopulatedDir.getPathTo("1/1a.txt");
+  TransactionalFileSystem fs(mPopulatedDir, true);
+  fs.removeFile("1/1a.txt");
+  fs.removeDirRecursively("a");
+  fs.write("1/1a.txt", "1a");  // same content as on disk
+  fs.write("a/b/c", "c");      // same content as on disk, but dir is removed
+  fs.save();
+  EXPECT_EQ("1a", FileUtils::readFile(fp));
+  EXPECT_EQ("c", FileUtils::readFile(mPopulatedDir.getPathTo("a/b/c")));
+}
+
 TEST_F(TransactionalFileSystemTest, testRemoveExistingFile) {
   FilePath                fp = mPopulatedDir.getPathTo("1/1a.txt");
   TransactionalFileSystem fs(mPopulatedDir, true);
@@ -434,6 +507,50 @@ TEST_F(TransactionalFileSystemTest, testAutosaveIsRemovedInDestructor) {
   EXPECT_FALSE(fp.isExistingDir());
 }
 
+TEST_F(TransactionalFileSystemTest, testAutosaveInBackground) {
+  FilePath                fp = mPopulatedDir.getPathTo(".autosave/autosave.lp");
+  TransactionalFileSystem fs(mPopulatedDir, true);
+  fs.write("1.txt", "autosaved");
+  fs.write("x.txt", "autosaved");
+  QEventLoop loop;
+  int        finishedCount = 0;
+  bool       success       = false;
+  QObject::connect(&fs, &TransactionalFileSystem::autosaveFinished,
+                   [&](bool s) {
+                     ++finishedCount;
+                     success = s;
+                     loop.quit();
+                   });
+  fs.autosaveInBackground();
+
+  // modifications made while autosave is running must not affect it
+  fs.write("1.txt", "modified");
+  fs.removeFile("x.txt");
+  fs.write("y.txt", "new");
+
+  // wait until the autosave is complete
+  loop.exec();
+  EXPECT_EQ(1, finishedCount);
+  EXPECT_TRUE(success);
+  ASSERT_TRUE(fp.isExistingFile());
+
+  // remove lock because we can't get a stale lock without crashing the app
+  FileUtils::removeFile(mPopulatedDir.getPathTo(".lock"));
+
+  // open another file system on the same directory to restore the autosave
+  TransactionalFileSystem fs2(mPopulatedDir, true,
+                              TransactionalFileSystem::RestoreMode::YES);
+  EXPECT_TRUE(fs2.isRestoredFromAutosave());
+  EXPECT_EQ("autosaved", fs2.read("1.txt"));
+  EXPECT_EQ("autosaved", fs2.read("x.txt"));
+  EXPECT_FALSE(fs2.fileExists("y.txt"));
+
+  // the original file system still contains the latest modifications
+  EXPECT_EQ("modified", fs.read("1.txt"));
+  EXPECT_FALSE(fs.fileExists("x.txt"));
+  EXPECT_EQ("new", fs.read("y.txt"));
+}
+
 TEST_F(TransactionalFileSystemTest, testRestoreAutosave) {
   TransactionalFileSystem fs(mPopulatedDir, true);
 
@@ -598,6 +715,77 @@ TEST_F(TransactionalFileSystemTest, testExportToZip) {
   EXPECT_TRUE(zipFp.isExistingFile());
 }
 
+TEST_F(TransactionalFileSystemTest, testExportAndLoadZip) {
+  FilePath zipFp = mTmpDir.getPathTo("export.zip");
+  for (int level : {-1, 0, 9}) {
+    {
+      TransactionalFileSystem fs(mPopulatedDir, true);
+      fs.write("1.txt", QByteArray(100000, 'x'));  // compressible content
+      fs.exportToZip(zipFp, level);
+    }
+    TransactionalFileSystem fs(mEmptyDir, true);
+    fs.loadFromZip(zipFp);
+    EXPECT_EQ(QByteArray(100000, 'x'), fs.read("1.txt")) << "Level: " << level;
+    EXPECT_EQ("2", fs.read("2.txt")) << "Level: " << level;
+    EXPECT_EQ("4", fs.read("1/2/3/4.txt")) << "Level: " << level;
+    EXPECT_EQ("X", fs.read("foo dir/bar dir/X")) << "Level: " << level;
+    EXPECT_FALSE(fs.fileExists(".dot/file.txt")) << "Level: " << level;
+    EXPECT_EQ(QStringList({"1", "a", "foo dir"}),
+              Toolbox::sorted(fs.getDirs()))
+        << "Level: " << level;
+  }
+}
+
+TEST_F(TransactionalFileSystemTest, testExportToLoadedZip) {
+  FilePath zipFp = mTmpDir.getPathTo("export.zip");
+  {
+    TransactionalFileSystem fs(mPopulatedDir, true);
+    fs.exportToZip(zipFp);
+  }
+  TransactionalFileSystem fs(mEmptyDir, true);
+  fs.loadFromZip(zipFp);
+  fs.write("new.txt", "new");
+  fs.exportToZip(zipFp);  // overwrite the loaded ZIP file
+  EXPECT_FALSE(FilePath(zipFp.toStr() % "~").isExistingFile());
+
+  // the loaded files must still be accessible
+  EXPECT_EQ("1", fs.read("1.txt"));
+  EXPECT_EQ("c", fs.read("a/b/c"));
+
+  // and they are saved correctly
+  fs.save();
+  EXPECT_EQ("1", FileUtils::readFile(mEmptyDir.getPathTo("1.txt")));
+  EXPECT_EQ("c", FileUtils::readFile(mEmptyDir.getPathTo("a/b/c")));
+  EXPECT_EQ("new", FileUtils::readFile(mEmptyDir.getPathTo("new.txt")));
+}
+
+TEST_F(TransactionalFileSystemTest, testExportToLoadedZipWithUncleanPaths) {
+  // create a ZIP file with entry names which are not clean paths
+  FilePath zipFp = mTmpDir.getPathTo("unclean.zip");
+  {
+    QuaZip zip(zipFp.toStr());
+    ASSERT_TRUE(zip.open(QuaZip::mdCreate));
+    foreach (const QString& name, QStringList{"dir//1.txt", "/2.txt"}) {
+      QuaZipFile file(&zip);
+      ASSERT_TRUE(file.open(QIODevice::WriteOnly, QuaZipNewInfo(name)));
+      file.write(name.toUtf8());
+      file.close();
+    }
+    zip.close();
+  }
+
+  TransactionalFileSystem fs(mEmptyDir, true);
+  fs.loadFromZip(zipFp);
+  EXPECT_EQ("dir//1.txt", fs.read("dir/1.txt"));
+  fs.exportToZip(zipFp);  // rewrites the entries with cleaned paths
+
+  // the loaded files must still be saved correctly
+  fs.save();
+  EXPECT_EQ("dir//1.txt",
+            FileUtils::readFile(mEmptyDir.getPathTo("dir/1.txt")));
+  EXPECT_EQ("/2.txt", FileUtils::readFile(mEmptyDir.getPathTo("2.txt")));
+}
+
 /*******************************************************************************
  *  Parametrized getSubDirs() Tests
  ******************************************************************************/
@@ -0,0 +1,237 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+
+#include <gtest/gtest.h>
+#include <librepcb/common/fileio/fileutils.h>
+#include <librepcb/common/fileio/transactionalfilesystem.h>
+#include <librepcb/common/fileio/zipstreamextractor.h>
+
+#include <QtCore>
+
+#include <zlib.h>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class ZipStreamExtractorTest : public ::testing::Test {
+protected:
+  struct Entry {
+    QString    name;
+    QByteArray content;
+    bool       deflate;
+    bool       dataDescriptor;
+  };
+
+  FilePath mTmpDir;
+  FilePath mDestDir;
+
+  ZipStreamExtractorTest() {
+    mTmpDir  = FilePath::getRandomTempPath().getPathTo("spaces in path");
+    mDestDir = mTmpDir.getPathTo("extracted");
+  }
+
+  virtual ~ZipStreamExtractorTest() {
+    QDir(mTmpDir.toStr()).removeRecursively();
+  }
+
+  static void appendUInt16(QByteArray& data, quint16 value) {
+    data.append(static_cast<char>(value & 0xFF));
+    data.append(static_cast<char>((value >> 8) & 0xFF));
+  }
+
+  static void appendUInt32(QByteArray& data, quint32 value) {
+    appendUInt16(data, value & 0xFFFF);
+    appendUInt16(data, (value >> 16) & 0xFFFF);
+  }
+
+  static QByteArray deflateRaw(const QByteArray& data) {
+    z_stream stream;
+    memset(&stream, 0, sizeof(stream));
+    deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -MAX_WBITS, 8,
+                 Z_DEFAULT_STRATEGY);
+    QByteArray output(static_cast<int>(deflateBound(&stream, data.size())),
+                      Qt::Uninitialized);
+    stream.next_in   = reinterpret_cast<Bytef*>(const_cast<char*>(data.data()));
+    stream.avail_in  = static_cast<uInt>(data.size());
+    stream.next_out  = reinterpret_cast<Bytef*>(output.data());
+    stream.avail_out = static_cast<uInt>(output.size());
+    deflate(&stream, Z_FINISH);
+    output.resize(static_cast<int>(stream.total_out));
+    deflateEnd(&stream);
+    return output;
+  }
+
+  static QByteArray createZip(const QList<Entry>& entries) {
+    QByteArray zip;
+    foreach (const Entry& entry, entries) {
+      QByteArray name = entry.name.toUtf8();
+      QByteArray data =
+          entry.deflate ? deflateRaw(entry.content) : entry.content;
+      quint32 crc = crc32(0L, Z_NULL, 0);
+      crc         = crc32(crc,
+                  reinterpret_cast<const Bytef*>(entry.content.constData()),
+                  entry.content.size());
+      quint16 flags      = entry.dataDescriptor ? 0x0808 : 0x0800;  // UTF-8
+      quint32 headerCrc  = entry.dataDescriptor ? 0 : crc;
+      quint32 headerSize = entry.dataDescriptor ? 0 : data.size();
+      quint32 headerUncompressedSize =
+          entry.dataDescriptor ? 0 : entry.content.size();
+      appendUInt32(zip, 0x04034b50);  // signature
+      appendUInt16(zip, 20);          // version
+      appendUInt16(zip, flags);
+      appendUInt16(zip, entry.deflate ? 8 : 0);  // method
+      appendUInt32(zip, 0);                      // time & date
+      appendUInt32(zip, headerCrc);
+      appendUInt32(zip, headerSize);
+      appendUInt32(zip, headerUncompressedSize);
+      appendUInt16(zip, name.size());
+      appendUInt16(zip, 0);  // extra field length
+      zip.append(name);
+      zip.append(data);
+      if (entry.dataDescriptor) {
+        appendUInt32(zip, 0x08074b50);  // signature
+        appendUInt32(zip, crc);
+        appendUInt32(zip, data.size());
+        appendUInt32(zip, entry.content.size());
+      }
+    }
+    // the central directory is ignored anyway, so just add an empty one
+    appendUInt32(zip, 0x06054b50);
+    zip.append(QByteArray(18, '\0'));
+    return zip;
+  }
+
+  void extract(const QByteArray& zip, int chunkSize) {
+    ZipStreamExtractor extractor(mDestDir);
+    for (int i = 0; i < zip.size(); i += chunkSize) {
+      extractor.addData(zip.mid(i, chunkSize));
+    }
+    extractor.finish();
+  }
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(ZipStreamExtractorTest, testExtractInChunksOfDifferentSize) {
+  QByteArray compressible(100000, 'x');
+  QByteArray zip = createZip({
+      {"stored.txt", "stored", false, false},
+      {"dir/", "", false, false},
+      {"dir/deflated.txt", compressible, true, false},
+      {"dir/sub dir/descriptor.txt", compressible, true, true},
+      {"empty.txt", "", true, true},
+  });
+  for (int chunkSize : {1, 7, 4096, zip.size()}) {
+    QDir(mDestDir.toStr()).removeRecursively();
+    extract(zip, chunkSize);
+    EXPECT_EQ("stored", FileUtils::readFile(mDestDir.getPathTo("stored.txt")))
+        << "Chunk size: " << chunkSize;
+    EXPECT_EQ(compressible,
+              FileUtils::readFile(mDestDir.getPathTo("dir/deflated.txt")))
+        << "Chunk size: " << chunkSize;
+    EXPECT_EQ(compressible, FileUtils::readFile(mDestDir.getPathTo(
+                                "dir/sub dir/descriptor.txt")))
+        << "Chunk size: " << chunkSize;
+    EXPECT_EQ("", FileUtils::readFile(mDestDir.getPathTo("empty.txt")))
+        << "Chunk size: " << chunkSize;
+  }
+}
+
+TEST_F(ZipStreamExtractorTest, testExtractExportedZip) {
+  FilePath srcDir = mTmpDir.getPathTo("source");
+  FileUtils::writeFile(srcDir.getPathTo("1.txt"), QByteArray(100000, 'x'));
+  FileUtils::writeFile(srcDir.getPathTo("foo dir/bar.txt"), "bar");
+  FilePath zipFp = mTmpDir.getPathTo("export.zip");
+  for (int level : {-1, 0, 9}) {
+    {
+      TransactionalFileSystem fs(srcDir, false);
+      fs.exportToZip(zipFp, level);
+    }
+    QDir(mDestDir.toStr()).removeRecursively();
+    extract(FileUtils::readFile(zipFp), 1000);
+    EXPECT_EQ(QByteArray(100000, 'x'),
+              FileUtils::readFile(mDestDir.getPathTo("1.txt")))
+        << "Level: " << level;
+    EXPECT_EQ("bar", FileUtils::readFile(mDestDir.getPathTo("foo dir/bar.txt")))
+        << "Level: " << level;
+  }
+}
+
+TEST_F(ZipStreamExtractorTest, testGetExtractedFiles) {
+  QByteArray zip = createZip({
+      {"dir/", "", false, false},
+      {"dir/a.txt", "a", false, false},
+      {"b.txt", "b", true, false},
+  });
+  ZipStreamExtractor extractor(mDestDir);
+  extractor.addData(zip);
+  EXPECT_TRUE(extractor.isFinished());
+  EXPECT_EQ(QList<FilePath>({mDestDir.getPathTo("dir/a.txt"),
+                             mDestDir.getPathTo("b.txt")}),
+            extractor.getExtractedFiles());
+}
+
+TEST_F(ZipStreamExtractorTest, testIncompleteZipThrowsOnFinish) {
+  QByteArray zip = createZip({{"a.txt", QByteArray(1000, 'a'), true, false}});
+  ZipStreamExtractor extractor(mDestDir);
+  extractor.addData(zip.left(zip.size() / 2));
+  EXPECT_FALSE(extractor.isFinished());
+  EXPECT_THROW(extractor.finish(), Exception);
+}
+
+TEST_F(ZipStreamExtractorTest, testInvalidCrcThrows) {
+  QByteArray zip = createZip({{"a.txt", "content", false, false}});
+  zip[30 + 5] = 'X';  // modify content of first entry
+  EXPECT_THROW(extract(zip, zip.size()), Exception);
+}
+
+TEST_F(ZipStreamExtractorTest, testPathOutsideDestinationThrows) {
+  QByteArray zip = createZip({{"../evil.txt", "evil", false, false}});
+  EXPECT_THROW(extract(zip, zip.size()), Exception);
+  EXPECT_FALSE(mTmpDir.getPathTo("evil.txt").isExistingFile());
+}
+
+TEST_F(ZipStreamExtractorTest, testStoredEntryWithDataDescriptorThrows) {
+  QByteArray zip = createZip({{"a.txt", "content", false, true}});
+  EXPECT_THROW(extract(zip, zip.size()), Exception);
+}
+
+TEST_F(ZipStreamExtractorTest, testInvalidDataThrows) {
+  EXPECT_THROW(extract("this is not a ZIP file", 5), Exception);
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace librepcb
@@ -0,0 +1,148 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <gtest/gtest.h>
+#include <librepcb/common/exceptions.h>
+#include <librepcb/common/fileio/fileutils.h>
+#include <librepcb/common/font/strokefontcache.h>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class StrokeFontCacheTest : public ::testing::Test {
+protected:
+  static StrokeFontCache::Font createFont() noexcept {
+    StrokeFontCache::Font font;
+    font.letterSpacing = 1.5;
+    font.lineSpacing   = 15.0;
+    StrokeFontCache::Glyph a;
+    a.spacing   = 0.5;
+    a.polylines = {
+        {{0, 0, 0}, {3, 9, 0}, {6, 0, 0}},
+        {{1.5, 4.5, 0}, {4.5, 4.5, -90}},
+    };
+    font.glyphs.insert('A', a);
+    StrokeFontCache::Glyph space;
+    space.spacing = 6;
+    font.glyphs.insert(' ', space);
+    return font;
+  }
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(StrokeFontCacheTest, testSerializeDeserialize) {
+  StrokeFontCache::Font font = createFont();
+  QByteArray            hash("0123456789");
+  QByteArray            data = StrokeFontCache::serialize(font, hash);
+
+  StrokeFontCache::Font result;
+  EXPECT_TRUE(StrokeFontCache::deserialize(data, hash, result));
+  EXPECT_EQ(font.letterSpacing, result.letterSpacing);
+  EXPECT_EQ(font.lineSpacing, result.lineSpacing);
+  EXPECT_EQ(font.glyphs, result.glyphs);
+}
+
+TEST_F(StrokeFontCacheTest, testDeserializeWithWrongHash) {
+  QByteArray data = StrokeFontCache::serialize(createFont(), "foo");
+
+  StrokeFontCache::Font result;
+  EXPECT_FALSE(StrokeFontCache::deserialize(data, "bar", result));
+  EXPECT_TRUE(result.glyphs.isEmpty());
+}
+
+TEST_F(StrokeFontCacheTest, testDeserializeTruncatedData) {
+  QByteArray data = StrokeFontCache::serialize(createFont(), "foo");
+
+  for (int size = 0; size < data.size(); ++size) {
+    StrokeFontCache::Font result;
+    EXPECT_FALSE(StrokeFontCache::deserialize(data.left(size), "foo", result))
+        << "Size: " << size;
+  }
+}
+
+TEST_F(StrokeFontCacheTest, testDeserializeTrailingData) {
+  QByteArray data = StrokeFontCache::serialize(createFont(), "foo");
+
+  StrokeFontCache::Font result;
+  EXPECT_FALSE(StrokeFontCache::deserialize(data + "x", "foo", result));
+}
+
+TEST_F(StrokeFontCacheTest, testLoadFromCacheFile) {
+  QTemporaryDir tmpDir;
+  ASSERT_TRUE(tmpDir.isValid());
+  FilePath              cacheDir(tmpDir.path());
+  StrokeFontCache::Font font    = createFont();
+  QByteArray            content = "not a valid font file";
+  QByteArray            hash =
+      QCryptographicHash::hash(content, QCryptographicHash::Sha256);
+  FileUtils::writeFile(
+      cacheDir.getPathTo(QString::fromLatin1(hash.toHex()) % ".lpsfc"),
+      StrokeFontCache::serialize(font, hash));
+
+  // the content is not parsed at all if a valid cache file exists
+  StrokeFontCache::Font result = StrokeFontCache::load(cacheDir, content);
+  EXPECT_EQ(font.letterSpacing, result.letterSpacing);
+  EXPECT_EQ(font.lineSpacing, result.lineSpacing);
+  EXPECT_EQ(font.glyphs, result.glyphs);
+}
+
+TEST_F(StrokeFontCacheTest, testLoadIgnoresInvalidCacheFile) {
+  QTemporaryDir tmpDir;
+  ASSERT_TRUE(tmpDir.isValid());
+  FilePath   cacheDir(tmpDir.path());
+  QByteArray content = "not a valid font file";
+  QByteArray hash =
+      QCryptographicHash::hash(content, QCryptographicHash::Sha256);
+  FileUtils::writeFile(
+      cacheDir.getPathTo(QString::fromLatin1(hash.toHex()) % ".lpsfc"),
+      StrokeFontCache::serialize(createFont(), "other hash"));
+
+  // the content needs to be parsed, which fails
+  EXPECT_THROW(StrokeFontCache::load(cacheDir, content), Exception);
+}
+
+TEST_F(StrokeFontCacheTest, testSetDirectory) {
+  QTemporaryDir tmpDir;
+  ASSERT_TRUE(tmpDir.isValid());
+  FilePath oldDir = StrokeFontCache::getDirectory();
+  StrokeFontCache::setDirectory(FilePath(tmpDir.path()));
+  EXPECT_EQ(FilePath(tmpDir.path()), StrokeFontCache::getDirectory());
+  StrokeFontCache::setDirectory(oldDir);
+  EXPECT_EQ(oldDir, StrokeFontCache::getDirectory());
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace librepcb
@@ -0,0 +1,148 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <gtest/gtest.h>
+#include <librepcb/common/fileio/fileutils.h>
+#include <librepcb/common/font/strokefont.h>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class StrokeFontTest : public ::testing::Test {
+protected:
+  StrokeFontTest() : mTmpDir(), mFont() {
+    // Provide the font through a cache file to get a small, well-known font
+    // without the need of a font file.
+    StrokeFontCache::Font font;
+    font.letterSpacing = 1.5;
+    font.lineSpacing   = 15.0;
+    StrokeFontCache::Glyph a;
+    a.spacing   = 0.5;
+    a.polylines = {
+        {{0, 0, 0}, {3, 9, 0}, {6, 0, 0}},
+        {{1.5, 4.5, 0}, {4.5, 4.5, 0}},
+    };
+    font.glyphs.insert('A', a);
+    StrokeFontCache::Glyph space;
+    space.spacing = 6;
+    font.glyphs.insert(' ', space);
+    FilePath   cacheDir(mTmpDir.path());
+    QByteArray content = "not a valid font file";
+    QByteArray hash =
+        QCryptographicHash::hash(content, QCryptographicHash::Sha256);
+    FileUtils::writeFile(
+        cacheDir.getPathTo(QString::fromLatin1(hash.toHex()) % ".lpsfc"),
+        StrokeFontCache::serialize(font, hash));
+    mFont.reset(new StrokeFont(cacheDir.getPathTo("font.bene"), content,
+                               cacheDir));
+  }
+
+  QTemporaryDir               mTmpDir;
+  QScopedPointer<StrokeFont> mFont;
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(StrokeFontTest, testStrokeGlyph) {
+  Length        spacing;
+  QVector<Path> paths = mFont->strokeGlyph('A', PositiveLength(9000000),
+                                           spacing);
+  EXPECT_EQ(Length(500000), spacing);
+  ASSERT_EQ(2, paths.count());
+  ASSERT_EQ(3, paths[0].getVertices().count());
+  EXPECT_EQ(Point(3000000, 9000000), paths[0].getVertices()[1].getPos());
+}
+
+TEST_F(StrokeFontTest, testStrokeGlyphIsCached) {
+  Length        spacing1, spacing2;
+  QVector<Path> paths1 = mFont->strokeGlyph('A', PositiveLength(9000000),
+                                            spacing1);
+  QVector<Path> paths2 = mFont->strokeGlyph('A', PositiveLength(9000000),
+                                            spacing2);
+  EXPECT_EQ(spacing1, spacing2);
+  EXPECT_EQ(paths1, paths2);
+  // a cache hit returns the same (implicitly shared) data
+  EXPECT_EQ(paths1.constData(), paths2.constData());
+}
+
+TEST_F(StrokeFontTest, testStrokeGlyphCacheDependsOnHeight) {
+  Length        spacing1, spacing2;
+  QVector<Path> paths1 = mFont->strokeGlyph('A', PositiveLength(9000000),
+                                            spacing1);
+  QVector<Path> paths2 = mFont->strokeGlyph('A', PositiveLength(18000000),
+                                            spacing2);
+  EXPECT_EQ(spacing1 * 2, spacing2);
+  ASSERT_EQ(2, paths2.count());
+  ASSERT_EQ(3, paths2[0].getVertices().count());
+  EXPECT_EQ(Point(6000000, 18000000), paths2[0].getVertices()[1].getPos());
+}
+
+TEST_F(StrokeFontTest, testStrokeIsCached) {
+  Point         bottomLeft1, topRight1, bottomLeft2, topRight2;
+  QVector<Path> paths1 =
+      mFont->stroke("A A", PositiveLength(9000000), Length(1000000),
+                    Length(15000000), Alignment(), bottomLeft1, topRight1);
+  QVector<Path> paths2 =
+      mFont->stroke("A A", PositiveLength(9000000), Length(1000000),
+                    Length(15000000), Alignment(), bottomLeft2, topRight2);
+  EXPECT_EQ(4, paths1.count());
+  EXPECT_EQ(paths1, paths2);
+  EXPECT_EQ(bottomLeft1, bottomLeft2);
+  EXPECT_EQ(topRight1, topRight2);
+  // a cache hit returns the same (implicitly shared) data
+  EXPECT_EQ(paths1.constData(), paths2.constData());
+}
+
+TEST_F(StrokeFontTest, testStrokeCacheDependsOnParameters) {
+  Point         bottomLeft1, topRight1, bottomLeft2, topRight2;
+  QVector<Path> paths1 =
+      mFont->stroke("A A", PositiveLength(9000000), Length(1000000),
+                    Length(15000000), Alignment(), bottomLeft1, topRight1);
+  QVector<Path> paths2 =
+      mFont->stroke("A A", PositiveLength(9000000), Length(2000000),
+                    Length(15000000), Alignment(), bottomLeft2, topRight2);
+  EXPECT_NE(paths1, paths2);
+  EXPECT_EQ(topRight1.getX() + Length(2000000), topRight2.getX());
+
+  QVector<Path> paths3 =
+      mFont->stroke("A A", PositiveLength(18000000), Length(1000000),
+                    Length(15000000), Alignment(), bottomLeft2, topRight2);
+  EXPECT_NE(paths1, paths3);
+  EXPECT_EQ(Length(18000000), topRight2.getY());
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace librepcb
@@ -77,6 +77,49 @@ TEST_F(PathTest, testCircle) {
   EXPECT_TRUE(path.isClosed());
 }
 
+TEST_F(PathTest, testFlatArc) {
+  Point          p1(Length(1000000), Length(2000000));
+  Point          p2(Length(11000000), Length(2000000));
+  Point          center(Length(6000000), Length(2000000));
+  PositiveLength tolerance(5000);
+
+  Path path = Path::flatArc(p1, p2, -Angle::deg180(), tolerance);
+  EXPECT_GT(path.getVertices().count(), 10);
+  EXPECT_EQ(p1, path.getVertices().first().getPos());
+  EXPECT_EQ(p2, path.getVertices().last().getPos());
+  for (int i = 0; i < path.getVertices().count(); ++i) {
+    const Point& pos = path.getVertices().at(i).getPos();
+    EXPECT_NEAR(5000000, (pos - center).getLength().toNm(), 2);
+    EXPECT_GE(pos.getY(), p1.getY());  // clockwise --> above start point
+    EXPECT_EQ(Angle(0), path.getVertices().at(i).getAngle());
+  }
+}
+
+TEST_F(PathTest, testFlatArcOffsetsAreIndependentOfPosition) {
+  Point          delta(Length(-3000000), Length(4000000));
+  Angle          angle = Angle::fromDeg(123.4);
+  PositiveLength tolerance(1000);
+  Point          offset(Length(-123456789), Length(987654321));
+
+  Path path1 = Path::flatArc(Point(0, 0), delta, angle, tolerance);
+  Path path2 = Path::flatArc(offset, offset + delta, angle, tolerance);
+  ASSERT_EQ(path1.getVertices().count(), path2.getVertices().count());
+  for (int i = 0; i < path1.getVertices().count(); ++i) {
+    EXPECT_EQ(path1.getVertices().at(i).getPos() + offset,
+              path2.getVertices().at(i).getPos());
+  }
+  QVector<Point> offsets = Path::flatArcOffsets(delta, angle, tolerance);
+  EXPECT_EQ(path1.getVertices().count() - 1, offsets.count());
+  EXPECT_EQ(delta, offsets.last());
+}
+
+TEST_F(PathTest, testFlatArcWithSmallRadiusReturnsLine) {
+  Point p1(Length(100), Length(200));
+  Point p2(Length(300), Length(200));
+  Path  path = Path::flatArc(p1, p2, Angle::deg180(), PositiveLength(5000));
+  EXPECT_EQ(Path::line(p1, p2), path);
+}
+
 /*******************************************************************************
  *  Parametrized obround(width, height) Tests
  ******************************************************************************/
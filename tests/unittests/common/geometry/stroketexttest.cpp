@@ -0,0 +1,154 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <gtest/gtest.h>
+#include <librepcb/common/fileio/fileutils.h>
+#include <librepcb/common/font/strokefont.h>
+#include <librepcb/common/geometry/stroketext.h>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class StrokeTextTest : public ::testing::Test {
+protected:
+  StrokeTextTest()
+    : mTmpDir(),
+      mFont(createFont(6)),
+      mWideFont(createFont(12)),
+      mText(Uuid::createRandom(), GraphicsLayerName("top_names"), "A",
+            Point(0, 0), Angle::deg0(), PositiveLength(9000000),
+            UnsignedLength(200000), StrokeTextSpacing(Ratio::percent100()),
+            StrokeTextSpacing(Ratio::percent100()), Alignment(), false,
+            false),
+      mPathsChangedCount(0),
+      mOnEditedCallback([this](const StrokeText& text,
+                               StrokeText::Event  event) {
+        Q_UNUSED(text);
+        if (event == StrokeText::Event::PathsChanged) {
+          ++mPathsChangedCount;
+        }
+      }),
+      mOnEditedSlot(mOnEditedCallback) {
+    mText.onEdited.attach(mOnEditedSlot);
+  }
+
+  /**
+   * @brief Create a font containing only the glyph "A"
+   *
+   * The font is provided through a cache file to get a small, well-known font
+   * without the need of a font file.
+   */
+  StrokeFont* createFont(qreal glyphWidth) {
+    StrokeFontCache::Font font;
+    font.letterSpacing = 1.5;
+    font.lineSpacing   = 15.0;
+    StrokeFontCache::Glyph a;
+    a.spacing   = 0.5;
+    a.polylines = {{{0, 0, 0}, {glyphWidth / 2, 9, 0}, {glyphWidth, 0, 0}}};
+    font.glyphs.insert('A', a);
+    FilePath   cacheDir(mTmpDir.path());
+    QByteArray content = QString("font %1").arg(glyphWidth).toUtf8();
+    QByteArray hash =
+        QCryptographicHash::hash(content, QCryptographicHash::Sha256);
+    FileUtils::writeFile(
+        cacheDir.getPathTo(QString::fromLatin1(hash.toHex()) % ".lpsfc"),
+        StrokeFontCache::serialize(font, hash));  // can throw
+    return new StrokeFont(cacheDir.getPathTo("font.bene"), content, cacheDir);
+  }
+
+  QVector<Path> stroke(const StrokeFont& font) const noexcept {
+    Point bottomLeft, topRight;
+    return font.stroke(mText.getText(), mText.getHeight(),
+                       mText.calcLetterSpacing(), mText.calcLineSpacing(),
+                       mText.getAlign(), bottomLeft, topRight);
+  }
+
+  QTemporaryDir              mTmpDir;
+  QScopedPointer<StrokeFont> mFont;
+  QScopedPointer<StrokeFont> mWideFont;
+  StrokeText                 mText;
+  int                        mPathsChangedCount;
+  std::function<void(const StrokeText&, StrokeText::Event)> mOnEditedCallback;
+  StrokeText::OnEditedSlot mOnEditedSlot;
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(StrokeTextTest, testPathsAreCalculatedLazily) {
+  // as long as nobody fetched the paths, modifications don't announce them
+  mText.setFont(mFont.data());
+  mText.setText("AA");
+  mText.setHeight(PositiveLength(18000000));
+  EXPECT_EQ(0, mPathsChangedCount);
+
+  // the paths are calculated from the final state on the first access
+  EXPECT_EQ(stroke(*mFont), mText.getPaths());
+  EXPECT_EQ(2, mText.getPaths().count());
+  EXPECT_EQ(0, mPathsChangedCount);
+}
+
+TEST_F(StrokeTextTest, testPathsAreUpdatedOnHeightChange) {
+  mText.setFont(mFont.data());
+  QVector<Path> oldPaths = mText.getPaths();
+
+  EXPECT_TRUE(mText.setHeight(PositiveLength(18000000)));
+  EXPECT_EQ(1, mPathsChangedCount);
+  EXPECT_NE(oldPaths, mText.getPaths());
+  EXPECT_EQ(stroke(*mFont), mText.getPaths());
+}
+
+TEST_F(StrokeTextTest, testPathsAreUpdatedOnFontChange) {
+  mText.setFont(mFont.data());
+  QVector<Path> oldPaths = mText.getPaths();
+
+  mText.setFont(mWideFont.data());
+  EXPECT_EQ(1, mPathsChangedCount);
+  EXPECT_NE(oldPaths, mText.getPaths());
+  EXPECT_EQ(stroke(*mWideFont), mText.getPaths());
+}
+
+TEST_F(StrokeTextTest, testNoPathsChangedIfPathsAreEqual) {
+  mText.setFont(mFont.data());
+  QVector<Path> oldPaths = mText.getPaths();
+
+  // with fixed spacings, the stroke width does not affect the paths
+  EXPECT_TRUE(mText.setStrokeWidth(UnsignedLength(500000)));
+  EXPECT_EQ(0, mPathsChangedCount);
+  EXPECT_EQ(oldPaths, mText.getPaths());
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace librepcb
@@ -0,0 +1,107 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2016 The LibrePCB developers
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <gtest/gtest.h>
+#include <librepcb/common/profiler.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class ProfilerTest : public ::testing::Test {
+protected:
+  virtual void SetUp() override { Profiler::instance().clear(); }
+  virtual void TearDown() override {
+    Profiler::instance().setEnabled(false);
+    Profiler::instance().clear();
+  }
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(ProfilerTest, testDisabledByDefault) {
+  EXPECT_FALSE(Profiler::instance().isEnabled());
+  { ProfilerScope scope("test"); }
+  EXPECT_EQ(0, Profiler::instance().getPhases().count());
+}
+
+TEST_F(ProfilerTest, testMeasurementsAreAccumulated) {
+  Profiler::instance().setEnabled(true);
+  for (int i = 0; i < 3; ++i) {
+    ProfilerScope scope("outer");
+    {
+      ProfilerScope scope("inner");
+      QThread::msleep(2);
+    }
+  }
+  QList<Profiler::Phase> phases = Profiler::instance().getPhases();
+  ASSERT_EQ(2, phases.count());
+  EXPECT_EQ("inner", phases[0].name.toStdString());  // finished first
+  EXPECT_EQ(3, phases[0].count);
+  EXPECT_GE(phases[0].wallTimeNs, 6000000);
+  EXPECT_EQ("outer", phases[1].name.toStdString());
+  EXPECT_EQ(3, phases[1].count);
+  EXPECT_GE(phases[1].wallTimeNs, phases[0].wallTimeNs);
+}
+
+TEST_F(ProfilerTest, testFinish) {
+  Profiler::instance().setEnabled(true);
+  {
+    ProfilerScope scope("test");
+    scope.finish();
+    scope.finish();  // must not be counted twice
+  }
+  QList<Profiler::Phase> phases = Profiler::instance().getPhases();
+  ASSERT_EQ(1, phases.count());
+  EXPECT_EQ(1, phases[0].count);
+}
+
+TEST_F(ProfilerTest, testToJson) {
+  Profiler::instance().setEnabled(true);
+  { ProfilerScope scope("test"); }
+  QJsonParseError error;
+  QJsonDocument   doc = QJsonDocument::fromJson(Profiler::instance().toJson(),
+                                              &error);
+  ASSERT_EQ(QJsonParseError::NoError, error.error);
+  QJsonArray phases = doc.object().value("phases").toArray();
+  ASSERT_EQ(1, phases.count());
+  QJsonObject phase = phases[0].toObject();
+  EXPECT_EQ("test", phase.value("name").toString().toStdString());
+  EXPECT_EQ(1, phase.value("count").toInt());
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace librepcb
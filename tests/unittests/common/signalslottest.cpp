@@ -0,0 +1,139 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <gtest/gtest.h>
+#include <librepcb/common/signalslot.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*******************************************************************************
+ *  Helper Classes
+ ******************************************************************************/
+
+class SignalSlotTestSender {
+public:
+  Signal<SignalSlotTestSender, int> onEdited;
+  SignalSlotTestSender() : onEdited(*this) {}
+};
+
+class SignalSlotTestReceiver {
+public:
+  QList<int>                      mValues;
+  Slot<SignalSlotTestSender, int> mSlot;
+  SignalSlotTestReceiver() : mSlot(*this, &SignalSlotTestReceiver::edited) {}
+  void edited(const SignalSlotTestSender& sender, int value) noexcept {
+    Q_UNUSED(sender);
+    mValues.append(value);
+  }
+};
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class SignalSlotTest : public ::testing::Test {};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(SignalSlotTest, testNotify) {
+  SignalSlotTestSender   sender;
+  SignalSlotTestReceiver receiver;
+  sender.onEdited.attach(receiver.mSlot);
+  sender.onEdited.notify(1);
+  sender.onEdited.notify(2);
+  EXPECT_EQ(QList<int>({1, 2}), receiver.mValues);
+}
+
+TEST_F(SignalSlotTest, testBatchWithoutCoalescing) {
+  SignalSlotTestSender   sender;
+  SignalSlotTestReceiver receiver;
+  sender.onEdited.attach(receiver.mSlot);
+  {
+    SignalBatch batch;
+    sender.onEdited.notify(1);
+    sender.onEdited.notify(2);
+    EXPECT_EQ(QList<int>({1, 2}), receiver.mValues);
+  }
+  EXPECT_EQ(QList<int>({1, 2}), receiver.mValues);
+}
+
+TEST_F(SignalSlotTest, testBatchWithCoalescing) {
+  SignalSlotTestSender   sender;
+  SignalSlotTestReceiver receiver;
+  receiver.mSlot.setCoalescing(true);
+  sender.onEdited.attach(receiver.mSlot);
+  {
+    SignalBatch batch;
+    sender.onEdited.notify(1);
+    {
+      SignalBatch nestedBatch;
+      sender.onEdited.notify(2);
+    }
+    sender.onEdited.notify(3);
+    EXPECT_TRUE(receiver.mValues.isEmpty());
+  }
+  EXPECT_EQ(QList<int>({3}), receiver.mValues);
+  sender.onEdited.notify(4);
+  EXPECT_EQ(QList<int>({3, 4}), receiver.mValues);
+}
+
+TEST_F(SignalSlotTest, testBatchWithDetachedSlot) {
+  SignalSlotTestSender   sender;
+  SignalSlotTestReceiver receiver;
+  receiver.mSlot.setCoalescing(true);
+  sender.onEdited.attach(receiver.mSlot);
+  {
+    SignalBatch batch;
+    sender.onEdited.notify(1);
+    sender.onEdited.detach(receiver.mSlot);
+  }
+  EXPECT_TRUE(receiver.mValues.isEmpty());
+}
+
+TEST_F(SignalSlotTest, testBatchWithDestroyedSender) {
+  SignalSlotTestReceiver receiver;
+  receiver.mSlot.setCoalescing(true);
+  {
+    SignalBatch batch;
+    {
+      SignalSlotTestSender sender;
+      sender.onEdited.attach(receiver.mSlot);
+      sender.onEdited.notify(1);
+    }
+  }
+  EXPECT_TRUE(receiver.mValues.isEmpty());
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace librepcb
@@ -0,0 +1,140 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2016 The LibrePCB developers
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <gtest/gtest.h>
+#include <librepcb/common/fileio/fileutils.h>
+#include <librepcb/common/profiler.h>
+#include <librepcb/common/tracer.h>
+
+#include <QtCore>
+
+#include <thread>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class TracerTest : public ::testing::Test {
+protected:
+  virtual void SetUp() override {
+    // create temporary, empty directory
+    mTempDir   = FilePath::getApplicationTempPath().getPathTo("TracerTest");
+    mTraceFile = mTempDir.getPathTo("trace.json");
+    if (mTempDir.isExistingDir()) {
+      FileUtils::removeDirRecursively(mTempDir);  // can throw
+    }
+    FileUtils::makePath(mTempDir);
+  }
+
+  virtual void TearDown() override {
+    Tracer::stop();
+    // remove temporary directory
+    FileUtils::removeDirRecursively(mTempDir);  // can throw
+  }
+
+  QJsonArray readTraceEvents() const {
+    QJsonDocument doc =
+        QJsonDocument::fromJson(FileUtils::readFile(mTraceFile));
+    return doc.object().value("traceEvents").toArray();
+  }
+
+  FilePath mTempDir;
+  FilePath mTraceFile;
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(TracerTest, testInactive) {
+  EXPECT_FALSE(Tracer::isActive());
+  { ProfilerScope scope("inactive"); }
+  Tracer::stop();
+  EXPECT_FALSE(mTraceFile.isExistingFile());
+}
+
+TEST_F(TracerTest, testEventsAreWrittenOnStop) {
+  Tracer::start(mTraceFile);
+  EXPECT_TRUE(Tracer::isActive());
+  EXPECT_EQ(mTraceFile, Tracer::getFilePath());
+  {
+    ProfilerScope scope("outer");
+    { ProfilerScope scope("inner"); }
+  }
+  EXPECT_FALSE(mTraceFile.isExistingFile());
+  Tracer::stop();
+  EXPECT_FALSE(Tracer::isActive());
+
+  QJsonArray events = readTraceEvents();
+  ASSERT_EQ(2, events.count());
+  QJsonObject inner = events.at(0).toObject();
+  QJsonObject outer = events.at(1).toObject();
+  EXPECT_EQ("inner", inner.value("name").toString().toStdString());
+  EXPECT_EQ("outer", outer.value("name").toString().toStdString());
+  EXPECT_EQ("X", inner.value("ph").toString().toStdString());
+  EXPECT_LE(outer.value("ts").toDouble(), inner.value("ts").toDouble());
+  EXPECT_GE(outer.value("dur").toDouble(), inner.value("dur").toDouble());
+  EXPECT_EQ(inner.value("tid").toInt(), outer.value("tid").toInt());
+}
+
+TEST_F(TracerTest, testEventsFromMultipleThreads) {
+  Tracer::start(mTraceFile);
+  std::thread thread([]() { ProfilerScope scope("thread"); });
+  thread.join();
+  { ProfilerScope scope("main"); }
+  Tracer::stop();
+
+  QJsonArray events = readTraceEvents();
+  ASSERT_EQ(2, events.count());
+  EXPECT_NE(events.at(0).toObject().value("tid").toInt(),
+            events.at(1).toObject().value("tid").toInt());
+}
+
+TEST_F(TracerTest, testProfilerAndTracerUseSameScopes) {
+  Profiler::instance().setEnabled(true);
+  Tracer::start(mTraceFile);
+  { ProfilerScope scope("both"); }
+  Tracer::stop();
+  QList<Profiler::Phase> phases = Profiler::instance().getPhases();
+  Profiler::instance().setEnabled(false);
+  Profiler::instance().clear();
+
+  ASSERT_EQ(1, phases.count());
+  EXPECT_EQ("both", phases[0].name.toStdString());
+  QJsonArray events = readTraceEvents();
+  ASSERT_EQ(1, events.count());
+  EXPECT_EQ("both",
+            events.at(0).toObject().value("name").toString().toStdString());
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace librepcb
@@ -0,0 +1,262 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <gtest/gtest.h>
+#include <librepcb/common/undocommand.h>
+#include <librepcb/common/undocommandgroup.h>
+#include <librepcb/common/undostack.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Command
+ ******************************************************************************/
+
+class TestCommand final : public UndoCommand {
+public:
+  TestCommand(int& value, int newValue, qint64 memoryUsage = 0) noexcept
+    : UndoCommand("Set value"),
+      mValue(value),
+      mOldValue(value),
+      mNewValue(newValue),
+      mMemoryUsage(memoryUsage) {}
+
+  qint64 getMemoryUsage() const noexcept override { return mMemoryUsage; }
+  bool   canMergeWith(const UndoCommand& other) const noexcept override {
+    const TestCommand* cmd = dynamic_cast<const TestCommand*>(&other);
+    return cmd && (&cmd->mValue == &mValue);
+  }
+  void mergeWith(const UndoCommand& other) noexcept override {
+    mNewValue = dynamic_cast<const TestCommand&>(other).mNewValue;
+  }
+
+private:
+  bool performExecute() override {
+    performRedo();
+    return mNewValue != mOldValue;
+  }
+  void performUndo() override { mValue = mOldValue; }
+  void performRedo() override { mValue = mNewValue; }
+
+  int&   mValue;
+  int    mOldValue;
+  int    mNewValue;
+  qint64 mMemoryUsage;
+};
+
+/**
+ * @brief Command which edits or removes an item, like the board/schematic
+ *        commands do
+ *
+ * The item is represented by an entry in a set of alive items. A remove
+ * command owns the item as long as it is executed, thus it deletes the item
+ * when it gets destroyed. An edit command accesses the item in its destructor
+ * to detect dangling references.
+ */
+class ItemCommand final : public UndoCommand {
+public:
+  ItemCommand(QSet<int>& aliveItems, int item, bool remove,
+              QList<int>& danglingItems) noexcept
+    : UndoCommand(remove ? "Remove item" : "Edit item"),
+      mAliveItems(aliveItems),
+      mItem(item),
+      mRemove(remove),
+      mDanglingItems(danglingItems) {}
+  ~ItemCommand() noexcept {
+    if (!mAliveItems.contains(mItem)) {
+      mDanglingItems.append(mItem);
+    } else if (mRemove && isCurrentlyExecuted()) {
+      mAliveItems.remove(mItem);  // delete the removed item
+    }
+  }
+
+  qint64 getMemoryUsage() const noexcept override { return 100; }
+
+private:
+  bool performExecute() override { return true; }
+  void performUndo() override {}
+  void performRedo() override {}
+
+  QSet<int>&  mAliveItems;
+  int         mItem;
+  bool        mRemove;
+  QList<int>& mDanglingItems;
+};
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class UndoStackTest : public ::testing::Test {
+protected:
+  UndoStackTest() : mValue(0) {
+    mStack.setMergeInterval(60000);  // avoid timing issues
+    mStack.setMemoryLimit(0);        // unlimited
+  }
+
+  UndoStack mStack;
+  int       mValue;
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(UndoStackTest, testConsecutiveCommandsAreMerged) {
+  mStack.execCmd(new TestCommand(mValue, 1));
+  mStack.execCmd(new TestCommand(mValue, 2));
+  mStack.execCmd(new TestCommand(mValue, 3));
+  EXPECT_EQ(3, mValue);
+  mStack.undo();
+  EXPECT_EQ(0, mValue);
+  EXPECT_FALSE(mStack.canUndo());
+  mStack.redo();
+  EXPECT_EQ(3, mValue);
+}
+
+TEST_F(UndoStackTest, testCommandsOfDifferentTargetsAreNotMerged) {
+  int otherValue = 0;
+  mStack.execCmd(new TestCommand(mValue, 1));
+  mStack.execCmd(new TestCommand(otherValue, 2));
+  mStack.undo();
+  EXPECT_EQ(1, mValue);
+  EXPECT_EQ(0, otherValue);
+  EXPECT_TRUE(mStack.canUndo());
+}
+
+TEST_F(UndoStackTest, testNoMergeIfDisabled) {
+  mStack.setMergeInterval(0);
+  mStack.execCmd(new TestCommand(mValue, 1));
+  mStack.execCmd(new TestCommand(mValue, 2));
+  mStack.undo();
+  EXPECT_EQ(1, mValue);
+}
+
+TEST_F(UndoStackTest, testNoMergeAcrossCleanState) {
+  mStack.execCmd(new TestCommand(mValue, 1));
+  mStack.setClean();
+  mStack.execCmd(new TestCommand(mValue, 2));
+  mStack.undo();
+  EXPECT_EQ(1, mValue);
+  EXPECT_TRUE(mStack.isClean());
+}
+
+TEST_F(UndoStackTest, testNoMergeAfterUndo) {
+  mStack.execCmd(new TestCommand(mValue, 1));
+  mStack.execCmd(new TestCommand(mValue, 2));
+  mStack.undo();
+  mStack.redo();
+  mStack.execCmd(new TestCommand(mValue, 3));
+  mStack.undo();
+  EXPECT_EQ(2, mValue);
+}
+
+TEST_F(UndoStackTest, testCommandGroupsAreMergedPairwise) {
+  int otherValue = 0;
+  for (int i = 1; i <= 3; ++i) {
+    UndoCommandGroup* group = new UndoCommandGroup("Move");
+    group->appendChild(new TestCommand(mValue, i));
+    group->appendChild(new TestCommand(otherValue, i * 10));
+    mStack.execCmd(group);
+  }
+  EXPECT_EQ(3, mValue);
+  EXPECT_EQ(30, otherValue);
+  mStack.undo();
+  EXPECT_EQ(0, mValue);
+  EXPECT_EQ(0, otherValue);
+  EXPECT_FALSE(mStack.canUndo());
+}
+
+TEST_F(UndoStackTest, testMemoryUsage) {
+  mStack.setMergeInterval(0);
+  mStack.execCmd(new TestCommand(mValue, 1, 100));
+  mStack.execCmd(new TestCommand(mValue, 2, 200));
+  EXPECT_EQ(300, mStack.getMemoryUsage());
+  mStack.undo();
+  mStack.execCmd(new TestCommand(mValue, 3, 50));  // deletes redo command
+  EXPECT_EQ(150, mStack.getMemoryUsage());
+  mStack.clear();
+  EXPECT_EQ(0, mStack.getMemoryUsage());
+}
+
+TEST_F(UndoStackTest, testMemoryUsageOfCommandGroup) {
+  mStack.beginCmdGroup("Group");
+  mStack.appendToCmdGroup(new TestCommand(mValue, 1, 100));
+  mStack.appendToCmdGroup(new TestCommand(mValue, 2, 100));
+  mStack.commitCmdGroup();
+  EXPECT_GE(mStack.getMemoryUsage(), 200);
+}
+
+TEST_F(UndoStackTest, testMemoryLimitDeletesOldestCommands) {
+  mStack.setMergeInterval(0);
+  mStack.setMemoryLimit(250);
+  mStack.execCmd(new TestCommand(mValue, 1, 100));
+  mStack.execCmd(new TestCommand(mValue, 2, 100));
+  mStack.execCmd(new TestCommand(mValue, 3, 100));
+  EXPECT_EQ(200, mStack.getMemoryUsage());
+  EXPECT_FALSE(mStack.isClean());  // clean state was deleted
+  mStack.undo();
+  mStack.undo();
+  EXPECT_EQ(1, mValue);
+  EXPECT_FALSE(mStack.canUndo());
+}
+
+TEST_F(UndoStackTest, testMemoryLimitDoesNotLeaveDanglingReferences) {
+  // The oldest commands are deleted first, i.e. in the opposite order than
+  // clear() does. This must be safe since a removed item is owned by the
+  // executed remove command and only referenced by older commands.
+  QSet<int>  aliveItems = {1, 2};
+  QList<int> danglingItems;
+  mStack.setMergeInterval(0);
+  mStack.execCmd(new ItemCommand(aliveItems, 1, false, danglingItems));
+  mStack.execCmd(new ItemCommand(aliveItems, 1, true, danglingItems));
+  mStack.execCmd(new ItemCommand(aliveItems, 2, false, danglingItems));
+  mStack.execCmd(new ItemCommand(aliveItems, 2, true, danglingItems));
+  mStack.setMemoryLimit(150);
+  EXPECT_EQ(100, mStack.getMemoryUsage());
+  EXPECT_EQ(QSet<int>{2}, aliveItems);
+  mStack.clear();
+  EXPECT_EQ(QSet<int>{}, aliveItems);
+  EXPECT_EQ(QList<int>{}, danglingItems);
+}
+
+TEST_F(UndoStackTest, testTopCommandIsNeverDeleted) {
+  mStack.setMemoryLimit(50);
+  mStack.execCmd(new TestCommand(mValue, 1, 100));
+  EXPECT_EQ(100, mStack.getMemoryUsage());
+  EXPECT_TRUE(mStack.canUndo());
+  mStack.undo();
+  EXPECT_EQ(0, mValue);
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace librepcb
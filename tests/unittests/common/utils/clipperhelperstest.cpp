@@ -0,0 +1,107 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+
+#include <gtest/gtest.h>
+#include <librepcb/common/utils/clipperhelpers.h>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class ClipperHelpersTest : public ::testing::Test {
+protected:
+  static ClipperLib::Path rect(int x1, int y1, int x2, int y2) {
+    Path path = Path::rect(Point(Length(x1), Length(y1)),
+                           Point(Length(x2), Length(y2)));
+    return ClipperHelpers::convert(path, PositiveLength(5000));
+  }
+
+  static void subtract(const ClipperLib::Path&  outline,
+                       const ClipperLib::Paths& holes,
+                       ClipperLib::PolyTree&    tree) {
+    ClipperLib::Clipper c;
+    c.AddPath(outline, ClipperLib::ptSubject, true);
+    c.AddPaths(holes, ClipperLib::ptClip, true);
+    c.Execute(ClipperLib::ctDifference, tree, ClipperLib::pftEvenOdd,
+              ClipperLib::pftEvenOdd);
+  }
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(ClipperHelpersTest, testFlattenTreeWithoutHoles) {
+  ClipperLib::PolyTree tree;
+  subtract(rect(0, 0, 1000, 1000), ClipperLib::Paths(), tree);
+  ClipperLib::Paths paths = ClipperHelpers::flattenTree(tree);
+  ASSERT_EQ(1U, paths.size());
+  EXPECT_EQ(4U, paths.front().size());
+  EXPECT_DOUBLE_EQ(1000000.0, qAbs(ClipperLib::Area(paths.front())));
+}
+
+TEST_F(ClipperHelpersTest, testFlattenTreeWithHoles) {
+  ClipperLib::Paths holes;
+  for (int x = 0; x < 10; ++x) {
+    for (int y = 0; y < 10; ++y) {
+      holes.push_back(
+          rect(100 + x * 1000, 100 + y * 1000, 900 + x * 1000, 900 + y * 1000));
+    }
+  }
+  ClipperLib::PolyTree tree;
+  subtract(rect(0, 0, 10000, 10000), holes, tree);
+  ClipperLib::Paths paths = ClipperHelpers::flattenTree(tree);
+  ASSERT_EQ(1U, paths.size());
+  // every hole needs 4 vertices plus 3 vertices for the cut-in
+  EXPECT_EQ(4U + 100U * 7U, paths.front().size());
+  // cut-ins have no area, so the area must be the same as before
+  EXPECT_DOUBLE_EQ(10000.0 * 10000.0 - 100.0 * 800.0 * 800.0,
+                   qAbs(ClipperLib::Area(paths.front())));
+}
+
+TEST_F(ClipperHelpersTest, testFlattenTreeWithIslandInHole) {
+  ClipperLib::Paths paths;
+  paths.push_back(rect(0, 0, 3000, 3000));
+  paths.push_back(rect(500, 500, 2500, 2500));   // hole
+  paths.push_back(rect(1000, 1000, 2000, 2000));  // island inside the hole
+  ClipperLib::PolyTree tree;
+  ClipperLib::Clipper  c;
+  c.AddPaths(paths, ClipperLib::ptSubject, true);
+  c.Execute(ClipperLib::ctUnion, tree, ClipperLib::pftEvenOdd,
+            ClipperLib::pftEvenOdd);
+  ClipperLib::Paths result = ClipperHelpers::flattenTree(tree);
+  ASSERT_EQ(2U, result.size());
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace librepcb
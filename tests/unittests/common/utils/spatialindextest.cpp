@@ -0,0 +1,128 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+
+#include <gtest/gtest.h>
+#include <librepcb/common/utils/spatialindex.h>
+
+#include <random>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class SpatialIndexTest : public ::testing::Test {
+protected:
+  static Point randomPoint(std::mt19937& rng, int range) {
+    std::uniform_int_distribution<int> dist(-range, range);
+    return Point(Length(dist(rng)), Length(dist(rng)));
+  }
+
+  static bool overlaps(const QPair<Point, Point>& a,
+                       const QPair<Point, Point>& b) {
+    return (qMin(a.first.getX(), a.second.getX()) <=
+            qMax(b.first.getX(), b.second.getX())) &&
+           (qMin(b.first.getX(), b.second.getX()) <=
+            qMax(a.first.getX(), a.second.getX())) &&
+           (qMin(a.first.getY(), a.second.getY()) <=
+            qMax(b.first.getY(), b.second.getY())) &&
+           (qMin(b.first.getY(), b.second.getY()) <=
+            qMax(a.first.getY(), a.second.getY()));
+  }
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(SpatialIndexTest, testEmpty) {
+  SpatialIndex index(PositiveLength(100));
+  EXPECT_EQ(0, index.count());
+  EXPECT_EQ(QVector<int>(),
+            index.query(Point(-1000, -1000), Point(1000, 1000)));
+  EXPECT_EQ((QVector<QPair<int, int>>()), index.getOverlappingPairs());
+}
+
+TEST_F(SpatialIndexTest, testInsertReturnsIndex) {
+  SpatialIndex index(PositiveLength(100));
+  EXPECT_EQ(0, index.insert(Point(0, 0), Point(10, 10)));
+  EXPECT_EQ(1, index.insert(Point(10, 10), Point(0, 0)));
+  EXPECT_EQ(2, index.count());
+}
+
+TEST_F(SpatialIndexTest, testTouchingBoxesAcrossCellBorder) {
+  SpatialIndex index(PositiveLength(100));
+  index.insert(Point(-150, -50), Point(-100, 50));  // ends at cell border
+  index.insert(Point(-100, 0), Point(250, 20));     // spans several cells
+  index.insert(Point(251, 0), Point(300, 20));      // no overlap
+  EXPECT_EQ((QVector<QPair<int, int>>{qMakePair(0, 1)}),
+            index.getOverlappingPairs());
+  EXPECT_EQ((QVector<int>{1, 2}), index.query(Point(240, 5), Point(260, 6)));
+}
+
+TEST_F(SpatialIndexTest, testCompareWithBruteForce) {
+  std::mt19937                       rng(42);
+  QVector<QPair<Point, Point>>       boxes;
+  SpatialIndex                       index(PositiveLength(500));
+  std::uniform_int_distribution<int> sizeDist(0, 1500);
+  for (int i = 0; i < 300; ++i) {
+    Point p1 = randomPoint(rng, 10000);
+    Point p2 = p1 + Point(Length(sizeDist(rng)), Length(-sizeDist(rng)));
+    boxes.append(qMakePair(p1, p2));
+    EXPECT_EQ(i, index.insert(p1, p2));
+  }
+
+  QVector<QPair<int, int>> expectedPairs;
+  for (int i = 0; i < boxes.count(); ++i) {
+    for (int k = i + 1; k < boxes.count(); ++k) {
+      if (overlaps(boxes.at(i), boxes.at(k))) {
+        expectedPairs.append(qMakePair(i, k));
+      }
+    }
+  }
+  EXPECT_FALSE(expectedPairs.isEmpty());
+  EXPECT_EQ(expectedPairs, index.getOverlappingPairs());
+
+  for (int n = 0; n < 50; ++n) {
+    QPair<Point, Point> area(randomPoint(rng, 10000), randomPoint(rng, 10000));
+    QVector<int>        expected;
+    for (int i = 0; i < boxes.count(); ++i) {
+      if (overlaps(boxes.at(i), area)) {
+        expected.append(i);
+      }
+    }
+    EXPECT_EQ(expected, index.query(area.first, area.second));
+  }
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace librepcb
@@ -0,0 +1,134 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <gtest/gtest.h>
+#include <librepcb/eagleimport/converterdb.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace eagleimport {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class ConverterDbTest : public ::testing::Test {
+protected:
+  FilePath mTempDir;
+  FilePath mIniFp;
+  FilePath mLibFp;
+
+  ConverterDbTest()
+    : mTempDir(FilePath::getRandomTempPath()),
+      mIniFp(mTempDir.getPathTo("db.ini")),
+      mLibFp(mTempDir.getPathTo("lib.lbr")) {}
+
+  virtual ~ConverterDbTest() { QDir(mTempDir.toStr()).removeRecursively(); }
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(ConverterDbTest, testSameKeyReturnsSameUuid) {
+  ConverterDb db(mIniFp);
+  db.setCurrentLibraryFilePath(mLibFp);
+  Uuid uuid = db.getSymbolUuid("R");
+  EXPECT_EQ(uuid, db.getSymbolUuid("R"));
+  EXPECT_NE(uuid, db.getSymbolUuid("C"));
+  EXPECT_NE(uuid, db.getPackageUuid("R"));
+  EXPECT_EQ(3, db.getEntryCount());
+}
+
+TEST_F(ConverterDbTest, testUuidsArePersistent) {
+  Uuid symbolUuid = Uuid::createRandom();
+  Uuid pinUuid    = Uuid::createRandom();
+  {
+    ConverterDb db(mIniFp);
+    db.setCurrentLibraryFilePath(mLibFp);
+    symbolUuid = db.getSymbolUuid("R");
+    pinUuid    = db.getSymbolPinUuid(symbolUuid, "1");
+    db.save();
+  }
+  EXPECT_TRUE(mIniFp.isExistingFile());
+
+  ConverterDb db(mIniFp);
+  db.setCurrentLibraryFilePath(mLibFp);
+  EXPECT_EQ(2, db.getEntryCount());
+  EXPECT_EQ(symbolUuid, db.getSymbolUuid("R"));
+  EXPECT_EQ(pinUuid, db.getSymbolPinUuid(symbolUuid, "1"));
+}
+
+TEST_F(ConverterDbTest, testSavedOnDestruction) {
+  Uuid uuid = Uuid::createRandom();
+  {
+    ConverterDb db(mIniFp);
+    db.setCurrentLibraryFilePath(mLibFp);
+    uuid = db.getPackageUuid("0805");
+  }
+
+  ConverterDb db(mIniFp);
+  db.setCurrentLibraryFilePath(mLibFp);
+  EXPECT_EQ(uuid, db.getPackageUuid("0805"));
+}
+
+TEST_F(ConverterDbTest, testFileIsCompatibleWithQSettings) {
+  Uuid uuid = Uuid::createRandom();
+  {
+    ConverterDb db(mIniFp);
+    db.setCurrentLibraryFilePath(mLibFp);
+    uuid = db.getSymbolUuid("R {1}/ä");
+    db.save();
+  }
+
+  QSettings settings(mIniFp.toStr(), QSettings::IniFormat);
+  EXPECT_EQ(uuid.toStr(),
+            settings.value("symbols/lib.lbr_R_1__U2F____UE4___").toString());
+}
+
+TEST_F(ConverterDbTest, testLoadExistingFile) {
+  Uuid uuid = Uuid::createRandom();
+  {
+    QSettings settings(mIniFp.toStr(), QSettings::IniFormat);
+    settings.setValue("packages_to_packages/lib.lbr_0805_", uuid.toStr());
+    settings.setValue("packages_to_packages/lib.lbr_0603_", "invalid uuid");
+  }
+
+  ConverterDb db(mIniFp);
+  db.setCurrentLibraryFilePath(mLibFp);
+  EXPECT_EQ(1, db.getEntryCount());
+  EXPECT_EQ(uuid, db.getPackageUuid("0805"));
+  EXPECT_EQ(1, db.getEntryCount());
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace eagleimport
+}  // namespace librepcb
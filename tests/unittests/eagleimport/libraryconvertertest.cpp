@@ -0,0 +1,110 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <gtest/gtest.h>
+#include <librepcb/eagleimport/converterdb.h>
+#include <librepcb/eagleimport/libraryconverter.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace eagleimport {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class LibraryConverterTest : public ::testing::Test {
+protected:
+  FilePath mTestDataDir;
+  FilePath mTempDir;
+
+  LibraryConverterTest()
+    : mTestDataDir(TEST_DATA_DIR "/unittests/eagleimport"),
+      mTempDir(FilePath::getRandomTempPath()) {}
+
+  virtual ~LibraryConverterTest() {
+    QDir(mTempDir.toStr()).removeRecursively();
+  }
+
+  static QStringList listFiles(const FilePath& dir) {
+    QStringList files;
+    QDirIterator it(dir.toStr(), QDir::Files, QDirIterator::Subdirectories);
+    while (it.hasNext()) {
+      files.append(FilePath(it.next()).toRelative(dir));
+    }
+    files.sort();
+    return files;
+  }
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(LibraryConverterTest, testNonExistentFile) {
+  ConverterDb              db(mTempDir.getPathTo("db.ini"));
+  LibraryConverter         converter(db, mTempDir.getPathTo("out"));
+  LibraryConverter::Result result = converter.convert(
+      LibraryConverter::ElementType::Symbols,
+      {mTempDir.getPathTo("nonexistent.lbr")});
+  EXPECT_EQ(0, result.readElements);
+  EXPECT_EQ(0, result.convertedElements);
+  EXPECT_EQ(1, result.errors.count());
+}
+
+TEST_F(LibraryConverterTest, testOutputIsIndependentOfThreadCount) {
+  QList<FilePath> files = {mTestDataDir.getPathTo("resistor.lbr")};
+  ConverterDb     db(mTempDir.getPathTo("db.ini"));
+
+  QList<QStringList> outputs;
+  foreach (int threads, QList<int>({1, 4})) {
+    FilePath         outDir = mTempDir.getPathTo(QString::number(threads));
+    LibraryConverter converter(db, outDir);
+    converter.setMaxThreadCount(threads);
+    EXPECT_EQ(threads, converter.getMaxThreadCount());
+    foreach (LibraryConverter::ElementType type,
+             QList<LibraryConverter::ElementType>(
+                 {LibraryConverter::ElementType::Symbols,
+                  LibraryConverter::ElementType::Packages,
+                  LibraryConverter::ElementType::Devices})) {
+      LibraryConverter::Result result = converter.convert(type, files);
+      EXPECT_EQ(QStringList(), result.errors);
+      EXPECT_GT(result.readElements, 0);
+    }
+    outputs.append(listFiles(outDir));
+  }
+  EXPECT_FALSE(outputs.first().isEmpty());
+  EXPECT_EQ(outputs.first(), outputs.last());
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace eagleimport
+}  // namespace librepcb
@@ -0,0 +1,121 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <gtest/gtest.h>
+#include <librepcb/common/fileio/fileutils.h>
+#include <librepcb/common/fileio/transactionalfilesystem.h>
+#include <librepcb/library/library.h>
+#include <librepcb/library/libraryupgrader.h>
+#include <librepcb/library/sym/symbol.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace library {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class LibraryUpgraderTest : public ::testing::Test {
+protected:
+  FilePath mTempDir;
+  FilePath mLibDir;
+  FilePath mSymbolDir;
+
+  LibraryUpgraderTest() : mTempDir(FilePath::getRandomTempPath()) {
+    mLibDir = mTempDir.getPathTo("Test.lplib");
+
+    // create a library containing a single symbol
+    std::shared_ptr<TransactionalFileSystem> fs =
+        TransactionalFileSystem::openRW(mLibDir);
+    TransactionalDirectory libDir(fs);
+    Library lib(Uuid::createRandom(), Version::fromString("1.0"), "test",
+                ElementName("Test"), "", "");
+    lib.moveTo(libDir);
+    TransactionalDirectory symDir(fs, lib.getElementsDirectoryName<Symbol>());
+    Symbol sym(Uuid::createRandom(), Version::fromString("1.0"), "test",
+               ElementName("Test"), "", "");
+    sym.moveIntoParentDirectory(symDir);
+    fs->save();
+    mSymbolDir = mLibDir.getPathTo("sym/" % sym.getUuid().toStr());
+  }
+
+  virtual ~LibraryUpgraderTest() {
+    QDir(mTempDir.toStr()).removeRecursively();
+  }
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(LibraryUpgraderTest, testUpToDateLibraryIsNotWritten) {
+  LibraryUpgrader         upgrader;
+  LibraryUpgrader::Result result = upgrader.upgrade({mLibDir});
+  EXPECT_EQ(QStringList(), result.errors);
+  EXPECT_EQ(QList<FilePath>(), result.upgraded);
+  EXPECT_EQ(2, result.unchanged);  // library + symbol
+  EXPECT_EQ(2, result.getProcessedCount());
+}
+
+TEST_F(LibraryUpgraderTest, testModifiedElementIsWritten) {
+  FilePath   fp       = mSymbolDir.getPathTo("symbol.lp");
+  QByteArray original = FileUtils::readFile(fp);
+  FileUtils::writeFile(fp, original + "\n");
+
+  LibraryUpgrader upgrader;
+  upgrader.setMaxThreadCount(2);
+  LibraryUpgrader::Result result = upgrader.upgrade({mLibDir});
+  EXPECT_EQ(QStringList(), result.errors);
+  EXPECT_EQ(QList<FilePath>({mSymbolDir}), result.upgraded);
+  EXPECT_EQ(1, result.unchanged);
+  EXPECT_EQ(original, FileUtils::readFile(fp));
+}
+
+TEST_F(LibraryUpgraderTest, testElementFilter) {
+  LibraryUpgrader upgrader;
+  upgrader.setElements(LibraryUpgrader::SYMBOLS);
+  LibraryUpgrader::Result result = upgrader.upgrade({mLibDir});
+  EXPECT_EQ(QStringList(), result.errors);
+  EXPECT_EQ(1, result.getProcessedCount());
+}
+
+TEST_F(LibraryUpgraderTest, testNonExistentLibrary) {
+  LibraryUpgrader         upgrader;
+  LibraryUpgrader::Result result =
+      upgrader.upgrade({mTempDir.getPathTo("Nonexistent.lplib")});
+  EXPECT_EQ(1, result.errors.count());
+  EXPECT_EQ(0, result.getProcessedCount() - result.errors.count());
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace library
+}  // namespace librepcb
@@ -0,0 +1,141 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <gtest/gtest.h>
+#include <librepcb/common/graphics/graphicslayer.h>
+#include <librepcb/library/pkg/msg/msgpadoverlapswithplacement.h>
+#include <librepcb/library/pkg/package.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace library {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+/**
+ * @brief The PackageCheckTest checks the overlap of pads with the placement
+ *        layers, which first compares the bounding rects of the areas
+ *
+ * Every test creates a package with a 1x1mm pad at the origin.
+ */
+class PackageCheckTest : public ::testing::Test {
+protected:
+  QScopedPointer<Package>    mPackage;
+  std::shared_ptr<Footprint> mFootprint;
+
+  PackageCheckTest() {
+    mPackage.reset(new Package(Uuid::createRandom(),
+                               Version::fromString("1.0"), "test",
+                               ElementName("Test"), "", ""));
+    mFootprint = std::make_shared<Footprint>(Uuid::createRandom(),
+                                             ElementName("default"), "");
+    mPackage->getFootprints().append(mFootprint);
+  }
+
+  void addPad(FootprintPad::BoardSide side) {
+    Uuid uuid = Uuid::createRandom();
+    mPackage->getPads().append(
+        std::make_shared<PackagePad>(uuid, CircuitIdentifier("1")));
+    mFootprint->getPads().append(std::make_shared<FootprintPad>(
+        uuid, Point(0, 0), Angle::deg0(), FootprintPad::Shape::RECT,
+        PositiveLength(1000000), PositiveLength(1000000), UnsignedLength(0),
+        side));
+  }
+
+  void addPlacement(const QString& layer, const Point& p1, const Point& p2,
+                    bool fill) {
+    mFootprint->getPolygons().append(std::make_shared<Polygon>(
+        Uuid::createRandom(), GraphicsLayerName(layer),
+        UnsignedLength(200000), fill, false, Path::rect(p1, p2)));
+  }
+
+  int countOverlaps() {
+    int count = 0;
+    foreach (const auto& msg, mPackage->runChecks()) {
+      if (std::dynamic_pointer_cast<const MsgPadOverlapsWithPlacement>(msg)) {
+        ++count;
+      }
+    }
+    return count;
+  }
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(PackageCheckTest, testPadOverlapsWithPlacement) {
+  addPad(FootprintPad::BoardSide::TOP);
+  addPlacement(GraphicsLayer::sTopPlacement, Point::fromMm(-0.2, -0.2),
+               Point::fromMm(3, 3), true);
+  EXPECT_EQ(1, countOverlaps());
+}
+
+TEST_F(PackageCheckTest, testPadOverlapsWithSecondPlacementArea) {
+  addPad(FootprintPad::BoardSide::TOP);
+  addPlacement(GraphicsLayer::sTopPlacement, Point::fromMm(5, 5),
+               Point::fromMm(6, 6), true);
+  addPlacement(GraphicsLayer::sTopPlacement, Point::fromMm(0.3, 0.3),
+               Point::fromMm(3, 3), true);
+  EXPECT_EQ(1, countOverlaps());
+}
+
+TEST_F(PackageCheckTest, testPadFarFromPlacement) {
+  // bounding rects do not overlap
+  addPad(FootprintPad::BoardSide::TOP);
+  addPlacement(GraphicsLayer::sTopPlacement, Point::fromMm(5, 5),
+               Point::fromMm(6, 6), true);
+  EXPECT_EQ(0, countOverlaps());
+}
+
+TEST_F(PackageCheckTest, testPadWithinUnfilledPlacementOutline) {
+  // bounding rects overlap, but the outline does not touch the pad
+  addPad(FootprintPad::BoardSide::TOP);
+  addPlacement(GraphicsLayer::sTopPlacement, Point::fromMm(-3, -3),
+               Point::fromMm(3, 3), false);
+  EXPECT_EQ(0, countOverlaps());
+}
+
+TEST_F(PackageCheckTest, testPadOverlapsWithPlacementOfOtherSide) {
+  addPad(FootprintPad::BoardSide::BOTTOM);
+  addPlacement(GraphicsLayer::sTopPlacement, Point::fromMm(-0.2, -0.2),
+               Point::fromMm(3, 3), true);
+  EXPECT_EQ(0, countOverlaps());
+  addPlacement(GraphicsLayer::sBotPlacement, Point::fromMm(-0.2, -0.2),
+               Point::fromMm(3, 3), true);
+  EXPECT_EQ(1, countOverlaps());
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace library
+}  // namespace librepcb
@@ -24,6 +24,7 @@
 #include <gmock/gmock.h>
 #include <librepcb/common/application.h>
 #include <librepcb/common/debug.h>
+#include <librepcb/common/font/strokefontcache.h>
 
 #include <QtCore>
 
@@ -37,6 +38,11 @@ using namespace librepcb;
  ******************************************************************************/
 
 int main(int argc, char* argv[]) {
+  // don't write stroke font cache files into the user's cache location
+  QTemporaryDir cacheDir;
+  StrokeFontCache::setDirectory(
+      cacheDir.isValid() ? FilePath(cacheDir.path()) : FilePath());
+
   // many classes rely on a QApplication instance, so we create it here
   Application app(argc, argv);
   Application::setOrganizationName("LibrePCB");
@@ -0,0 +1,254 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <gtest/gtest.h>
+#include <librepcb/common/fileio/transactionalfilesystem.h>
+#include <librepcb/common/graphics/graphicslayer.h>
+#include <librepcb/project/boards/board.h>
+#include <librepcb/project/boards/boardlayerstack.h>
+#include <librepcb/project/boards/drc/boarddesignrulecheck.h>
+#include <librepcb/project/boards/items/bi_hole.h>
+#include <librepcb/project/boards/items/bi_netline.h>
+#include <librepcb/project/boards/items/bi_netpoint.h>
+#include <librepcb/project/boards/items/bi_netsegment.h>
+#include <librepcb/project/boards/items/bi_polygon.h>
+#include <librepcb/project/boards/items/bi_via.h>
+#include <librepcb/project/circuit/circuit.h>
+#include <librepcb/project/circuit/netclass.h>
+#include <librepcb/project/circuit/netsignal.h>
+#include <librepcb/project/project.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace project {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+/**
+ * @brief The BoardDesignRuleCheckTest checks the violations reported by the
+ *        ::librepcb::project::BoardDesignRuleCheck
+ *
+ * Every test creates a new project with a board and two nets "A" and "B",
+ * adds items with a known violation and checks the reported messages. The
+ * board has the default 100x80mm outline of new boards.
+ */
+class BoardDesignRuleCheckTest : public ::testing::Test {
+protected:
+  FilePath                mProjectDir;
+  QScopedPointer<Project> mProject;
+  Board*                  mBoard;
+  NetSignal*              mNetA;
+  NetSignal*              mNetB;
+
+  BoardDesignRuleCheckTest() {
+    mProjectDir = FilePath::getRandomTempPath();
+    mProject.reset(Project::create(
+        std::unique_ptr<TransactionalDirectory>(new TransactionalDirectory(
+            TransactionalFileSystem::openRW(mProjectDir))),
+        "project.lpp"));
+    mBoard = mProject->createBoard(ElementName("board"));
+    mProject->addBoard(*mBoard);
+    mNetA = addNetSignal("A");
+    mNetB = addNetSignal("B");
+  }
+
+  virtual ~BoardDesignRuleCheckTest() {
+    mProject.reset();
+    QDir(mProjectDir.toStr()).removeRecursively();
+  }
+
+  void addOutline(const Point& p1, const Point& p2) {
+    mBoard->addPolygon(*new BI_Polygon(
+        *mBoard, Uuid::createRandom(),
+        GraphicsLayerName(GraphicsLayer::sBoardOutlines), UnsignedLength(0),
+        false, false, Path::rect(p1, p2)));
+  }
+
+  NetSignal* addNetSignal(const QString& name) {
+    Circuit&   circuit   = mProject->getCircuit();
+    NetSignal* netsignal = new NetSignal(
+        circuit, *circuit.getNetClasses().first(), CircuitIdentifier(name),
+        false);
+    circuit.addNetSignal(*netsignal);
+    return netsignal;
+  }
+
+  void addTrace(NetSignal& netsignal, const Point& p1, const Point& p2,
+                const PositiveLength& width) {
+    BI_NetSegment* netsegment = new BI_NetSegment(*mBoard, netsignal);
+    mBoard->addNetSegment(*netsegment);
+    BI_NetPoint* start = new BI_NetPoint(*netsegment, p1);
+    BI_NetPoint* end   = new BI_NetPoint(*netsegment, p2);
+    BI_NetLine*  netline =
+        new BI_NetLine(*netsegment, *start, *end,
+                       *mBoard->getLayerStack().getLayer(
+                           GraphicsLayer::sTopCopper),
+                       width);
+    netsegment->addElements({}, {start, end}, {netline});
+  }
+
+  void addVia(NetSignal& netsignal, const Point& pos,
+              const PositiveLength& size, const PositiveLength& drill) {
+    BI_NetSegment* netsegment = new BI_NetSegment(*mBoard, netsignal);
+    mBoard->addNetSegment(*netsegment);
+    netsegment->addElements(
+        {new BI_Via(*netsegment, pos, BI_Via::Shape::Round, size, drill)}, {},
+        {});
+  }
+
+  void addHole(const Point& pos, const PositiveLength& diameter) {
+    mBoard->addHole(
+        *new BI_Hole(*mBoard, Hole(Uuid::createRandom(), pos, diameter)));
+  }
+
+  QStringList runDrc() {
+    BoardDesignRuleCheck drc(*mBoard, BoardDesignRuleCheck::Options());
+    drc.execute();
+    QStringList messages;
+    foreach (const BoardDesignRuleCheckMessage& msg, drc.getMessages()) {
+      messages.append(msg.getMessage());
+    }
+    return messages;
+  }
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(BoardDesignRuleCheckTest, testNoViolations) {
+  addTrace(*mNetA, Point::fromMm(10, 10), Point::fromMm(20, 10),
+           PositiveLength(300000));
+  addTrace(*mNetB, Point::fromMm(10, 11), Point::fromMm(20, 11),
+           PositiveLength(300000));
+  addVia(*mNetA, Point::fromMm(40, 40), PositiveLength(700000),
+         PositiveLength(300000));
+  addHole(Point::fromMm(30, 20), PositiveLength(300000));
+  addHole(Point::fromMm(32, 20), PositiveLength(300000));
+  EXPECT_EQ(QStringList(), runDrc());
+}
+
+TEST_F(BoardDesignRuleCheckTest, testCopperClearanceViolation) {
+  // gap of 0.1mm between the traces
+  addTrace(*mNetA, Point::fromMm(10, 10), Point::fromMm(20, 10),
+           PositiveLength(500000));
+  addTrace(*mNetB, Point::fromMm(10, 10.6), Point::fromMm(20, 10.6),
+           PositiveLength(500000));
+  EXPECT_EQ(QStringList{"Clearance violation between trace of net \"A\" and "
+                        "trace of net \"B\""},
+            runDrc());
+}
+
+TEST_F(BoardDesignRuleCheckTest, testCopperClearanceOfSameNetIsIgnored) {
+  addTrace(*mNetA, Point::fromMm(10, 10), Point::fromMm(20, 10),
+           PositiveLength(500000));
+  addTrace(*mNetA, Point::fromMm(10, 10.6), Point::fromMm(20, 10.6),
+           PositiveLength(500000));
+  EXPECT_EQ(QStringList(), runDrc());
+}
+
+TEST_F(BoardDesignRuleCheckTest, testMinimumWidthViolation) {
+  addTrace(*mNetA, Point::fromMm(10, 30), Point::fromMm(20, 30),
+           PositiveLength(100000));
+  EXPECT_EQ(QStringList{"Minimum width violation of trace of net \"A\": "
+                        "0.1mm < 0.2mm"},
+            runDrc());
+}
+
+TEST_F(BoardDesignRuleCheckTest, testMinimumAnnularRingViolation) {
+  addVia(*mNetA, Point::fromMm(40, 40), PositiveLength(500000),
+         PositiveLength(300000));
+  EXPECT_EQ(QStringList{"Minimum annular ring violation of via of net \"A\": "
+                        "0.1mm < 0.2mm"},
+            runDrc());
+}
+
+TEST_F(BoardDesignRuleCheckTest, testDrillClearanceViolation) {
+  addHole(Point::fromMm(30, 20), PositiveLength(300000));
+  addHole(Point::fromMm(30.5, 20), PositiveLength(300000));
+  EXPECT_EQ(QStringList{"Drill clearance violation between hole and hole: "
+                        "0.2mm < 0.35mm"},
+            runDrc());
+}
+
+TEST_F(BoardDesignRuleCheckTest, testBoardOutlineClearanceViolation) {
+  // trace crosses the right edge of the board
+  addTrace(*mNetB, Point::fromMm(95, 5), Point::fromMm(102, 5),
+           PositiveLength(500000));
+  EXPECT_EQ(QStringList{"Clearance violation between trace of net \"B\" and "
+                        "board outline"},
+            runDrc());
+}
+
+TEST_F(BoardDesignRuleCheckTest, testBoardCutoutClearanceViolation) {
+  // trace crosses a cutout within the board
+  addOutline(Point::fromMm(60, 60), Point::fromMm(70, 70));
+  addTrace(*mNetB, Point::fromMm(55, 65), Point::fromMm(75, 65),
+           PositiveLength(500000));
+  EXPECT_EQ(QStringList{"Clearance violation between trace of net \"B\" and "
+                        "board outline"},
+            runDrc());
+}
+
+TEST_F(BoardDesignRuleCheckTest, testOverlappingOutlinesAreMerged) {
+  // second outline overlaps the right edge of the default outline
+  addOutline(Point::fromMm(90, 0), Point::fromMm(120, 40));
+  addTrace(*mNetB, Point::fromMm(85, 20), Point::fromMm(115, 20),
+           PositiveLength(500000));
+  EXPECT_EQ(QStringList(), runDrc());
+}
+
+TEST_F(BoardDesignRuleCheckTest, testMultipleViolationsAreDeterministic) {
+  addTrace(*mNetA, Point::fromMm(10, 10), Point::fromMm(20, 10),
+           PositiveLength(500000));
+  addTrace(*mNetB, Point::fromMm(10, 10.6), Point::fromMm(20, 10.6),
+           PositiveLength(500000));
+  addTrace(*mNetA, Point::fromMm(10, 30), Point::fromMm(20, 30),
+           PositiveLength(100000));
+  addVia(*mNetA, Point::fromMm(40, 40), PositiveLength(500000),
+         PositiveLength(300000));
+  addHole(Point::fromMm(30, 20), PositiveLength(300000));
+  addHole(Point::fromMm(30.5, 20), PositiveLength(300000));
+  QStringList expected = {
+      "Minimum width violation of trace of net \"A\": 0.1mm < 0.2mm",
+      "Minimum annular ring violation of via of net \"A\": 0.1mm < 0.2mm",
+      "Clearance violation between trace of net \"A\" and trace of net \"B\"",
+      "Drill clearance violation between hole and hole: 0.2mm < 0.35mm",
+  };
+  EXPECT_EQ(expected, runDrc());
+  EXPECT_EQ(expected, runDrc());
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace project
+}  // namespace librepcb
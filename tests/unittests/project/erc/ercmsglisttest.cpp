@@ -0,0 +1,189 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <gtest/gtest.h>
+#include <librepcb/common/fileio/transactionalfilesystem.h>
+#include <librepcb/project/circuit/circuit.h>
+#include <librepcb/project/circuit/netclass.h>
+#include <librepcb/project/erc/ercmsg.h>
+#include <librepcb/project/erc/ercmsglist.h>
+#include <librepcb/project/erc/if_ercmsgprovider.h>
+#include <librepcb/project/project.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace project {
+namespace tests {
+
+/*******************************************************************************
+ *  Class ErcMsgProviderMock
+ ******************************************************************************/
+
+class ErcMsgProviderMock final : public IF_ErcMsgProvider {
+  DECLARE_ERC_MSG_CLASS_NAME(ErcMsgProviderMock)
+
+public:
+  explicit ErcMsgProviderMock(Project& project) noexcept
+    : mProject(project), mUpdateCount(0) {}
+
+  int getUpdateCount() const noexcept { return mUpdateCount; }
+
+  /// Set the text of the provided message, or remove it if empty
+  void setValue(const QString& value) noexcept {
+    mValue = value;
+    scheduleErcMessagesUpdate(mProject);
+  }
+
+private:
+  void updateErcMessages() noexcept override {
+    ++mUpdateCount;
+    if (mValue.isEmpty()) {
+      mErcMsg.reset();
+    } else {
+      if (!mErcMsg) {
+        mErcMsg.reset(new ErcMsg(mProject, *this, "owner", "value",
+                                 ErcMsg::ErcMsgType_t::CircuitWarning));
+      }
+      mErcMsg->setMsg(mValue);
+      mErcMsg->setVisible(true);
+    }
+  }
+
+  Project&               mProject;
+  QString                mValue;
+  int                    mUpdateCount;
+  QScopedPointer<ErcMsg> mErcMsg;
+};
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class ErcMsgListTest : public ::testing::Test {
+protected:
+  ErcMsgListTest()
+    : mProjectDir(FilePath::getRandomTempPath()),
+      mProject(Project::create(
+          std::unique_ptr<TransactionalDirectory>(new TransactionalDirectory(
+              TransactionalFileSystem::openRW(mProjectDir))),
+          "project.lpp")) {
+    // run the updates scheduled while creating the project
+    mProject->getErcMsgList().getItems();
+  }
+
+  virtual ~ErcMsgListTest() {
+    mProject.reset();
+    QDir(mProjectDir.toStr()).removeRecursively();
+  }
+
+  QList<ErcMsg*> getMessagesOf(const IF_ErcMsgProvider& provider) const
+      noexcept {
+    QList<ErcMsg*> messages;
+    foreach (ErcMsg* msg, mProject->getErcMsgList().getItems()) {
+      if (&msg->getOwner() == &provider) {
+        messages.append(msg);
+      }
+    }
+    return messages;
+  }
+
+  FilePath                mProjectDir;
+  QScopedPointer<Project> mProject;
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(ErcMsgListTest, testModificationsAreBatched) {
+  int     added   = 0;
+  int     removed = 0;
+  QObject context;  // disconnects the counters when leaving the test
+  QObject::connect(&mProject->getErcMsgList(), &ErcMsgList::ercMsgAdded,
+                   &context, [&added]() { ++added; });
+  QObject::connect(&mProject->getErcMsgList(), &ErcMsgList::ercMsgRemoved,
+                   &context, [&removed]() { ++removed; });
+  ErcMsgProviderMock provider(*mProject);
+
+  // several modifications in a row only schedule an update
+  provider.setValue("first");
+  provider.setValue("");
+  provider.setValue("second");
+  provider.setValue("final");
+  EXPECT_EQ(0, provider.getUpdateCount());
+  EXPECT_EQ(0, added);
+
+  // the messages are updated once, with the final state
+  QList<ErcMsg*> messages = getMessagesOf(provider);
+  EXPECT_EQ(1, provider.getUpdateCount());
+  EXPECT_EQ(1, added);
+  EXPECT_EQ(0, removed);
+  ASSERT_EQ(1, messages.count());
+  EXPECT_EQ(QString("final"), messages.first()->getMsg());
+
+  // no further updates without modifications
+  getMessagesOf(provider);
+  EXPECT_EQ(1, provider.getUpdateCount());
+
+  // a batch which restores the original state leads to the same messages
+  provider.setValue("");
+  provider.setValue("final");
+  messages = getMessagesOf(provider);
+  EXPECT_EQ(2, provider.getUpdateCount());
+  EXPECT_EQ(1, added);
+  EXPECT_EQ(0, removed);
+  ASSERT_EQ(1, messages.count());
+  EXPECT_EQ(QString("final"), messages.first()->getMsg());
+}
+
+TEST_F(ErcMsgListTest, testNetClassModificationsAreBatched) {
+  Circuit& circuit = mProject->getCircuit();
+  ASSERT_EQ(1, circuit.getNetClasses().count());
+  NetClass& netclass = *circuit.getNetClasses().first();
+  ASSERT_EQ(1, getMessagesOf(netclass).count());  // unused net class
+  int     changed = 0;
+  QObject context;  // disconnects the counter when leaving the test
+  QObject::connect(&mProject->getErcMsgList(), &ErcMsgList::ercMsgChanged,
+                   &context, [&changed]() { ++changed; });
+
+  circuit.setNetClassName(netclass, ElementName("foo"));
+  circuit.setNetClassName(netclass, ElementName("bar"));
+  EXPECT_EQ(0, changed);
+
+  QList<ErcMsg*> messages = getMessagesOf(netclass);
+  EXPECT_EQ(1, changed);
+  ASSERT_EQ(1, messages.count());
+  EXPECT_TRUE(messages.first()->getMsg().contains("\"bar\""));
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace project
+}  // namespace librepcb
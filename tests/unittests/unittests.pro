@@ -70,27 +70,43 @@ SOURCES += \
     common/fileio/serializableobjectlisttest.cpp \
     common/fileio/transactionaldirectorytest.cpp \
     common/fileio/transactionalfilesystemtest.cpp \
+    common/fileio/zipstreamextractortest.cpp \
     common/filepathtest.cpp \
+    common/font/strokefontcachetest.cpp \
+    common/font/strokefonttest.cpp \
     common/geometry/pathtest.cpp \
+    common/geometry/stroketexttest.cpp \
     common/lengthsnaptest.cpp \
     common/lengthtest.cpp \
     common/networkrequesttest.cpp \
     common/pointtest.cpp \
+    common/profilertest.cpp \
     common/ratiotest.cpp \
     common/scopeguardtest.cpp \
+    common/signalslottest.cpp \
     common/sqlitedatabasetest.cpp \
     common/systeminfotest.cpp \
     common/toolboxtest.cpp \
+    common/tracertest.cpp \
+    common/utils/clipperhelperstest.cpp \
+    common/utils/spatialindextest.cpp \
+    common/undostacktest.cpp \
     common/uuidtest.cpp \
     common/versiontest.cpp \
+    eagleimport/converterdbtest.cpp \
     eagleimport/deviceconvertertest.cpp \
     eagleimport/devicesetconvertertest.cpp \
+    eagleimport/libraryconvertertest.cpp \
     eagleimport/packageconvertertest.cpp \
     eagleimport/symbolconvertertest.cpp \
     library/componentsymbolvariantitemtest.cpp \
     library/librarybaseelementtest.cpp \
+    library/libraryupgradertest.cpp \
+    library/packagechecktest.cpp \
     main.cpp \
+    project/boards/boarddesignrulechecktest.cpp \
     project/boards/boardplanefragmentsbuildertest.cpp \
+    project/erc/ercmsglisttest.cpp \
     project/library/projectlibrarytest.cpp \
     project/projecttest.cpp \
     workspace/workspacetest.cpp \